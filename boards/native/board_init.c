@@ -35,6 +35,10 @@ void board_init(void)
 }
 
 #ifdef MODULE_MTD
+#if MTD_NATIVE_WEAR
+static uint32_t mtd0_wear[MTD_SECTOR_NUM];
+#endif
+
 static mtd_native_dev_t mtd0_dev = {
     .dev = {
         .driver = &native_flash_driver,
@@ -43,6 +47,11 @@ static mtd_native_dev_t mtd0_dev = {
         .page_size = MTD_PAGE_SIZE,
     },
     .fname = MTD_NATIVE_FILENAME,
+#if MTD_NATIVE_WEAR
+    .wear = mtd0_wear,
+#endif
+    .write_latency_us = MTD_NATIVE_WRITE_LATENCY_US,
+    .erase_latency_us = MTD_NATIVE_ERASE_LATENCY_US,
 };
 
 mtd_dev_t *mtd0 = (mtd_dev_t *)&mtd0_dev;
@@ -71,6 +71,15 @@ void _native_LED_RED_TOGGLE(void);
 #ifndef MTD_NATIVE_FILENAME
 #define MTD_NATIVE_FILENAME     "MEMORY.bin"
 #endif
+#ifndef MTD_NATIVE_WRITE_LATENCY_US
+#define MTD_NATIVE_WRITE_LATENCY_US (0)     /**< simulated page program time */
+#endif
+#ifndef MTD_NATIVE_ERASE_LATENCY_US
+#define MTD_NATIVE_ERASE_LATENCY_US (0)     /**< simulated sector erase time */
+#endif
+#ifndef MTD_NATIVE_WEAR
+#define MTD_NATIVE_WEAR         (0)         /**< count erase cycles per sector */
+#endif
 /** @} */
 
 /** Default MTD device */
@@ -99,6 +99,25 @@ int _mbox_put(mbox_t *mbox, msg_t *msg, int blocking);
  */
 int _mbox_get(mbox_t *mbox, msg_t *msg, int blocking);
 
+/**
+ * @brief Get up to @p num messages from mailbox
+ *
+ * All queued messages (up to @p num) are taken in one critical section. If
+ * the mailbox is empty, this function will either return right away or wait
+ * for a single message.
+ *
+ * @internal
+ *
+ * @param[in] mbox      ptr to mailbox to operate on
+ * @param[in] msgs      ptr to storage for @p num retrieved messages
+ * @param[in] num       maximum number of messages to retrieve
+ * @param[in] blocking  block if 1, don't block if 0
+ *
+ * @return  number of retrieved messages
+ */
+unsigned _mbox_get_many(mbox_t *mbox, msg_t *msgs, unsigned num,
+                        int blocking);
+
 /**
  * @brief Add message to mailbox
  *
@@ -159,6 +178,42 @@ static inline int mbox_try_get(mbox_t *mbox, msg_t *msg)
     return _mbox_get(mbox, msg, NON_BLOCKING);
 }
 
+/**
+ * @brief Get up to @p num messages from mailbox
+ *
+ * All queued messages (up to @p num) are taken in one critical section. If
+ * the mailbox is empty, this function will block until a message becomes
+ * available.
+ *
+ * @param[in] mbox  ptr to mailbox to operate on
+ * @param[in] msgs  ptr to storage for @p num retrieved messages
+ * @param[in] num   maximum number of messages to retrieve, must be > 0
+ *
+ * @return  number of retrieved messages, at least 1
+ */
+static inline unsigned mbox_get_many(mbox_t *mbox, msg_t *msgs, unsigned num)
+{
+    return _mbox_get_many(mbox, msgs, num, BLOCKING);
+}
+
+/**
+ * @brief Get up to @p num messages from mailbox
+ *
+ * All queued messages (up to @p num) are taken in one critical section. If
+ * the mailbox is empty, this function will return right away.
+ *
+ * @param[in] mbox  ptr to mailbox to operate on
+ * @param[in] msgs  ptr to storage for @p num retrieved messages
+ * @param[in] num   maximum number of messages to retrieve
+ *
+ * @return  number of retrieved messages
+ */
+static inline unsigned mbox_try_get_many(mbox_t *mbox, msg_t *msgs,
+                                         unsigned num)
+{
+    return _mbox_get_many(mbox, msgs, num, NON_BLOCKING);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -123,3 +123,49 @@ int _mbox_get(mbox_t *mbox, msg_t *msg, int blocking)
         return 0;
     }
 }
+
+unsigned _mbox_get_many(mbox_t *mbox, msg_t *msgs, unsigned num,
+                        int blocking)
+{
+    if (num == 0) {
+        return 0;
+    }
+
+    unsigned irqstate = irq_disable();
+    unsigned got = 0;
+
+    if (!cib_avail(&mbox->cib)) {
+        if (!blocking) {
+            irq_restore(irqstate);
+            return 0;
+        }
+        sched_active_thread->wait_data = (void *)msgs;
+        _wait(&mbox->readers, irqstate);
+        /* sender has copied message */
+        return 1;
+    }
+
+    /* each freed slot lets one blocked writer continue */
+    uint16_t process_priority = UINT16_MAX;
+    while ((got < num) && cib_avail(&mbox->cib)) {
+        msgs[got++] = mbox->msg_array[cib_get_unsafe(&mbox->cib)];
+        list_node_t *next = list_remove_head(&mbox->writers);
+        if (next) {
+            thread_t *thread = container_of((clist_node_t *)next, thread_t,
+                                            rq_entry);
+            sched_set_status(thread, STATUS_PENDING);
+            if (thread->priority < process_priority) {
+                process_priority = thread->priority;
+            }
+        }
+    }
+
+    DEBUG("mbox: Thread %" PRIkernel_pid " mbox 0x%08x: _get_many(): "
+          "got %u queued messages.\n", sched_active_pid, (unsigned)mbox, got);
+
+    irq_restore(irqstate);
+    if (process_priority != UINT16_MAX) {
+        sched_switch(process_priority);
+    }
+    return got;
+}
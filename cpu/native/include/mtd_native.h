@@ -12,6 +12,12 @@
  * @{
  * @brief       mtd flash emulation for native
  *
+ * The flash memory is emulated by a file that is mapped into memory, so it
+ * persists between runs. Like NOR flash, writing can only clear bits and
+ * erasing sets all bits of a sector. Optionally, the driver counts the erase
+ * cycles of every sector and stalls the calling thread for the time a page
+ * program or sector erase would take on real flash.
+ *
  * @file
  *
  * @author      Vincent Dupont <vincent@otakeys.com>
@@ -24,12 +30,18 @@
 extern "C" {
 #endif
 
+#include <stdint.h>
+
 #include "mtd.h"
 
 /** mtd native descriptor */
 typedef struct mtd_native_dev {
-    mtd_dev_t dev;      /**< mtd generic device */
-    const char *fname;  /**< filename to use for memory emulation */
+    mtd_dev_t dev;              /**< mtd generic device */
+    const char *fname;          /**< filename to use for memory emulation */
+    uint32_t *wear;             /**< erase counter per sector, may be NULL */
+    uint32_t write_latency_us;  /**< simulated time to program a page */
+    uint32_t erase_latency_us;  /**< simulated time to erase a sector */
+    uint8_t *mem;               /**< mapped file, set by init */
 } mtd_native_dev_t;
 
 /**
@@ -37,6 +49,24 @@ typedef struct mtd_native_dev {
  */
 extern const mtd_desc_t native_flash_driver;
 
+/**
+ * @brief   Get the number of erase cycles of a sector
+ *
+ * The board's `mtd0` counts erase cycles when built with `MTD_NATIVE_WEAR`
+ * set to 1.
+ *
+ * @param[in]   dev     native mtd device
+ * @param[in]   sector  sector to look up
+ *
+ * @returns     erase cycles of @p sector, 0 if @p dev does not count them
+ */
+static inline uint32_t mtd_native_wear(const mtd_dev_t *dev, uint32_t sector)
+{
+    const mtd_native_dev_t *_dev = (const mtd_native_dev_t *)dev;
+
+    return _dev->wear ? _dev->wear[sector] : 0;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -105,6 +105,7 @@ extern int (*real_execve)(const char *, char *const[], char *const[]);
 extern int (*real_feof)(FILE *stream);
 extern int (*real_ferror)(FILE *stream);
 extern int (*real_fork)(void);
+extern int (*real_ftruncate)(int fd, off_t length);
 /* The ... is a hack to save includes: */
 extern int (*real_getaddrinfo)(const char *node, ...);
 extern int (*real_getifaddrs)(struct ifaddrs **ifap);
@@ -112,6 +113,9 @@ extern int (*real_getpid)(void);
 extern int (*real_gettimeofday)(struct timeval *t, ...);
 extern int (*real_ioctl)(int fildes, int request, ...);
 extern int (*real_listen)(int socket, int backlog);
+extern off_t (*real_lseek)(int fd, off_t offset, int whence);
+extern void *(*real_mmap)(void *addr, size_t len, int prot, int flags, int fd,
+                          off_t offset);
 extern int (*real_open)(const char *path, int oflag, ...);
 extern int (*real_pause)(void);
 extern int (*real_pipe)(int[2]);
@@ -24,6 +24,7 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "net/netdev.h"
 
@@ -35,6 +36,18 @@ extern "C" {
 #include "net/if.h"
 #endif
 
+#ifndef NETDEV_TAP_RX_BATCH
+/**
+ * @brief   Maximum number of frames received per SIGIO wakeup
+ *
+ * The driver keeps signalling @ref NETDEV_EVENT_RX_COMPLETE from its ISR
+ * handler until the tap device is drained or this many frames were read.
+ * Only then is the next wakeup armed, so a burst of frames costs one
+ * wakeup instead of one per frame. Set to 1 for one frame per wakeup.
+ */
+#define NETDEV_TAP_RX_BATCH         (32U)
+#endif
+
 /**
  * @brief tap interface state
  */
@@ -44,6 +57,7 @@ typedef struct netdev_tap {
     int tap_fd;                         /**< host file descriptor for the TAP */
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     uint8_t promiscuous;                 /**< Flag for promiscuous mode */
+    bool rx_drained;                    /**< No frame left on last read */
 } netdev_tap_t;
 
 /**
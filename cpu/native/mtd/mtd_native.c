@@ -15,40 +15,80 @@
  * @author      Vincent Dupont <vincent@otakeys.com>
  */
 
-#include <stdio.h>
 #include <assert.h>
-#include <inttypes.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <unistd.h>
 
 #include "mtd.h"
 #include "mtd_native.h"
 
 #include "native_internal.h"
+#include "timex.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
+static size_t _mtd_size(const mtd_dev_t *dev)
+{
+    return dev->sector_count * dev->pages_per_sector * dev->page_size;
+}
+
+static void _stall(uint32_t us)
+{
+    /* real flash blocks the CPU while programming or erasing */
+    struct timeval start, now;
+
+    if (us == 0) {
+        return;
+    }
+    real_gettimeofday(&start, NULL);
+    do {
+        real_gettimeofday(&now, NULL);
+    } while ((uint64_t)(now.tv_sec - start.tv_sec) * US_PER_SEC
+             + now.tv_usec - start.tv_usec < us);
+}
+
 static int _init(mtd_dev_t *dev)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
+    size_t size = _mtd_size(dev);
 
     DEBUG("mtd_native: init, filename=%s\n", _dev->fname);
 
-    FILE *f = real_fopen(_dev->fname, "r");
+    if (_dev->mem) {
+        return 0;
+    }
 
-    if (!f) {
-        DEBUG("mtd_native: init: creating file %s\n", _dev->fname);
-        f = real_fopen(_dev->fname, "w+");
-        if (!f) {
-            return -EIO;
-        }
-        size_t size = dev->sector_count * dev->pages_per_sector * dev->page_size;
-        for (size_t i = 0; i < size; i++) {
-            real_fputc(0xff, f);
-        }
+    int fd = real_open(_dev->fname, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        return -EIO;
+    }
+
+    off_t old_size = real_lseek(fd, 0, SEEK_END);
+    if ((old_size < 0) ||
+        ((old_size < (off_t)size) && (real_ftruncate(fd, size) < 0))) {
+        real_close(fd);
+        return -EIO;
+    }
+
+    void *mem = real_mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                          fd, 0);
+    /* the mapping stays valid without the file descriptor */
+    real_close(fd);
+    if (mem == MAP_FAILED) {
+        return -EIO;
     }
+    _dev->mem = mem;
 
-    real_fclose(f);
+    if (old_size < (off_t)size) {
+        DEBUG("mtd_native: init: erasing new part of file %s\n", _dev->fname);
+        memset(_dev->mem + old_size, 0xff, size - old_size);
+    }
 
     return 0;
 }
@@ -56,21 +96,17 @@ static int _init(mtd_dev_t *dev)
 static int _read(mtd_dev_t *dev, void *buff, uint32_t addr, uint32_t size)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
-    size_t mtd_size = dev->sector_count * dev->pages_per_sector * dev->page_size;
 
     DEBUG("mtd_native: read from page %" PRIu32 " count %" PRIu32 "\n", addr, size);
 
-    if (addr + size > mtd_size) {
+    if (addr + size > _mtd_size(dev)) {
         return -EOVERFLOW;
     }
-
-    FILE *f = real_fopen(_dev->fname, "r");
-    if (!f) {
+    if (!_dev->mem) {
         return -EIO;
     }
-    real_fseek(f, addr, SEEK_SET);
-    size = real_fread(buff, 1, size, f);
-    real_fclose(f);
+
+    memcpy(buff, _dev->mem + addr, size);
 
     return size;
 }
@@ -78,28 +114,38 @@ static int _read(mtd_dev_t *dev, void *buff, uint32_t addr, uint32_t size)
 static int _write(mtd_dev_t *dev, const void *buff, uint32_t addr, uint32_t size)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
-    size_t mtd_size = dev->sector_count * dev->pages_per_sector * dev->page_size;
+    const uint8_t *src = buff;
+    uint8_t *dst;
 
     DEBUG("mtd_native: write from 0x%" PRIx32 " count %" PRIu32 "\n", addr, size);
 
-    if (addr + size > mtd_size) {
+    if (addr + size > _mtd_size(dev)) {
         return -EOVERFLOW;
     }
     if (((addr % dev->page_size) + size) > dev->page_size) {
         return -EOVERFLOW;
     }
-
-    FILE *f = real_fopen(_dev->fname, "r+");
-    if (!f) {
+    if (!_dev->mem) {
         return -EIO;
     }
-    real_fseek(f, addr, SEEK_SET);
-    for (size_t i = 0; i < size; i++) {
-        uint8_t c = real_fgetc(f);
-        real_fseek(f, -1, SEEK_CUR);
-        real_fputc(c & ((uint8_t*)buff)[i], f);
+
+    /* programming can only clear bits, so AND the data into the flash
+     * a word at a time once the destination is aligned */
+    dst = _dev->mem + addr;
+    uint32_t i = 0;
+    for (; (i < size) && ((uintptr_t)(dst + i) % sizeof(uintptr_t)); i++) {
+        dst[i] &= src[i];
+    }
+    for (; i + sizeof(uintptr_t) <= size; i += sizeof(uintptr_t)) {
+        uintptr_t word;
+        memcpy(&word, src + i, sizeof(word));
+        *(uintptr_t *)(dst + i) &= word;
     }
-    real_fclose(f);
+    for (; i < size; i++) {
+        dst[i] &= src[i];
+    }
+
+    _stall(_dev->write_latency_us);
 
     return size;
 }
@@ -107,27 +153,29 @@ static int _write(mtd_dev_t *dev, const void *buff, uint32_t addr, uint32_t size
 static int _erase(mtd_dev_t *dev, uint32_t addr, uint32_t size)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
-    size_t mtd_size = dev->sector_count * dev->pages_per_sector * dev->page_size;
     size_t sector_size = dev->pages_per_sector * dev->page_size;
 
     DEBUG("mtd_native: erase from sector %" PRIu32 " count %" PRIu32 "\n", addr, size);
 
-    if (addr + size > mtd_size) {
+    if (addr + size > _mtd_size(dev)) {
         return -EOVERFLOW;
     }
     if (((addr % sector_size) != 0) || ((size % sector_size) != 0)) {
         return -EOVERFLOW;
     }
-
-    FILE *f = real_fopen(_dev->fname, "r+");
-    if (!f) {
+    if (!_dev->mem) {
         return -EIO;
     }
-    real_fseek(f, addr, SEEK_SET);
-    for (size_t i = 0; i < size; i++) {
-        real_fputc(0xff, f);
+
+    memset(_dev->mem + addr, 0xff, size);
+
+    for (uint32_t sector = addr / sector_size;
+         sector < (addr + size) / sector_size; sector++) {
+        if (_dev->wear) {
+            _dev->wear[sector]++;
+        }
+        _stall(_dev->erase_latency_us);
     }
-    real_fclose(f);
 
     return 0;
 }
@@ -67,6 +67,8 @@
 /* netdev interface */
 static int _init(netdev_t *netdev);
 static int _send(netdev_t *netdev, const iolist_t *iolist);
+static int _send_batch(netdev_t *netdev, const iolist_t *const frames[],
+                       unsigned num);
 static int _recv(netdev_t *netdev, void *buf, size_t n, void *info);
 
 static inline void _get_mac_addr(netdev_t *netdev, uint8_t *dst)
@@ -94,10 +96,27 @@ static inline int _set_promiscous(netdev_t *netdev, int value)
     return value;
 }
 
+static bool _rx_pending(netdev_tap_t *dev);
+static void _continue_reading(netdev_tap_t *dev);
+
 static inline void _isr(netdev_t *netdev)
 {
+    netdev_tap_t *dev = (netdev_tap_t*)netdev;
+
     if (netdev->event_callback) {
-        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+        /* receive until the device is drained, so a burst of frames only
+         * costs a single wakeup */
+        for (unsigned i = 0; i < NETDEV_TAP_RX_BATCH; i++) {
+            dev->rx_drained = false;
+            netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+            if (dev->rx_drained || !_rx_pending(dev)) {
+                /* the next frame will raise SIGIO again */
+                native_async_read_continue(dev->tap_fd);
+                return;
+            }
+        }
+        /* batch limit reached, check if frames are still pending */
+        _continue_reading(dev);
     }
 #if DEVELHELP
     else {
@@ -162,6 +181,7 @@ static const netdev_driver_t netdev_driver_tap = {
     .isr = _isr,
     .get = _get,
     .set = _set,
+    .send_batch = _send_batch,
 };
 
 /* driver implementation */
@@ -177,6 +197,21 @@ static inline bool _is_addr_multicast(uint8_t *addr)
     return (addr[0] & 0x01);
 }
 
+static bool _rx_pending(netdev_tap_t *dev)
+{
+    fd_set rfds;
+    struct timeval t;
+    memset(&t, 0, sizeof(t));
+    FD_ZERO(&rfds);
+    FD_SET(dev->tap_fd, &rfds);
+
+    _native_in_syscall++; /* no switching here */
+    bool res = (real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1);
+    _native_in_syscall--;
+
+    return res;
+}
+
 static void _continue_reading(netdev_tap_t *dev)
 {
     /* work around lost signals */
@@ -224,9 +259,9 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 
             static uint8_t nullbuf[ETHERNET_FRAME_LEN];
 
-            real_read(dev->tap_fd, nullbuf, sizeof(nullbuf));
-
-            _continue_reading(dev);
+            if (real_read(dev->tap_fd, nullbuf, sizeof(nullbuf)) < 0) {
+                dev->rx_drained = true;
+            }
         }
 
         /* no way of figuring out packet size without racey buffering,
@@ -247,17 +282,14 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
                   hdr->dst[0], hdr->dst[1], hdr->dst[2],
                   hdr->dst[3], hdr->dst[4], hdr->dst[5]);
 
-            native_async_read_continue(dev->tap_fd);
-
             return 0;
         }
 
-        _continue_reading(dev);
-
         return nread;
     }
     else if (nread == -1) {
         if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            dev->rx_drained = true;
         }
         else {
             err(EXIT_FAILURE, "netdev_tap: read");
@@ -265,6 +297,7 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     }
     else if (nread == 0) {
         DEBUG("_native_handle_tap_input: ignoring null-event\n");
+        dev->rx_drained = true;
     }
     else {
         errx(EXIT_FAILURE, "internal error _rx_event");
@@ -290,6 +323,40 @@ static int _send(netdev_t *netdev, const iolist_t *iolist)
     return res;
 }
 
+static int _send_batch(netdev_t *netdev, const iolist_t *const frames[],
+                       unsigned num)
+{
+    netdev_tap_t *dev = (netdev_tap_t*)netdev;
+    unsigned sent;
+    int res = 0;
+
+    /* the tap device takes one frame per write, but there is no need to leave
+     * the syscall section in between */
+    _native_syscall_enter();
+    for (sent = 0; sent < num; sent++) {
+        struct iovec iov[iolist_count(frames[sent])];
+        unsigned n;
+
+        iolist_to_iovec(frames[sent], iov, &n);
+        ssize_t nwrite = real_writev(dev->tap_fd, iov, n);
+        if (nwrite < 0) {
+            if (sent == 0) {
+                res = -errno;
+            }
+            break;
+        }
+        res += nwrite;
+    }
+    _native_syscall_leave();
+
+    if (netdev->event_callback) {
+        for (unsigned i = 0; i < sent; i++) {
+            netdev->event_callback(netdev, NETDEV_EVENT_TX_COMPLETE);
+        }
+    }
+    return res;
+}
+
 void netdev_tap_setup(netdev_tap_t *dev, const netdev_tap_params_t *params) {
     dev->netdev.driver = &netdev_driver_tap;
     strncpy(dev->tap_name, *(params->tap_name), IFNAMSIZ - 1);
@@ -333,6 +400,7 @@ static int _init(netdev_t *netdev)
 #endif
     /* initialize device descriptor */
     dev->promiscuous = 0;
+    dev->rx_drained = true;
     /* implicitly create the tap interface */
     if ((dev->tap_fd = real_open(clonedev, O_RDWR | O_NONBLOCK)) == -1) {
         err(EXIT_FAILURE, "open(%s)", clonedev);
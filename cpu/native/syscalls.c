@@ -77,7 +77,11 @@ int (*real_execve)(const char *, char *const[], char *const[]);
 int (*real_fork)(void);
 int (*real_feof)(FILE *stream);
 int (*real_ferror)(FILE *stream);
+int (*real_ftruncate)(int fd, off_t length);
 int (*real_listen)(int socket, int backlog);
+off_t (*real_lseek)(int fd, off_t offset, int whence);
+void *(*real_mmap)(void *addr, size_t len, int prot, int flags, int fd,
+                   off_t offset);
 int (*real_ioctl)(int fildes, int request, ...);
 int (*real_open)(const char *path, int oflag, ...);
 int (*real_pause)(void);
@@ -460,6 +464,7 @@ void _native_init_syscalls(void)
     *(void **)(&real_fcntl) = dlsym(RTLD_NEXT, "fcntl");
     *(void **)(&real_creat) = dlsym(RTLD_NEXT, "creat");
     *(void **)(&real_fork) = dlsym(RTLD_NEXT, "fork");
+    *(void **)(&real_ftruncate) = dlsym(RTLD_NEXT, "ftruncate");
     *(void **)(&real_dup2) = dlsym(RTLD_NEXT, "dup2");
     *(void **)(&real_select) = dlsym(RTLD_NEXT, "select");
     *(void **)(&real_setitimer) = dlsym(RTLD_NEXT, "setitimer");
@@ -471,6 +476,8 @@ void _native_init_syscalls(void)
     *(void **)(&real_execve) = dlsym(RTLD_NEXT, "execve");
     *(void **)(&real_ioctl) = dlsym(RTLD_NEXT, "ioctl");
     *(void **)(&real_listen) = dlsym(RTLD_NEXT, "listen");
+    *(void **)(&real_lseek) = dlsym(RTLD_NEXT, "lseek");
+    *(void **)(&real_mmap) = dlsym(RTLD_NEXT, "mmap");
     *(void **)(&real_open) = dlsym(RTLD_NEXT, "open");
     *(void **)(&real_pause) = dlsym(RTLD_NEXT, "pause");
     *(void **)(&real_fopen) = dlsym(RTLD_NEXT, "fopen");
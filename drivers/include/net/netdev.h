@@ -427,6 +427,26 @@ typedef struct netdev_driver {
      */
     int (*set)(netdev_t *dev, netopt_t opt,
                const void *value, size_t value_len);
+
+    /**
+     * @brief   Send multiple frames at once
+     *
+     * @pre `(dev != NULL) && (frames != NULL) && (num > 0)`
+     *
+     * Equivalent to calling netdev_driver_t::send() for each of @p frames in
+     * order, but allows the driver to hand them to the device in one go.
+     * Optional, leave NULL if not supported.
+     *
+     * @param[in] dev       Network device descriptor. Must not be NULL.
+     * @param[in] frames    IO vector lists of the frames to send, with the
+     *                      same restrictions as for netdev_driver_t::send().
+     * @param[in] num       Number of frames in @p frames.
+     *
+     * @return negative errno if not even the first frame could be sent
+     * @return number of bytes sent, summed up over all sent frames
+     */
+    int (*send_batch)(netdev_t *dev, const iolist_t *const frames[],
+                      unsigned num);
 } netdev_driver_t;
 
 /**
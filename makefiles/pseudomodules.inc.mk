@@ -30,6 +30,7 @@ PSEUDOMODULES += gnrc_ipv6_nib_router
 PSEUDOMODULES += gnrc_netdev_default
 PSEUDOMODULES += gnrc_neterr
 PSEUDOMODULES += gnrc_netapi_callbacks
+PSEUDOMODULES += gnrc_netapi_direct
 PSEUDOMODULES += gnrc_netapi_mbox
 PSEUDOMODULES += gnrc_pktbuf_cmd
 PSEUDOMODULES += gnrc_netif_cmd_%
@@ -65,6 +66,7 @@ PSEUDOMODULES += netstats
 PSEUDOMODULES += netstats_l2
 PSEUDOMODULES += netstats_ipv6
 PSEUDOMODULES += netstats_rpl
+PSEUDOMODULES += netstats_ext
 PSEUDOMODULES += nimble
 PSEUDOMODULES += nimble_autoconn_%
 PSEUDOMODULES += newlib
@@ -39,4 +39,43 @@ uint8_t crc8(const uint8_t *data, size_t len, uint8_t g_polynom, uint8_t crc)
     return crc;
 }
 
+void crc8_table_init(crc8_table_t *table, uint8_t poly)
+{
+    for (unsigned i = 0; i < 256; i++) {
+        uint8_t byte = i;
+
+        table->table[0][i] = crc8(&byte, 1, poly, 0);
+    }
+    /* table k holds the CRC of a byte followed by k zero bytes */
+    for (unsigned k = 1; k < CONFIG_CRC8_TABLE_SLICES; k++) {
+        for (unsigned i = 0; i < 256; i++) {
+            table->table[k][i] = table->table[0][table->table[k - 1][i]];
+        }
+    }
+}
+
+uint8_t crc8_table_calc(const crc8_table_t *table, const uint8_t *data,
+                        size_t len, uint8_t crc)
+{
+    const uint8_t (*t)[256] = table->table;
+
+#if CONFIG_CRC8_TABLE_SLICES > 1
+    while (len >= CONFIG_CRC8_TABLE_SLICES) {
+        uint8_t next = t[CONFIG_CRC8_TABLE_SLICES - 1][crc ^ data[0]];
+
+        for (unsigned i = 1; i < CONFIG_CRC8_TABLE_SLICES; i++) {
+            next ^= t[CONFIG_CRC8_TABLE_SLICES - 1 - i][data[i]];
+        }
+        crc = next;
+        data += CONFIG_CRC8_TABLE_SLICES;
+        len -= CONFIG_CRC8_TABLE_SLICES;
+    }
+#endif
+    for (size_t i = 0; i < len; i++) {
+        crc = t[0][crc ^ data[i]];
+    }
+
+    return crc;
+}
+
 /** @} */
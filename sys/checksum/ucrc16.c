@@ -50,4 +50,91 @@ uint16_t ucrc16_calc_le(const uint8_t *buf, size_t len, uint16_t poly,
     return seed;
 }
 
+void ucrc16_table_init_be(ucrc16_table_t *table, uint16_t poly)
+{
+    assert(table != NULL);
+    for (unsigned i = 0; i < 256; i++) {
+        uint8_t byte = i;
+
+        table->table[0][i] = ucrc16_calc_be(&byte, 1, poly, 0);
+    }
+    /* table k holds the CRC of a byte followed by k zero bytes */
+    for (unsigned k = 1; k < CONFIG_UCRC16_TABLE_SLICES; k++) {
+        for (unsigned i = 0; i < 256; i++) {
+            uint16_t prev = table->table[k - 1][i];
+
+            table->table[k][i] = (prev << 8) ^ table->table[0][prev >> 8];
+        }
+    }
+}
+
+void ucrc16_table_init_le(ucrc16_table_t *table, uint16_t poly)
+{
+    assert(table != NULL);
+    for (unsigned i = 0; i < 256; i++) {
+        uint8_t byte = i;
+
+        table->table[0][i] = ucrc16_calc_le(&byte, 1, poly, 0);
+    }
+    for (unsigned k = 1; k < CONFIG_UCRC16_TABLE_SLICES; k++) {
+        for (unsigned i = 0; i < 256; i++) {
+            uint16_t prev = table->table[k - 1][i];
+
+            table->table[k][i] = (prev >> 8) ^ table->table[0][prev & 0xff];
+        }
+    }
+}
+
+uint16_t ucrc16_table_calc_be(const ucrc16_table_t *table, const uint8_t *buf,
+                              size_t len, uint16_t seed)
+{
+    const uint16_t (*t)[256] = table->table;
+
+    assert(buf != NULL);
+#if CONFIG_UCRC16_TABLE_SLICES > 1
+    while (len >= CONFIG_UCRC16_TABLE_SLICES) {
+        /* the CRC overlaps the first two bytes of the slice, every other byte
+         * only needs to be shifted through the remaining bytes */
+        uint16_t crc = t[CONFIG_UCRC16_TABLE_SLICES - 1][(seed >> 8) ^ buf[0]] ^
+                       t[CONFIG_UCRC16_TABLE_SLICES - 2][(seed & 0xff) ^ buf[1]];
+
+        for (unsigned i = 2; i < CONFIG_UCRC16_TABLE_SLICES; i++) {
+            crc ^= t[CONFIG_UCRC16_TABLE_SLICES - 1 - i][buf[i]];
+        }
+        seed = crc;
+        buf += CONFIG_UCRC16_TABLE_SLICES;
+        len -= CONFIG_UCRC16_TABLE_SLICES;
+    }
+#endif
+    for (; len > 0; len--, buf++) {
+        seed = (seed << 8) ^ t[0][(seed >> 8) ^ *buf];
+    }
+    return seed;
+}
+
+uint16_t ucrc16_table_calc_le(const ucrc16_table_t *table, const uint8_t *buf,
+                              size_t len, uint16_t seed)
+{
+    const uint16_t (*t)[256] = table->table;
+
+    assert(buf != NULL);
+#if CONFIG_UCRC16_TABLE_SLICES > 1
+    while (len >= CONFIG_UCRC16_TABLE_SLICES) {
+        uint16_t crc = t[CONFIG_UCRC16_TABLE_SLICES - 1][(seed & 0xff) ^ buf[0]] ^
+                       t[CONFIG_UCRC16_TABLE_SLICES - 2][(seed >> 8) ^ buf[1]];
+
+        for (unsigned i = 2; i < CONFIG_UCRC16_TABLE_SLICES; i++) {
+            crc ^= t[CONFIG_UCRC16_TABLE_SLICES - 1 - i][buf[i]];
+        }
+        seed = crc;
+        buf += CONFIG_UCRC16_TABLE_SLICES;
+        len -= CONFIG_UCRC16_TABLE_SLICES;
+    }
+#endif
+    for (; len > 0; len--, buf++) {
+        seed = (seed >> 8) ^ t[0][(seed ^ *buf) & 0xff];
+    }
+    return seed;
+}
+
 /** @} */
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp11-compat
+ * @{
+ *
+ * @file
+ * @brief   Typed message channel on top of core mailboxes
+ *
+ * A channel transfers objects of a single type `T` between threads. Objects
+ * are constructed in one of `Size` slots owned by the channel and only a
+ * pointer to the slot is passed through an @ref mbox_t, so objects of any
+ * size are transferred without copying them. The receiver owns the object
+ * until the handle returned by the channel is destroyed, which puts the
+ * slot back into the pool of free slots. The free slots are kept in a
+ * second mailbox, so a sender blocks while all slots are in use.
+ *
+ * As the type of the transferred object is fixed by the channel, there is
+ * no need to dispatch on @ref msg_t::type at runtime.
+ *
+ * @note    Requires the `core_mbox` module.
+ *
+ * @}
+ */
+
+#ifndef RIOT_CHANNEL_HPP
+#define RIOT_CHANNEL_HPP
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "mbox.h"
+
+namespace riot {
+
+/**
+ * @brief   Channel transferring ownership of objects of type `T` between
+ *          threads
+ *
+ * @tparam T     Type of the transferred objects.
+ * @tparam Size  Number of objects in transfer at once, must be a power of
+ *               two.
+ */
+template <class T, unsigned Size>
+class channel {
+  static_assert(Size > 0 && (Size & (Size - 1)) == 0,
+                "Size of a channel must be a power of two");
+
+  /**
+   * @brief Destroys an object and puts its slot back into the pool.
+   */
+  struct slot_deleter {
+    channel* owner; /**< channel owning the slot */
+    /**
+     * @brief Called by the handle to release the object.
+     */
+    void operator()(T* ptr) const {
+      ptr->~T();
+      owner->put_slot(ptr);
+    }
+  };
+
+public:
+  /**
+   * @brief Type of the transferred objects.
+   */
+  using value_type = T;
+
+  /**
+   * @brief Owning pointer to a received object.
+   */
+  using handle = std::unique_ptr<T, slot_deleter>;
+
+  /**
+   * @brief Creates an empty channel with all slots free.
+   */
+  channel() {
+    mbox_init(&m_mbox, m_queue, Size);
+    mbox_init(&m_free, m_free_queue, Size);
+    for (unsigned i = 0; i < Size; i++) {
+      msg_t m;
+      m.content.ptr = &m_slots[i];
+      mbox_put(&m_free, &m);
+    }
+  }
+
+  /**
+   * @brief Destroys all objects that were sent but not received.
+   * @note  All handles must be destroyed before the channel.
+   */
+  ~channel() {
+    msg_t m;
+    while (mbox_try_get(&m_mbox, &m)) {
+      static_cast<T*>(m.content.ptr)->~T();
+    }
+  }
+
+  /**
+   * @brief Disallow copy constructor.
+   */
+  channel(const channel&) = delete;
+
+  /**
+   * @brief Disallow copy assignment operator.
+   */
+  channel& operator=(const channel&) = delete;
+
+  /**
+   * @brief Constructs an object in a free slot and sends it. Blocks until
+   *        a slot becomes free.
+   * @param[in] args  Arguments passed to the constructor of `T`.
+   */
+  template <class... Args>
+  void emplace(Args&&... args) {
+    msg_t m;
+    mbox_get(&m_free, &m);
+    send_slot(m, std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief Constructs an object in a free slot and sends it, if a slot is
+   *        free.
+   * @param[in] args  Arguments passed to the constructor of `T`.
+   * @return `true` if the object was sent, `false` if no slot was free.
+   */
+  template <class... Args>
+  bool try_emplace(Args&&... args) {
+    msg_t m;
+    if (!mbox_try_get(&m_free, &m)) {
+      return false;
+    }
+    send_slot(m, std::forward<Args>(args)...);
+    return true;
+  }
+
+  /**
+   * @brief Sends an object. Blocks until a slot becomes free.
+   */
+  inline void send(T&& value) { emplace(std::move(value)); }
+
+  /**
+   * @brief Sends a copy of an object. Blocks until a slot becomes free.
+   */
+  inline void send(const T& value) { emplace(value); }
+
+  /**
+   * @brief Receives an object. Blocks until an object becomes available.
+   */
+  handle receive() {
+    msg_t m;
+    mbox_get(&m_mbox, &m);
+    return make_handle(m);
+  }
+
+  /**
+   * @brief Receives an object, if one is available.
+   * @return A handle to the object, or an empty handle.
+   */
+  handle try_receive() {
+    msg_t m;
+    if (!mbox_try_get(&m_mbox, &m)) {
+      return handle{nullptr, slot_deleter{this}};
+    }
+    return make_handle(m);
+  }
+
+  /**
+   * @brief Receives up to @p num objects. Blocks until at least one object
+   *        becomes available.
+   *
+   * All available objects are taken from the mailbox at once, so a burst of
+   * objects costs a single critical section.
+   *
+   * @param[out] out  Storage for @p num handles.
+   * @param[in]  num  Maximum number of objects to receive.
+   * @return Number of received objects.
+   */
+  unsigned receive_many(handle* out, unsigned num) {
+    msg_t msgs[Size];
+    if (num > Size) {
+      num = Size;
+    }
+    unsigned got = mbox_get_many(&m_mbox, msgs, num);
+    for (unsigned i = 0; i < got; i++) {
+      out[i] = make_handle(msgs[i]);
+    }
+    return got;
+  }
+
+  /**
+   * @brief Returns the maximum number of objects in transfer at once.
+   */
+  static constexpr unsigned size() noexcept { return Size; }
+
+private:
+  template <class... Args>
+  void send_slot(msg_t& m, Args&&... args) {
+    try {
+      new (m.content.ptr) T(std::forward<Args>(args)...);
+    }
+    catch (...) {
+      mbox_put(&m_free, &m);
+      throw;
+    }
+    mbox_put(&m_mbox, &m);
+  }
+
+  handle make_handle(const msg_t& m) {
+    return handle{static_cast<T*>(m.content.ptr), slot_deleter{this}};
+  }
+
+  void put_slot(T* ptr) {
+    msg_t m;
+    m.content.ptr = ptr;
+    mbox_put(&m_free, &m);
+  }
+
+  mbox_t m_mbox;
+  mbox_t m_free;
+  msg_t m_queue[Size];
+  msg_t m_free_queue[Size];
+  typename std::aligned_storage<sizeof(T), alignof(T)>::type m_slots[Size];
+};
+
+} // namespace riot
+
+#endif // RIOT_CHANNEL_HPP
@@ -0,0 +1,423 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp11-compat
+ * @{
+ *
+ * @file
+ * @brief   C++11 future and promise drop in replacement
+ * @see     <a href="http://en.cppreference.com/w/cpp/thread/future">
+ *            std::future, std::promise
+ *          </a>
+ *
+ * The shared state of a promise and its future is reference counted
+ * manually, like riot::thread_data, as the reference count of
+ * std::shared_ptr is not thread-safe without gthreads.
+ *
+ * @}
+ */
+
+#ifndef RIOT_FUTURE_HPP
+#define RIOT_FUTURE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <new>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "mutex.h"
+#include "timex.h"
+#include "xtimer.h"
+
+#include "riot/chrono.hpp"
+
+namespace riot {
+
+/**
+ * @brief Status for timeout-based waits on a future.
+ */
+enum class future_status {
+  ready,
+  timeout
+};
+
+template <class T>
+class future;
+
+template <class T>
+class promise;
+
+namespace detail {
+
+/**
+ * @brief Part of the shared state of a promise and a future that does not
+ *        depend on the type of the value.
+ *
+ * The state is ready when @ref m_ready is unlocked. A waiting thread locks
+ * and unlocks it, which wakes up the next waiting thread, if any. Compared
+ * to a condition variable, this takes less lock operations per value.
+ */
+class future_state_base {
+public:
+  /** @cond INTERNAL */
+  future_state_base() : m_refs{2}, m_has_value{false} {
+    m_satisfied.clear();
+  }
+
+  void wait() {
+    mutex_lock(&m_ready);
+    mutex_unlock(&m_ready);
+  }
+
+  bool wait_until(const time_point& timeout_time) {
+    timex_t before;
+    xtimer_now_timex(&before);
+    if (timex_cmp(timeout_time.native_handle(), before) <= 0) {
+      if (!mutex_trylock(&m_ready)) {
+        return false;
+      }
+    }
+    else if (xtimer_mutex_lock_timeout(&m_ready, timex_uint64(
+      timex_sub(timeout_time.native_handle(), before))) != 0) {
+      return false;
+    }
+    mutex_unlock(&m_ready);
+    return true;
+  }
+
+  void set_exception(std::exception_ptr error) {
+    check_unset();
+    m_error = std::move(error);
+    make_ready();
+  }
+
+  void set_broken() {
+    if (!m_satisfied.test_and_set()) {
+      m_error = std::make_exception_ptr(std::system_error(
+        std::make_error_code(std::errc::broken_pipe), "Broken promise."));
+      make_ready();
+    }
+  }
+
+protected:
+  void check_unset() {
+    if (m_satisfied.test_and_set()) {
+      throw std::system_error(
+        std::make_error_code(std::errc::operation_not_permitted),
+        "Promise already satisfied.");
+    }
+  }
+
+  void make_ready() { mutex_unlock(&m_ready); }
+
+  void rethrow_error() {
+    if (m_error) {
+      std::rethrow_exception(m_error);
+    }
+  }
+
+  std::atomic<unsigned> m_refs;
+  std::atomic_flag m_satisfied;
+  mutex_t m_ready = MUTEX_INIT_LOCKED;
+  bool m_has_value;
+  std::exception_ptr m_error;
+  /** @endcond */
+};
+
+/**
+ * @brief Shared state of a promise and a future, storing the value.
+ */
+template <class T>
+class future_state : public future_state_base {
+public:
+  /** @cond INTERNAL */
+  ~future_state() {
+    if (m_has_value) {
+      value().~T();
+    }
+  }
+
+  void release() {
+    if (--m_refs == 0) {
+      delete this;
+    }
+  }
+
+  template <class... Args>
+  void set_value(Args&&... args) {
+    check_unset();
+    try {
+      new (&m_storage) T(std::forward<Args>(args)...);
+    }
+    catch (...) {
+      m_error = std::current_exception();
+      make_ready();
+      throw;
+    }
+    m_has_value = true;
+    make_ready();
+  }
+
+  T get() {
+    wait();
+    rethrow_error();
+    return std::move(value());
+  }
+
+private:
+  T& value() { return *reinterpret_cast<T*>(&m_storage); }
+
+  typename std::aligned_storage<sizeof(T), alignof(T)>::type m_storage;
+  /** @endcond */
+};
+
+/**
+ * @brief Shared state of a promise and a future without a value.
+ */
+template <>
+class future_state<void> : public future_state_base {
+public:
+  /** @cond INTERNAL */
+  void release() {
+    if (--m_refs == 0) {
+      delete this;
+    }
+  }
+
+  void set_value() {
+    check_unset();
+    make_ready();
+  }
+
+  void get() {
+    wait();
+    rethrow_error();
+  }
+  /** @endcond */
+};
+
+/**
+ * @brief Releases a reference to a shared state.
+ */
+struct future_state_deleter {
+  /**
+   * @brief Called by the promise or future to give up its share.
+   */
+  template <class T>
+  void operator()(future_state<T>* ptr) {
+    ptr->release();
+  }
+};
+
+/**
+ * @brief Throws the error of using a future or promise without shared state.
+ */
+[[noreturn]] inline void throw_no_state() {
+  throw std::system_error(std::make_error_code(std::errc::invalid_argument),
+                          "No associated state.");
+}
+
+} // namespace detail
+
+/**
+ * @brief   C++11 compliant implementation of future, however uses the time
+ *          point from our chrono header instead of the specified one
+ * @see     <a href="http://en.cppreference.com/w/cpp/thread/future">
+ *            std::future
+ *          </a>
+ */
+template <class T>
+class future {
+  friend class promise<T>;
+
+public:
+  /**
+   * @brief Creates a future without shared state.
+   */
+  inline future() noexcept = default;
+
+  /**
+   * @brief Move constructor.
+   */
+  inline future(future&& other) noexcept = default;
+
+  /**
+   * @brief Move assignment operator.
+   */
+  inline future& operator=(future&& other) noexcept = default;
+
+  /**
+   * @brief Disallow copy constructor.
+   */
+  future(const future&) = delete;
+
+  /**
+   * @brief Disallow copy assignment operator.
+   */
+  future& operator=(const future&) = delete;
+
+  /**
+   * @brief Query if the future has a shared state.
+   */
+  inline bool valid() const noexcept { return m_state != nullptr; }
+
+  /**
+   * @brief Block until the value is available and return it. Rethrows the
+   *        exception stored by the promise instead. The future has no shared
+   *        state afterwards.
+   */
+  T get() {
+    if (!valid()) {
+      detail::throw_no_state();
+    }
+    auto state = std::move(m_state);
+    return state->get();
+  }
+
+  /**
+   * @brief Block until the value is available.
+   */
+  void wait() const {
+    if (!valid()) {
+      detail::throw_no_state();
+    }
+    m_state->wait();
+  }
+
+  /**
+   * @brief Block until the value is available or a specified point in time
+   *        is reached.
+   * @param timeout_time  Point in time to stop waiting at.
+   * @return A status to signify if the value is available.
+   */
+  future_status wait_until(const time_point& timeout_time) const {
+    if (!valid()) {
+      detail::throw_no_state();
+    }
+    return m_state->wait_until(timeout_time) ? future_status::ready
+                                             : future_status::timeout;
+  }
+
+  /**
+   * @brief Block until the value is available or when the thread has been
+   *        blocked for a certain time.
+   * @param rel_time  The maximum time spent blocking.
+   * @return A status to signify if the value is available.
+   */
+  template <class Rep, class Period>
+  future_status wait_for(const std::chrono::duration<Rep, Period>& rel_time)
+    const {
+    time_point timeout_time = now();
+    timeout_time += rel_time;
+    return wait_until(timeout_time);
+  }
+
+private:
+  explicit inline future(detail::future_state<T>* state) : m_state{state} {}
+
+  std::unique_ptr<detail::future_state<T>, detail::future_state_deleter>
+    m_state;
+};
+
+/**
+ * @brief   C++11 compliant implementation of promise
+ * @see     <a href="http://en.cppreference.com/w/cpp/thread/promise">
+ *            std::promise
+ *          </a>
+ */
+template <class T>
+class promise {
+public:
+  /**
+   * @brief Creates a promise with a new shared state.
+   */
+  inline promise() : m_state{new detail::future_state<T>},
+                     m_future_taken{false} {}
+
+  /**
+   * @brief Move constructor.
+   */
+  inline promise(promise&& other) noexcept = default;
+
+  /**
+   * @brief Stores an exception about the broken promise if no value was set.
+   */
+  ~promise() {
+    if (m_state) {
+      m_state->set_broken();
+      if (!m_future_taken) {
+        // the future never took its share
+        m_state->release();
+      }
+    }
+  }
+
+  /**
+   * @brief Disallow copy constructor.
+   */
+  promise(const promise&) = delete;
+
+  /**
+   * @brief Disallow copy assignment operator.
+   */
+  promise& operator=(const promise&) = delete;
+
+  /**
+   * @brief Returns the future sharing the state of this promise. May only be
+   *        called once.
+   */
+  future<T> get_future() {
+    if (!m_state) {
+      detail::throw_no_state();
+    }
+    if (m_future_taken) {
+      throw std::system_error(
+        std::make_error_code(std::errc::operation_not_permitted),
+        "Future already retrieved.");
+    }
+    m_future_taken = true;
+    return future<T>{m_state.get()};
+  }
+
+  /**
+   * @brief Stores a value and makes the future ready.
+   * @param args  Nothing for `promise<void>`, the value otherwise.
+   */
+  template <class... Args>
+  void set_value(Args&&... args) {
+    if (!m_state) {
+      detail::throw_no_state();
+    }
+    m_state->set_value(std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief Stores an exception and makes the future ready.
+   * @param error  The exception to rethrow from future::get().
+   */
+  void set_exception(std::exception_ptr error) {
+    if (!m_state) {
+      detail::throw_no_state();
+    }
+    m_state->set_exception(std::move(error));
+  }
+
+private:
+  std::unique_ptr<detail::future_state<T>, detail::future_state_deleter>
+    m_state;
+  bool m_future_taken;
+};
+
+} // namespace riot
+
+#endif // RIOT_FUTURE_HPP
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp11-compat
+ * @{
+ *
+ * @file
+ * @brief   Thread pool running tasks on a fixed set of worker threads
+ *
+ * Every worker owns a deque of tasks. Tasks submitted by a worker are put
+ * into its own deque and taken from its back, tasks submitted by other
+ * threads are put into a queue shared by all workers. An idle worker takes
+ * a task from its own deque first, then from the shared queue and steals
+ * from the front of the deques of the other workers last. As RIOT runs one
+ * thread at a time, all queues are protected by a single mutex, which keeps
+ * the number of lock operations per task low.
+ *
+ * @}
+ */
+
+#ifndef RIOT_THREAD_POOL_HPP
+#define RIOT_THREAD_POOL_HPP
+
+#include <deque>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "riot/mutex.hpp"
+#include "riot/thread.hpp"
+#include "riot/future.hpp"
+#include "riot/condition_variable.hpp"
+
+#include "riot/detail/thread_util.hpp"
+
+namespace riot {
+
+namespace detail {
+
+/**
+ * @brief A task run by a thread pool.
+ */
+class pool_task {
+public:
+  virtual ~pool_task() {}
+  /**
+   * @brief Runs the task, exceptions are not passed on.
+   */
+  virtual void run() noexcept = 0;
+};
+
+/**
+ * @brief A task running a functor without result.
+ */
+template <class F>
+class pool_task_impl : public pool_task {
+public:
+  /** @cond INTERNAL */
+  explicit pool_task_impl(F&& f) : m_fun{std::move(f)} {}
+
+  void run() noexcept override {
+    try {
+      m_fun();
+    }
+    catch (...) {
+      // nop
+    }
+  }
+
+private:
+  F m_fun;
+  /** @endcond */
+};
+
+/**
+ * @brief The result of calling `F` with the arguments stored by a task.
+ */
+template <class F, class... Args>
+using pool_result_t = typename std::result_of<
+  typename std::decay<F>::type&(typename std::decay<Args>::type&...)>::type;
+
+/** @cond INTERNAL */
+template <class R, class F, long... Is, class Tuple>
+void fulfill(promise<R>& p, F& f, int_list<Is...> indices, Tuple& args) {
+  p.set_value(apply_args(f, indices, args));
+}
+
+template <class F, long... Is, class Tuple>
+void fulfill(promise<void>& p, F& f, int_list<Is...> indices, Tuple& args) {
+  apply_args(f, indices, args);
+  p.set_value();
+}
+/** @endcond */
+
+/**
+ * @brief A task fulfilling a promise with the result of a functor.
+ */
+template <class F, class... Args>
+class async_task : public pool_task {
+public:
+  /** @cond INTERNAL */
+  using result_type = pool_result_t<F, Args...>;
+
+  async_task(promise<result_type>&& p, F&& f, Args&&... args)
+      : m_promise{std::move(p)},
+        m_fun{std::forward<F>(f)},
+        m_args{std::forward<Args>(args)...} {
+    // nop
+  }
+
+  void run() noexcept override {
+    try {
+      fulfill(m_promise, m_fun, get_indices<sizeof...(Args)>(), m_args);
+    }
+    catch (...) {
+      m_promise.set_exception(std::current_exception());
+    }
+  }
+
+private:
+  promise<result_type> m_promise;
+  typename std::decay<F>::type m_fun;
+  std::tuple<typename std::decay<Args>::type...> m_args;
+  /** @endcond */
+};
+
+} // namespace detail
+
+/**
+ * @brief   Runs tasks on a fixed set of worker threads, so submitting a task
+ *          does not create a thread
+ */
+class thread_pool {
+public:
+  /**
+   * @brief Creates the worker threads of the pool.
+   * @param[in] num_workers   Number of worker threads, at least one.
+   */
+  explicit thread_pool(unsigned num_workers);
+
+  /**
+   * @brief Runs the remaining tasks and joins the worker threads.
+   */
+  ~thread_pool();
+
+  /**
+   * @brief Disallow copy constructor.
+   */
+  thread_pool(const thread_pool&) = delete;
+
+  /**
+   * @brief Disallow copy assignment operator.
+   */
+  thread_pool& operator=(const thread_pool&) = delete;
+
+  /**
+   * @brief Runs a functor on a worker thread, ignoring its result.
+   * @param[in] f     Functor to run.
+   */
+  template <class F>
+  void post(F&& f) {
+    using task_type = detail::pool_task_impl<typename std::decay<F>::type>;
+    push(std::unique_ptr<detail::pool_task>(
+      new task_type(typename std::decay<F>::type(std::forward<F>(f)))));
+  }
+
+  /**
+   * @brief Runs a functor with arguments on a worker thread.
+   * @param[in] f     Functor to run.
+   * @param[in] args  Arguments passed to the functor.
+   * @return A future providing the result of the functor or the exception
+   *         it threw.
+   */
+  template <class F, class... Args>
+  future<detail::pool_result_t<F, Args...>> submit(F&& f, Args&&... args) {
+    using task_type = detail::async_task<F, Args...>;
+    promise<detail::pool_result_t<F, Args...>> p;
+    auto result = p.get_future();
+    push(std::unique_ptr<detail::pool_task>(
+      new task_type(std::move(p), std::forward<F>(f),
+                    std::forward<Args>(args)...)));
+    return result;
+  }
+
+  /**
+   * @brief Returns the number of worker threads.
+   */
+  inline unsigned size() const noexcept { return m_num_workers; }
+
+private:
+  struct worker {
+    std::deque<std::unique_ptr<detail::pool_task>> tasks;
+    thread thr;
+  };
+
+  void push(std::unique_ptr<detail::pool_task> task);
+  // must be called with m_mtx locked
+  std::unique_ptr<detail::pool_task> pop(unsigned self);
+  void run(unsigned self);
+
+  std::unique_ptr<worker[]> m_workers;
+  unsigned m_num_workers;
+  mutex m_mtx;
+  condition_variable m_cv;
+  std::deque<std::unique_ptr<detail::pool_task>> m_shared;
+  unsigned m_pending;
+  bool m_stop;
+};
+
+/**
+ * @brief Runs a functor with arguments on a worker thread of a pool.
+ * @see   <a href="http://en.cppreference.com/w/cpp/thread/async">
+ *          std::async
+ *        </a>
+ * @param[in] pool  Thread pool to run the functor.
+ * @param[in] f     Functor to run.
+ * @param[in] args  Arguments passed to the functor.
+ * @return A future providing the result of the functor.
+ */
+template <class F, class... Args>
+inline future<detail::pool_result_t<F, Args...>>
+async(thread_pool& pool, F&& f, Args&&... args) {
+  return pool.submit(std::forward<F>(f), std::forward<Args>(args)...);
+}
+
+} // namespace riot
+
+#endif // RIOT_THREAD_POOL_HPP
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp11-compat
+ * @{
+ *
+ * @file
+ * @brief   Thread pool running tasks on a fixed set of worker threads
+ *
+ * @}
+ */
+
+#include <system_error>
+
+#include "riot/thread_pool.hpp"
+
+using namespace std;
+
+namespace riot {
+
+thread_pool::thread_pool(unsigned num_workers)
+    : m_workers{new worker[num_workers]},
+      m_num_workers{num_workers},
+      m_pending{0},
+      m_stop{false} {
+  if (num_workers == 0) {
+    throw system_error(make_error_code(errc::invalid_argument),
+                       "A thread pool needs at least one worker.");
+  }
+  for (unsigned i = 0; i < m_num_workers; i++) {
+    m_workers[i].thr = thread{[this, i] { run(i); }};
+  }
+}
+
+thread_pool::~thread_pool() {
+  {
+    lock_guard<mutex> lk(m_mtx);
+    m_stop = true;
+  }
+  m_cv.notify_all();
+  for (unsigned i = 0; i < m_num_workers; i++) {
+    m_workers[i].thr.join();
+  }
+}
+
+void thread_pool::push(unique_ptr<detail::pool_task> task) {
+  {
+    lock_guard<mutex> lk(m_mtx);
+    auto queue = &m_shared;
+    for (unsigned i = 0; i < m_num_workers; i++) {
+      if (m_workers[i].thr.get_id() == this_thread::get_id()) {
+        queue = &m_workers[i].tasks;
+        break;
+      }
+    }
+    queue->push_back(move(task));
+    ++m_pending;
+  }
+  m_cv.notify_one();
+}
+
+unique_ptr<detail::pool_task> thread_pool::pop(unsigned self) {
+  unique_ptr<detail::pool_task> task;
+  // the most recent task of this worker is the most likely to be cached
+  auto& own = m_workers[self].tasks;
+  if (!own.empty()) {
+    task = move(own.back());
+    own.pop_back();
+  }
+  else if (!m_shared.empty()) {
+    task = move(m_shared.front());
+    m_shared.pop_front();
+  }
+  else {
+    for (unsigned i = 1; i < m_num_workers; i++) {
+      auto& victim = m_workers[(self + i) % m_num_workers].tasks;
+      if (!victim.empty()) {
+        task = move(victim.front());
+        victim.pop_front();
+        break;
+      }
+    }
+  }
+  return task;
+}
+
+void thread_pool::run(unsigned self) {
+  unique_lock<mutex> lk(m_mtx);
+  while (true) {
+    m_cv.wait(lk, [this] { return (m_pending > 0) || m_stop; });
+    if (m_pending == 0) {
+      // stopped and all tasks are done
+      return;
+    }
+    // every pending task is in one of the queues, so pop() finds one
+    --m_pending;
+    auto task = pop(self);
+    lk.unlock();
+    task->run();
+    task.reset();
+    lk.lock();
+  }
+}
+
+} // namespace riot
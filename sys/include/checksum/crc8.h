@@ -11,6 +11,10 @@
  * @ingroup     sys_checksum
  * @brief       CRC-8 checksum algorithms
  *
+ * Besides the bitwise crc8(), there is a table-driven variant
+ * crc8_table_calc() for bulk data, which uses lookup tables generated at run
+ * time for an arbitrary polynomial by crc8_table_init().
+ *
  * @{
  *
  * @file
@@ -28,6 +32,26 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of lookup tables in a @ref crc8_table_t
+ *
+ * With 1, crc8_table_calc() processes one byte per table lookup. With N > 1
+ * it processes N bytes per step (e.g. slicing-by-4 or slicing-by-8), at the
+ * cost of 256 bytes per additional table.
+ */
+#ifndef CONFIG_CRC8_TABLE_SLICES
+#define CONFIG_CRC8_TABLE_SLICES    (1U)
+#endif
+
+/**
+ * @brief   Lookup tables for a generator polynomial
+ *
+ * Initialize with crc8_table_init().
+ */
+typedef struct {
+    uint8_t table[CONFIG_CRC8_TABLE_SLICES][256];   /**< lookup tables */
+} crc8_table_t;
+
 /**
  * @brief   Calculate CRC-8
  *
@@ -43,6 +67,31 @@ extern "C" {
  */
 uint8_t crc8(const uint8_t *data, size_t len, uint8_t poly, uint8_t seed);
 
+/**
+ * @brief   Generate the lookup tables for crc8_table_calc()
+ *
+ * @param[out] table    The lookup tables to generate
+ * @param[in] poly      The generator polynomial for the checksum
+ */
+void crc8_table_init(crc8_table_t *table, uint8_t poly);
+
+/**
+ * @brief   Calculate CRC-8 using lookup tables
+ *
+ * Yields the same result as crc8() with the polynomial @p table was
+ * initialized with.
+ *
+ * @param[in] table Lookup tables generated by crc8_table_init()
+ * @param[in] data  Start of memory area to checksum
+ * @param[in] len   Number of bytes in @p buf to calculate checksum for
+ * @param[in] seed  The seed (starting value) for the checksum
+ * @note Reflected inputs or outputs and final XOR must be realized
+ *       by the caller if needed.
+ * @return  Checksum of the specified memory area.
+ */
+uint8_t crc8_table_calc(const crc8_table_t *table, const uint8_t *data,
+                        size_t len, uint8_t seed);
+
 #ifdef __cplusplus
 }
 #endif
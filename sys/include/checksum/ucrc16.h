@@ -19,6 +19,12 @@
  * implementation. One can easily exchange generator polynomials and starting
  * seeds.
  *
+ * For bulk data there are table-driven variants of the functions
+ * (`ucrc16_table_*()`), which generate lookup tables for an arbitrary
+ * polynomial at run time in a caller provided @ref ucrc16_table_t. With
+ * @ref CONFIG_UCRC16_TABLE_SLICES > 1 they process multiple bytes per step
+ * ("slicing-by-N").
+ *
  * @{
  *
  * @file
@@ -44,6 +50,26 @@ extern "C" {
 #define UCRC16_CCITT_POLY_LE    (0x8408)    /**< CRC16-CCITT polynomial (little-endian) */
 /** @} */
 
+/**
+ * @brief   Number of lookup tables in a @ref ucrc16_table_t
+ *
+ * With 1, the table-driven functions process one byte per table lookup. With
+ * N > 1 they process N bytes per step (e.g. slicing-by-4 or slicing-by-8),
+ * at the cost of 512 bytes per additional table.
+ */
+#ifndef CONFIG_UCRC16_TABLE_SLICES
+#define CONFIG_UCRC16_TABLE_SLICES  (1U)
+#endif
+
+/**
+ * @brief   Lookup tables for a generator polynomial
+ *
+ * Initialize with ucrc16_table_init_be() or ucrc16_table_init_le().
+ */
+typedef struct {
+    uint16_t table[CONFIG_UCRC16_TABLE_SLICES][256];    /**< lookup tables */
+} ucrc16_table_t;
+
 /**
  * @brief   Calculate CRC16 (big-endian version)
  *
@@ -74,6 +100,56 @@ uint16_t ucrc16_calc_be(const uint8_t *buf, size_t len, uint16_t poly,
 uint16_t ucrc16_calc_le(const uint8_t *buf, size_t len, uint16_t poly,
                         uint16_t seed);
 
+/**
+ * @brief   Generate the lookup tables for ucrc16_table_calc_be()
+ *
+ * @param[out] table    The lookup tables to generate
+ * @param[in] poly      The generator polynomial for the checksum
+ */
+void ucrc16_table_init_be(ucrc16_table_t *table, uint16_t poly);
+
+/**
+ * @brief   Generate the lookup tables for ucrc16_table_calc_le()
+ *
+ * @param[out] table    The lookup tables to generate
+ * @param[in] poly      The generator polynomial for the checksum
+ */
+void ucrc16_table_init_le(ucrc16_table_t *table, uint16_t poly);
+
+/**
+ * @brief   Calculate CRC16 using lookup tables (big-endian version)
+ *
+ * Yields the same result as ucrc16_calc_be() with the polynomial @p table was
+ * initialized with.
+ *
+ * @param[in] table Lookup tables generated by ucrc16_table_init_be()
+ * @param[in] buf   Start of memory are to checksum
+ * @param[in] len   Number of bytes in @p buf to calculate checksum for
+ * @param[in] seed  The seed (starting value) for the checksum
+ *
+ * @return  Checksum of the specified memory area based on @p seed
+ * @note    The return value is not the complement of the sum but the sum itself
+ */
+uint16_t ucrc16_table_calc_be(const ucrc16_table_t *table, const uint8_t *buf,
+                              size_t len, uint16_t seed);
+
+/**
+ * @brief   Calculate CRC16 using lookup tables (little-endian version)
+ *
+ * Yields the same result as ucrc16_calc_le() with the polynomial @p table was
+ * initialized with.
+ *
+ * @param[in] table Lookup tables generated by ucrc16_table_init_le()
+ * @param[in] buf   Start of memory are to checksum
+ * @param[in] len   Number of bytes in @p buf to calculate checksum for
+ * @param[in] seed  The seed (starting value) for the checksum
+ *
+ * @return  Checksum of the specified memory area based on @p seed
+ * @note    The return value is not the complement of the sum but the sum itself
+ */
+uint16_t ucrc16_table_calc_le(const ucrc16_table_t *table, const uint8_t *buf,
+                              size_t len, uint16_t seed);
+
 #ifdef __cplusplus
 }
 #endif
@@ -21,6 +21,7 @@
 
 #include <stdint.h>
 
+#include "bitfield.h"
 #include "kernel_types.h"
 #include "universal_address.h"
 #include "mutex.h"
@@ -38,7 +39,7 @@ extern "C" {
 /**
  * @brief Container descriptor for a FIB entry
  */
-typedef struct {
+typedef struct fib_entry {
     /** interface ID */
     kernel_pid_t iface_id;
     /** Lifetime of this entry (an absolute time-point is stored by the FIB) */
@@ -51,6 +52,17 @@ typedef struct {
     uint32_t next_hop_flags;
     /** Pointer to the shared generic address */
     universal_address_container_t *next_hop;
+    /**
+     * First entry of the index bucket with the same position as this entry
+     * in the table (the table provides one bucket per entry)
+     */
+    struct fib_entry *idx_head;
+    /** Next entry in the same index bucket */
+    struct fib_entry *idx_next;
+    /** Next entry to expire after this one */
+    struct fib_entry *exp_next;
+    /** Number of leading bits of the destination used as index key */
+    uint8_t idx_len;
 } fib_entry_t;
 
 /**
@@ -133,6 +145,10 @@ typedef struct {
     *   e.g. when the unreachable destination is covered by the prefix
     */
     universal_address_container_t* prefix_rp[FIB_MAX_REGISTERED_RP];
+    /** expiring single hop entries, ordered by their lifetime */
+    fib_entry_t *expiry;
+    /** index key lengths (in bits) used by the single hop entries */
+    BITFIELD(idx_lens, (UNIVERSAL_ADDRESS_SIZE << 3) + 1);
 } fib_table_t;
 
 #ifdef __cplusplus
@@ -271,6 +271,29 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF              (8)
 #endif
 
+/**
+ * @brief   Use a hash index for longest-prefix matching on off-link entries
+ *
+ * When set, the forwarding table and prefix list lookup (performed on every
+ * forwarded packet) probes one hash bucket per prefix length in use instead of
+ * scanning all @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF off-link entries. The
+ * index costs @ref CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_BUCKETS + 128 half-words of
+ * RAM plus one half-word per off-link entry, so it pays off for nodes with a
+ * large forwarding table, e.g. border routers.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_INDEX
+#define CONFIG_GNRC_IPV6_NIB_OFFL_INDEX               0
+#endif
+
+/**
+ * @brief   Number of hash buckets of the off-link entry index
+ *
+ * @see @ref CONFIG_GNRC_IPV6_NIB_OFFL_INDEX
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_BUCKETS
+#define CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_BUCKETS      (32U)
+#endif
+
 #if CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
@@ -54,6 +54,37 @@
  * USEMODULE += gnrc_netapi_callbacks
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * @}
+ *
+ * @defgroup    net_gnrc_netapi_direct   Direct call extension
+ * @ingroup     net_gnrc_netapi
+ * @brief       Run-to-completion extension for @ref net_gnrc_netapi
+ * @{
+ * @details The submodule `gnrc_netapi_direct` lets network modules register
+ *          a handler with gnrc_netapi_direct_register(). Packets sent to such
+ *          a module with @ref GNRC_NETAPI_MSG_TYPE_SND or
+ *          @ref GNRC_NETAPI_MSG_TYPE_RCV are then handled synchronously on the
+ *          stack of the sending thread instead of being queued for the
+ *          module's thread, saving a context switch per layer and packet.
+ *
+ * A module's thread and direct calls into it are serialized by the lock in
+ * @ref gnrc_netapi_direct_t, which the thread holds while handling a
+ * message. If another thread holds the lock or the sender is an interrupt,
+ * the packet is queued as usual. Packets handled directly may thus overtake
+ * packets still in the module's queue. If the sending thread holds the lock
+ * itself, e.g. when IPv6 loops a packet back to IPv6, the packet is handled
+ * after the current handler returned.
+ *
+ * The threads sending packets (e.g. network interfaces and applications
+ * using @ref net_sock) need enough stack to run the handlers of the modules
+ * above respectively below them.
+ *
+ * To use, add the module `gnrc_netapi_direct` to the `USEMODULE` macro in
+ * your application's Makefile:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_netapi_direct
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * @}
  */
 
 #ifndef NET_GNRC_NETAPI_H
@@ -64,6 +95,12 @@
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pkt.h"
 
+#if defined(MODULE_GNRC_NETAPI_DIRECT) || defined(DOXYGEN)
+#include "cib.h"
+#include "msg.h"
+#include "mutex.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -104,6 +141,74 @@ typedef struct {
     uint16_t data_len;          /**< size of the data / the buffer */
 } gnrc_netapi_opt_t;
 
+#if defined(MODULE_GNRC_NETAPI_DIRECT) || defined(DOXYGEN)
+/**
+ * @brief   Number of packets a thread can defer per module
+ *
+ * Packets a thread sends to a module it is already running the handler of
+ * (e.g. an IPv6 packet looped back to IPv6) are deferred until the handler
+ * returns. Must be a power of 2.
+ */
+#ifndef CONFIG_GNRC_NETAPI_DIRECT_DEFER_SIZE
+#define CONFIG_GNRC_NETAPI_DIRECT_DEFER_SIZE    (4U)
+#endif
+
+/**
+ * @brief   Handler of a network module for direct calls
+ *
+ * @param[in] type  @ref GNRC_NETAPI_MSG_TYPE_SND or
+ *                  @ref GNRC_NETAPI_MSG_TYPE_RCV
+ * @param[in] pkt   The packet to handle
+ */
+typedef void (*gnrc_netapi_direct_handler_t)(uint16_t type,
+                                             gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Direct call registration of a network module
+ *
+ * @note    Only available with @ref net_gnrc_netapi_direct.
+ */
+typedef struct {
+    mutex_t lock;                           /**< serializes the module */
+    kernel_pid_t owner;                     /**< thread holding gnrc_netapi_direct_t::lock */
+    gnrc_netapi_direct_handler_t handler;   /**< handler for direct calls */
+    cib_t deferred_idx;                     /**< index of gnrc_netapi_direct_t::deferred */
+    /**
+     * @brief   Packets deferred by gnrc_netapi_direct_t::owner
+     */
+    msg_t deferred[CONFIG_GNRC_NETAPI_DIRECT_DEFER_SIZE];
+} gnrc_netapi_direct_t;
+
+/**
+ * @brief   Registers the calling thread's module for direct calls
+ *
+ * @pre     @p direct is not registered yet
+ *
+ * @param[out] direct   Registration to initialize. The calling thread
+ *                      must hold the registration's lock while it handles a
+ *                      message (see gnrc_netapi_direct_lock()).
+ * @param[in] handler   Handler to call for packets sent to the calling
+ *                      thread.
+ */
+void gnrc_netapi_direct_register(gnrc_netapi_direct_t *direct,
+                                 gnrc_netapi_direct_handler_t handler);
+
+/**
+ * @brief   Locks a registration against direct calls
+ *
+ * @param[in] direct    A registration
+ */
+void gnrc_netapi_direct_lock(gnrc_netapi_direct_t *direct);
+
+/**
+ * @brief   Handles the packets deferred while locked and unlocks a
+ *          registration for direct calls
+ *
+ * @param[in] direct    A registration locked by the calling thread
+ */
+void gnrc_netapi_direct_unlock(gnrc_netapi_direct_t *direct);
+#endif
+
 /**
  * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_SND or
  *          @ref GNRC_NETAPI_MSG_TYPE_RCV messages
@@ -114,7 +219,8 @@ typedef struct {
  *                      @ref GNRC_NETAPI_MSG_TYPE_SND or
  *                      @ref GNRC_NETAPI_MSG_TYPE_RCV
  *
- * @return              1 if packet was successfully delivered
+ * @return              1 if packet was successfully delivered (or handled by
+ *                      a direct call with @ref net_gnrc_netapi_direct)
  * @return              -1 on error (invalid PID or no space in queue)
  */
 int _gnrc_netapi_send_recv(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type);
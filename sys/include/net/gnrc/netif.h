@@ -53,7 +53,7 @@
 #include "net/ndp.h"
 #include "net/netdev.h"
 #include "net/netopt.h"
-#ifdef MODULE_NETSTATS_L2
+#if defined(MODULE_NETSTATS_L2) || defined(MODULE_NETSTATS_EXT)
 #include "net/netstats.h"
 #endif
 #include "rmutex.h"
@@ -79,6 +79,9 @@ typedef struct {
 #ifdef MODULE_NETSTATS_L2
     netstats_t stats;                       /**< transceiver's statistics */
 #endif
+#if defined(MODULE_NETSTATS_EXT) || DOXYGEN
+    netstats_ext_t stats_ext;               /**< extended statistics */
+#endif
 #if defined(MODULE_GNRC_LORAWAN) || DOXYGEN
     gnrc_netif_lorawan_t lorawan;           /**< LoRaWAN component */
 #endif
@@ -231,6 +234,30 @@ struct gnrc_netif_ops {
      * @param[in] msg   Message to be handled.
      */
     void (*msg_handler)(gnrc_netif_t *netif, msg_t *msg);
+
+    /**
+     * @brief   Send multiple @ref net_gnrc_pkt "packets" over the network
+     *          interface
+     *
+     * @pre `(netif != NULL) && (pkts != NULL) && (num > 0)`
+     *
+     * Used instead of gnrc_netif_ops_t::send() for send requests that were
+     * queued up at the interface, if @ref CONFIG_GNRC_NETIF_TX_BATCH_SIZE is
+     * greater than 1. Leave NULL if the interface does not support it.
+     *
+     * @note Like gnrc_netif_ops_t::send(), the function releases all packets
+     *       in @p pkts before returning.
+     *
+     * @param[in] netif The network interface.
+     * @param[in] pkts  The packets to send, in order.
+     * @param[in] num   Number of packets in @p pkts.
+     *
+     * @return  The number of bytes actually sent over all packets on success
+     * @return  Any negative error code reported by gnrc_netif_t::dev, if
+     *          no packet could be sent.
+     */
+    int (*send_batch)(gnrc_netif_t *netif, gnrc_pktsnip_t *pkts[],
+                      unsigned num);
 };
 
 /**
@@ -307,6 +334,20 @@ gnrc_netif_t *gnrc_netif_iter(const gnrc_netif_t *prev);
  */
 gnrc_netif_t *gnrc_netif_get_by_pid(kernel_pid_t pid);
 
+#if defined(MODULE_NETSTATS_EXT) || DOXYGEN
+/**
+ * @brief   Counts a dropped packet in the extended statistics of the
+ *          interface it was received on or is to be sent over
+ *
+ * The interface is taken from the generic network interface header of
+ * @p pkt. Packets without one are not counted.
+ *
+ * @param[in] pkt       The dropped packet.
+ * @param[in] reason    Cause of the drop.
+ */
+void gnrc_netif_stats_drop(gnrc_pktsnip_t *pkt, netstats_drop_t reason);
+#endif
+
 /**
  * @brief   Gets the (unicast on anycast) IPv6 address of an interface (if IPv6
  *          is supported)
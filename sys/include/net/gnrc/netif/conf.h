@@ -152,6 +152,23 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US   (0U)
 #endif
 
+/**
+ * @brief   Maximum number of packets sent in one batch
+ *
+ * When handling a send request, the interface thread also takes the send
+ * requests already waiting in its message queue, up to this number of
+ * packets, and hands them to gnrc_netif_ops_t::send_batch() at once, if the
+ * interface provides it. A value of 1 disables batching, as does a
+ * @ref CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US greater than 0.
+ *
+ * @attention   This has influence on the used stack memory of the thread, so
+ *              the thread's stack size might need to be adapted if this is
+ *              changed.
+ */
+#ifndef CONFIG_GNRC_NETIF_TX_BATCH_SIZE
+#define CONFIG_GNRC_NETIF_TX_BATCH_SIZE             (1U)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
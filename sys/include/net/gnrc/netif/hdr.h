@@ -105,6 +105,15 @@ typedef struct {
     uint8_t flags;              /**< flags as defined above */
     uint8_t lqi;                /**< lqi of received packet (optional) */
     int16_t rssi;               /**< rssi of received packet in dBm (optional) */
+#if defined(MODULE_NETSTATS_EXT) || DOXYGEN
+    /**
+     * @brief   Time of reception in us, 0 if unknown
+     *
+     * Set by the interface for the latency histogram of
+     * netstats_ext_t.
+     */
+    uint32_t rx_time;
+#endif
 } gnrc_netif_hdr_t;
 
 /**
@@ -123,6 +132,9 @@ static inline void gnrc_netif_hdr_init(gnrc_netif_hdr_t *hdr, uint8_t src_l2addr
     hdr->rssi = 0;
     hdr->lqi = 0;
     hdr->flags = 0;
+#ifdef MODULE_NETSTATS_EXT
+    hdr->rx_time = 0;
+#endif
 }
 
 /**
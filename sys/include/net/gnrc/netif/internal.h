@@ -26,6 +26,7 @@
 #include "net/gnrc/netif.h"
 #include "net/l2util.h"
 #include "net/netopt.h"
+#include "net/netstats.h"
 
 #ifdef MODULE_GNRC_IPV6_NIB
 #include "net/gnrc/ipv6/nib/conf.h"
@@ -58,6 +59,28 @@ void gnrc_netif_acquire(gnrc_netif_t *netif);
  */
 void gnrc_netif_release(gnrc_netif_t *netif);
 
+/**
+ * @brief   Counts a packet the interface dropped before handing it on in
+ *          its extended statistics
+ *
+ * Does nothing without the `netstats_ext` module.
+ *
+ * @param[in] netif     the network interface
+ * @param[in] reason    cause of the drop
+ *
+ * @internal
+ */
+static inline void gnrc_netif_stats_ext_drop(gnrc_netif_t *netif,
+                                             netstats_drop_t reason)
+{
+#ifdef MODULE_NETSTATS_EXT
+    netif->stats_ext.drops[reason]++;
+#else
+    (void)netif;
+    (void)reason;
+#endif
+}
+
 #if defined(MODULE_GNRC_IPV6) || DOXYGEN
 /**
  * @brief   Adds an IPv6 address to the interface
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_netif
+ * @{
+ *
+ * @file
+ * @brief   CoAP resource exporting the extended statistics of all
+ *          interfaces
+ *
+ * The resource answers GET requests with a JSON array holding one object
+ * per interface:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * [{"if":6,"rx":[12,1843],"tx":[10,1290,0],
+ *   "drops":{"pktbuf":0,"queue":0,"filter":0,"no_rcv":1,"invalid":0},
+ *   "queue_max":[2,1],"latency":[0,0,0,0,0,0,3,5,2,0, ...]}]
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * `rx` holds packets and bytes, `tx` packets, bytes and failures,
+ * `queue_max` the high-water marks of the interface and sock queues and
+ * `latency` the histogram buckets of netstats_ext_t::latency. The payload
+ * is sent blockwise, so it works with small CoAP buffers as well.
+ *
+ * Add @ref GNRC_NETIF_STATS_COAP_RESOURCE to the resources of a
+ * @ref net_nanocoap server or a @ref net_gcoap listener to use it.
+ */
+#ifndef NET_GNRC_NETIF_STATS_COAP_H
+#define NET_GNRC_NETIF_STATS_COAP_H
+
+#include "net/nanocoap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Path of the statistics resource
+ */
+#ifndef CONFIG_GNRC_NETIF_STATS_COAP_PATH
+#define CONFIG_GNRC_NETIF_STATS_COAP_PATH   "/netstats"
+#endif
+
+/**
+ * @brief   CoAP handler serving the extended statistics
+ *
+ * @see coap_handler_t
+ */
+ssize_t gnrc_netif_stats_coap_handler(coap_pkt_t *pkt, uint8_t *buf,
+                                      size_t len, void *context);
+
+/**
+ * @brief   Initializer for the @ref coap_resource_t of the statistics
+ */
+#define GNRC_NETIF_STATS_COAP_RESOURCE  { CONFIG_GNRC_NETIF_STATS_COAP_PATH, \
+                                          COAP_GET,                          \
+                                          gnrc_netif_stats_coap_handler,     \
+                                          NULL }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_NETIF_STATS_COAP_H */
+/** @} */
@@ -35,6 +35,19 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of hash buckets per @ref net_gnrc_nettype "network type"
+ *
+ * Registry entries are hashed into buckets by their
+ * gnrc_netreg_entry_t::demux_ctx, so a lookup only walks the entries of one
+ * bucket instead of all entries registered for a type. The buckets cost
+ * @ref GNRC_NETTYPE_NUMOF pointers each, so increase this for nodes with many
+ * registered entries, e.g. gateways with hundreds of UDP sockets.
+ */
+#ifndef CONFIG_GNRC_NETREG_BUCKETS
+#define CONFIG_GNRC_NETREG_BUCKETS      (1U)
+#endif
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
     defined(DOXYGEN)
 /**
@@ -178,6 +191,7 @@ typedef struct gnrc_netreg_entry {
      * @details This can be defined by the network protocol themselves.
      *          E. g. protocol numbers / next header numbers in IPv4/IPv6,
      *          ports in UDP/TCP, or similar.
+     *          Must not be changed while the entry is registered.
      */
     uint32_t demux_ctx;
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
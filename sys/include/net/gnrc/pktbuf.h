@@ -58,6 +58,19 @@ extern "C" {
 #define GNRC_PKTBUF_SIZE    (6144)
 #endif  /* GNRC_PKTBUF_SIZE */
 
+/**
+ * @def     GNRC_PKTBUF_SLAB_PAGE_SIZE
+ * @brief   Page size of the `gnrc_pktbuf_slab` packet buffer.
+ *
+ * @details `gnrc_pktbuf_slab` splits the packet buffer into pages of this
+ *          size. A page either holds blocks of one size class (16 bytes up to
+ *          half of the page size) or belongs to a run of pages holding a
+ *          single larger chunk. Must be 128, 256, or 512.
+ */
+#ifndef GNRC_PKTBUF_SLAB_PAGE_SIZE
+#define GNRC_PKTBUF_SLAB_PAGE_SIZE  (128)
+#endif  /* GNRC_PKTBUF_SLAB_PAGE_SIZE */
+
 /**
  * @brief   Initializes packet buffer module.
  */
@@ -72,6 +72,23 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE       (4U)
 #endif
 
+/**
+ * @brief   Number of hash buckets of the reassembly buffer
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_rb](@ref net_gnrc_sixlowpan_frag_rb) module
+ *
+ * Reassembly buffer entries are hashed into buckets by their link-layer
+ * source and destination address and datagram tag, so finding the entry of a
+ * fragment only walks the entries of one bucket. Each bucket costs one
+ * pointer, so increase this together with
+ * @ref CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE on border routers that reassemble
+ * datagrams of many nodes at once.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS    (1U)
+#endif
+
 /**
  * @brief   Timeout for reassembly buffer entries in microseconds
  *
@@ -90,12 +90,27 @@ typedef struct {
  * A recipient of a fragment SHALL use
  *
  */
-typedef struct {
+typedef struct gnrc_sixlowpan_frag_rb {
     gnrc_sixlowpan_frag_rb_base_t super;        /**< base class */
     /**
      * @brief   The reassembled packet in the packet buffer
      */
     gnrc_pktsnip_t *pkt;
+    /**
+     * @brief   Next entry in the same hash bucket, or in the list of unused
+     *          entries
+     */
+    struct gnrc_sixlowpan_frag_rb *bucket_next;
+    /**
+     * @brief   Previous entry in the list of entries ordered by
+     *          gnrc_sixlowpan_frag_rb_base_t::arrival
+     */
+    struct gnrc_sixlowpan_frag_rb *prev;
+    /**
+     * @brief   Next entry in the list of entries ordered by
+     *          gnrc_sixlowpan_frag_rb_base_t::arrival
+     */
+    struct gnrc_sixlowpan_frag_rb *next;
 } gnrc_sixlowpan_frag_rb_t;
 
 /**
@@ -235,12 +250,7 @@ int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf
  *
  * @param[in] rbuf  A reassembly buffer entry. Must not be NULL.
  */
-static inline void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf)
-{
-    assert(rbuf != NULL);
-    gnrc_sixlowpan_frag_rb_base_rm(&rbuf->super);
-    rbuf->pkt = NULL;
-}
+void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf);
 #else
 /* NOPs to be used with gnrc_sixlowpan_iphc if gnrc_sixlowpan_frag_rb is not
  * compiled in */
@@ -34,6 +34,11 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Timeout value to block until the operation completes
+ */
+#define GNRC_TCP_NO_TIMEOUT (UINT32_MAX)
+
 /**
  * @brief Address information for a single TCP connection endpoint.
  * @extends sock_tcp_ep_t
@@ -154,6 +159,74 @@ int gnrc_tcp_open_active(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote,
  */
 int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *local);
 
+/**
+ * @brief Listen for incoming connections on a local endpoint.
+ *
+ * @pre @p queue must not be NULL.
+ * @pre @p tcbs must not be NULL and @p tcbs_len must not be zero.
+ * @pre @p local must not be NULL.
+ * @pre port in @p local must not be zero.
+ *
+ * @note Unlike gnrc_tcp_open_passive() this does not block. Connection requests
+ *       are answered by the TCP thread and completed connections are taken
+ *       from @p queue with gnrc_tcp_accept(). A half-open connection only
+ *       occupies a small entry of the SYN queue (see GNRC_TCP_SYN_QUEUE_SIZE);
+ *       a TCB of @p tcbs and a receive buffer are assigned on completion.
+ *
+ * @param[out]    queue      Listening queue to initialize.
+ * @param[in,out] tcbs       TCBs for connections accepted on @p queue. They
+ *                           are initialized by this function.
+ * @param[in]     tcbs_len   Number of TCBs in @p tcbs, this is the maximum
+ *                           number of connections on @p queue at a time.
+ * @param[in]     local      Endpoint specifying the port and address used to
+ *                           wait for incoming connections.
+ *
+ * @return   0 on success.
+ * @return   -EAFNOSUPPORT if @p local has an unsupported address family.
+ * @return   -EADDRINUSE if another listener uses the port in @p local.
+ */
+int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tcbs_len,
+                    const gnrc_tcp_ep_t *local);
+
+/**
+ * @brief Take an established connection from a listening queue.
+ *
+ * @pre gnrc_tcp_listen() must have been successfully called on @p queue.
+ * @pre @p queue must not be NULL.
+ * @pre @p tcb must not be NULL.
+ *
+ * @note The returned TCB is handed back to @p queue by gnrc_tcp_close() or
+ *       gnrc_tcp_abort(). It must not be used afterwards.
+ *
+ * @param[in,out] queue                      Listening queue.
+ * @param[out]    tcb                        TCB of the accepted connection.
+ * @param[in]     user_timeout_duration_us   If zero and no connection is waiting,
+ *                                           the function returns immediately. If
+ *                                           GNRC_TCP_NO_TIMEOUT, the function
+ *                                           blocks until a connection was
+ *                                           established. Otherwise it blocks at
+ *                                           most @p user_timeout_duration_us.
+ *
+ * @return   0 on success.
+ * @return   -EINVAL if @p queue is not listening.
+ * @return   -EAGAIN if @p user_timeout_duration_us is zero and no connection is waiting.
+ * @return   -ETIMEDOUT if @p user_timeout_duration_us expired.
+ */
+int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
+                    const uint32_t user_timeout_duration_us);
+
+/**
+ * @brief Stop listening on a listening queue.
+ *
+ * Pending half-open connections are dropped and established connections that
+ * were not accepted yet are aborted. Accepted connections are not affected.
+ *
+ * @pre @p queue must not be NULL.
+ *
+ * @param[in,out] queue   Listening queue.
+ */
+void gnrc_tcp_stop_listen(gnrc_tcp_tcb_queue_t *queue);
+
 /**
  * @brief Transmit data to connected peer.
  *
@@ -216,6 +289,9 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
  * @pre gnrc_tcp_tcb_init() must have been successfully called.
  * @pre @p tcb must not be NULL.
  *
+ * @note If @p tcb was returned by gnrc_tcp_accept(), it is handed back to its
+ *       listening queue.
+ *
  * @param[in,out] tcb   TCB holding the connection information.
  */
 void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb);
@@ -226,10 +302,49 @@ void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb);
  * @pre gnrc_tcp_tcb_init() must have been successfully called.
  * @pre @p tcb must not be NULL.
  *
+ * @note If @p tcb was returned by gnrc_tcp_accept(), it is handed back to its
+ *       listening queue.
+ *
  * @param[in,out] tcb   TCB holding the connection information.
  */
 void gnrc_tcp_abort(gnrc_tcp_tcb_t *tcb);
 
+#if defined(SOCK_HAS_ASYNC) || defined(DOXYGEN)
+/**
+ * @brief Set the event callback of a TCB.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ *
+ * @note The callback is called from the GNRC TCP thread or the thread calling
+ *       the GNRC TCP API and must not call GNRC TCP functions on @p tcb.
+ *       Received data and a closed connection are reported right away if they
+ *       are already pending when the callback is set.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     cb    Event callback. NULL to unset the callback.
+ * @param[in]     arg   Argument passed to @p cb.
+ */
+void gnrc_tcp_tcb_set_cb(gnrc_tcp_tcb_t *tcb, gnrc_tcp_tcb_cb_t cb, void *arg);
+
+/**
+ * @brief Set the event callback of a listening queue.
+ *
+ * @pre gnrc_tcp_listen() must have been successfully called.
+ * @pre @p queue must not be NULL.
+ *
+ * @note The callback is called from the GNRC TCP thread and must not call
+ *       GNRC TCP functions on @p queue. Every connection waiting to be
+ *       accepted when the callback is set is reported right away.
+ *
+ * @param[in,out] queue   Listening queue.
+ * @param[in]     cb      Event callback. NULL to unset the callback.
+ * @param[in]     arg     Argument passed to @p cb.
+ */
+void gnrc_tcp_tcb_queue_set_cb(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_queue_cb_t cb,
+                               void *arg);
+#endif
+
 /**
  * @brief Calculate and set checksum in TCP header.
  *
@@ -66,19 +66,102 @@ extern "C" {
 #endif
 
 /**
- * @brief Number of preallocated receive buffers
+ * @brief Number of connections that can hold a receive buffer at the same time
  */
 #ifndef GNRC_TCP_RCV_BUFFERS
 #define GNRC_TCP_RCV_BUFFERS (1U)
 #endif
 
 /**
- * @brief Default receive buffer size
+ * @brief Maximum receive buffer size of a connection
  */
 #ifndef GNRC_TCP_RCV_BUF_SIZE
 #define GNRC_TCP_RCV_BUF_SIZE (GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Size of the pages receive buffers are built from
+ *
+ * Received data is stored in pages taken from a pool shared by all
+ * connections. A page is returned to the pool as soon as all of its data was
+ * read, so idle connections hold no pages.
+ */
+#ifndef GNRC_TCP_RCV_BUF_PAGE_SIZE
+#define GNRC_TCP_RCV_BUF_PAGE_SIZE (128U)
+#endif
+
+/**
+ * @brief Number of pages in the receive buffer pool
+ *
+ * By default, every connection holding a receive buffer can fill it up to
+ * GNRC_TCP_RCV_BUF_SIZE at the same time. With less pages, the pool is
+ * overcommitted: the receive window a connection announces is then also
+ * limited by the pages left in the pool.
+ */
+#ifndef GNRC_TCP_RCV_BUF_POOL_PAGES
+#define GNRC_TCP_RCV_BUF_POOL_PAGES (GNRC_TCP_RCV_BUFFERS * \
+                                     ((GNRC_TCP_RCV_BUF_SIZE + GNRC_TCP_RCV_BUF_PAGE_SIZE - 1) / \
+                                      GNRC_TCP_RCV_BUF_PAGE_SIZE))
+#endif
+
+/**
+ * @brief Number of unacknowledged segments a connection may have in flight
+ *
+ * With the default of one, a segment is only sent after the previous one was
+ * acknowledged. Larger values let the congestion window (RFC 5681) decide how
+ * many segments are sent per round trip and additionally negotiate window
+ * scaling (RFC 7323) and SACK (RFC 2018) on connection setup. At most 32.
+ */
+#ifndef GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+#define GNRC_TCP_RETRANSMIT_QUEUE_SIZE (1U)
+#endif
+
+/**
+ * @brief Number of segments received behind a gap, a connection holds back
+ *
+ * These segments are passed to the receive buffer as soon as the missing data
+ * arrived and are reported to the peer in SACK blocks (RFC 2018). With zero,
+ * all segments behind a gap are dropped and have to be retransmitted.
+ * The default allows holding back the rest of a full receive window.
+ */
+#ifndef GNRC_TCP_RCV_OOO_QUEUE_SIZE
+#define GNRC_TCP_RCV_OOO_QUEUE_SIZE (GNRC_TCP_MSS_MULTIPLICATOR - 1U)
+#endif
+
+/**
+ * @brief Message queue size of the TCP thread
+ *
+ * Every segment received is passed to the TCP thread in a message. A sender
+ * with several segments in flight needs a queue large enough to hold a burst.
+ * Must be a power of two.
+ */
+#ifndef GNRC_TCP_MSG_QUEUE_SIZE
+#define GNRC_TCP_MSG_QUEUE_SIZE (8U)
+#endif
+
+/**
+ * @brief Number of half-open connections all listening queues can track
+ *
+ * A SYN received on a listening queue occupies one of these entries until the
+ * handshake completes. Only then a TCB and a receive buffer are assigned to
+ * the connection. If all entries are in use, new SYNs are dropped until an
+ * entry expires.
+ */
+#ifndef GNRC_TCP_SYN_QUEUE_SIZE
+#define GNRC_TCP_SYN_QUEUE_SIZE (4U)
+#endif
+
+/**
+ * @brief Time after which a half-open connection is dropped = 3 sec
+ *
+ * Until then, the SYN+ACK of the connection is retransmitted every
+ * @ref GNRC_TCP_RTO_LOWER_BOUND. This also makes a peer, whose handshake
+ * completed while the listening queue had no TCB left, acknowledge again.
+ */
+#ifndef GNRC_TCP_SYN_QUEUE_TIMEOUT
+#define GNRC_TCP_SYN_QUEUE_TIMEOUT (3U * US_PER_SEC)
+#endif
+
 /**
  * @brief Lower bound for RTO = 1 sec (see RFC 6298)
  */
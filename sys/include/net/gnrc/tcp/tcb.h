@@ -22,7 +22,6 @@
 
 #include <stdint.h>
 #include "kernel_types.h"
-#include "ringbuffer.h"
 #include "xtimer.h"
 #include "mutex.h"
 #include "msg.h"
@@ -43,6 +42,56 @@ extern "C" {
  */
 #define GNRC_TCP_TCB_MBOX_SIZE (8U)
 
+/**
+ * @brief Receive buffer of a TCB, a chain of pages from the receive buffer pool.
+ */
+typedef struct {
+    uint8_t used;          /**< Flag: Is a receive buffer assigned? */
+    uint16_t head;         /**< Pool index of the first page */
+    uint16_t tail;         /**< Pool index of the last page */
+    uint16_t pages;        /**< Number of pages in the chain */
+    uint16_t start;        /**< Offset of the first unread byte in the first page */
+    uint32_t avail;        /**< Number of unread bytes */
+} gnrc_tcp_rcvbuf_t;
+
+#if defined(SOCK_HAS_ASYNC) || defined(DOXYGEN)
+/**
+ * @name Events reported to the event callback of a TCB or listening queue
+ *
+ * The values match @ref sock_async_flags_t.
+ * @{
+ */
+#define GNRC_TCP_EVENT_CONN_RDY     (0x0001)    /**< Connection established */
+#define GNRC_TCP_EVENT_CONN_FIN     (0x0002)    /**< Connection closed or closing by the peer */
+#define GNRC_TCP_EVENT_CONN_RECV    (0x0004)    /**< Listening queue established a connection */
+#define GNRC_TCP_EVENT_MSG_RECV     (0x0010)    /**< Data was added to the receive buffer */
+#define GNRC_TCP_EVENT_MSG_SENT     (0x0020)    /**< Sent data was acknowledged */
+/** @} */
+
+struct _transmission_control_block;
+struct _gnrc_tcp_tcb_queue;
+
+/**
+ * @brief Event callback of a TCB, see gnrc_tcp_tcb_set_cb().
+ *
+ * @param[in] tcb     TCB the events happened on.
+ * @param[in] events  Events that happened, see GNRC_TCP_EVENT_*.
+ * @param[in] arg     Argument given to gnrc_tcp_tcb_set_cb().
+ */
+typedef void (*gnrc_tcp_tcb_cb_t)(struct _transmission_control_block *tcb, unsigned events,
+                                  void *arg);
+
+/**
+ * @brief Event callback of a listening queue, see gnrc_tcp_tcb_queue_set_cb().
+ *
+ * @param[in] queue   Listening queue the events happened on.
+ * @param[in] events  Events that happened, see GNRC_TCP_EVENT_*.
+ * @param[in] arg     Argument given to gnrc_tcp_tcb_queue_set_cb().
+ */
+typedef void (*gnrc_tcp_tcb_queue_cb_t)(struct _gnrc_tcp_tcb_queue *queue, unsigned events,
+                                        void *arg);
+#endif
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -56,34 +105,75 @@ typedef struct _transmission_control_block {
     uint16_t local_port;   /**< Local connections port number */
     uint16_t peer_port;    /**< Peer connections port number */
     uint8_t state;         /**< Connections state */
-    uint8_t status;        /**< A connections status flags */
+    uint16_t status;       /**< A connections status flags */
     uint32_t snd_una;      /**< Send unacknowledged */
     uint32_t snd_nxt;      /**< Send next */
-    uint16_t snd_wnd;      /**< Send window */
+    uint32_t snd_wnd;      /**< Send window, scaled by snd_wnd_scale */
     uint32_t snd_wl1;      /**< SeqNo. from last window update */
     uint32_t snd_wl2;      /**< AckNo. from last window update */
     uint32_t rcv_nxt;      /**< Receive next */
-    uint16_t rcv_wnd;      /**< Receive window */
+    uint32_t rcv_wnd;      /**< Receive window */
+    uint8_t snd_wnd_scale; /**< Shift count of windows announced by the peer */
+    uint8_t rcv_wnd_scale; /**< Shift count of windows announced to the peer */
     uint32_t iss;          /**< Initial sequence sumber */
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
+    uint32_t cwnd;         /**< Congestion window */
+    uint32_t ssthresh;     /**< Slow start threshold */
+    uint32_t recover;      /**< Highest SeqNo. sent when loss recovery started */
+    uint32_t rxt_nxt;      /**< SeqNo. up to which loss recovery retransmitted segments */
+    uint8_t dup_acks;      /**< Number of consecutive duplicate ACKs */
     uint32_t rtt_start;    /**< Timer value for rtt estimation */
+    uint32_t rtt_seq;      /**< SeqNo. whose acknowledgment ends the rtt measurement */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
     uint8_t retries;       /**< Number of retransmissions */
     xtimer_t tim_tout;     /**< Timer struct for timeouts */
     msg_t msg_tout;        /**< Message, sent on timeouts */
-    gnrc_pktsnip_t *pkt_retransmit;   /**< Pointer to packet in "retransmit queue" */
+    gnrc_pktsnip_t *pkt_retransmit[GNRC_TCP_RETRANSMIT_QUEUE_SIZE]; /**< "Retransmit queue" */
+    uint8_t pkt_retransmit_num;  /**< Number of packets in the retransmit queue */
+    uint32_t pkt_sacked;         /**< Bitfield of packets in the retransmit queue SACKed */
+#if GNRC_TCP_RCV_OOO_QUEUE_SIZE > 0
+    gnrc_pktsnip_t *pkt_ooo[GNRC_TCP_RCV_OOO_QUEUE_SIZE]; /**< Segments behind a gap, by SeqNo. */
+    uint8_t pkt_ooo_num;         /**< Number of packets in pkt_ooo */
+    uint32_t ooo_last;           /**< SeqNo. of the segment last added to pkt_ooo */
+#endif
     msg_t mbox_raw[GNRC_TCP_TCB_MBOX_SIZE];   /**< Msg queue for mbox */
     mbox_t mbox;             /**< TCB mbox for synchronization */
-    uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
-    ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
+    gnrc_tcp_rcvbuf_t rcv_buf;  /**< Receive buffer */
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
+#ifdef SOCK_HAS_ASYNC
+    gnrc_tcp_tcb_cb_t async_cb;  /**< Event callback */
+    void *async_cb_arg;          /**< Argument of async_cb */
+#endif
     struct _transmission_control_block *next;   /**< Pointer next TCB */
 } gnrc_tcp_tcb_t;
 
+/**
+ * @brief Listening queue of GNRC TCP.
+ *
+ * Hands out connections to the TCBs it was given, see gnrc_tcp_listen().
+ */
+typedef struct _gnrc_tcp_tcb_queue {
+    uint8_t address_family;                   /**< Address Family of local_addr */
+#ifdef MODULE_GNRC_IPV6
+    uint8_t local_addr[sizeof(ipv6_addr_t)];  /**< Local IP address, may be unspecified */
+#endif
+    uint16_t local_port;     /**< Local port number to listen on */
+    gnrc_tcp_tcb_t *tcbs;    /**< TCBs used for accepted connections */
+    size_t tcbs_len;         /**< Number of TCBs in tcbs */
+    msg_t mbox_raw[GNRC_TCP_TCB_MBOX_SIZE];   /**< Msg queue for mbox */
+    mbox_t mbox;             /**< Queue mbox for synchronization */
+    mutex_t function_lock;   /**< Mutex for function call synchronization */
+#ifdef SOCK_HAS_ASYNC
+    gnrc_tcp_tcb_queue_cb_t async_cb;  /**< Event callback */
+    void *async_cb_arg;                /**< Argument of async_cb */
+#endif
+    struct _gnrc_tcp_tcb_queue *next;   /**< Pointer to next listening queue */
+} gnrc_tcp_tcb_queue_t;
+
 #ifdef __cplusplus
 }
 #endif
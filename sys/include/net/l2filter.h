@@ -49,6 +49,10 @@ extern "C" {
 
 /**
  * @brief   Number of slots in each filter list (filter entries per device)
+ *
+ * Entries are placed into the list by a hash of their address, so checking
+ * an address takes constant time as long as the list is not close to full.
+ * Leave about a quarter of the slots free when filtering many addresses.
  */
 #ifndef L2FILTER_LISTSIZE
 #define L2FILTER_LISTSIZE               (8U)
@@ -1461,7 +1461,7 @@ ssize_t coap_handle_req(coap_pkt_t *pkt, uint8_t *resp_buf, unsigned resp_buf_le
  * @brief   Pass a coap request to a matching handler
  *
  * This function will try to find a matching handler in @p resources and call
- * the handler.
+ * the handler. @p resources must be sorted alphabetically by path.
  *
  * @param[in]   pkt             pointer to (parsed) CoAP packet
  * @param[out]  resp_buf        buffer for response
@@ -1575,6 +1575,32 @@ extern ssize_t coap_well_known_core_default_handler(coap_pkt_t *pkt, \
  */
 int coap_match_path(const coap_resource_t *resource, uint8_t *uri);
 
+/**
+ * @brief   Finds the resource handling a URI in an array of resources
+ *
+ * Finds the first resource in @p resources that coap_match_path() matches
+ * with @p uri and that allows the method of @p method_flag. As the resources
+ * must be sorted by path, this takes O(strlen(@p uri) * log(@p resources_numof))
+ * character comparisons instead of comparing @p uri to every resource.
+ *
+ * @note This function is not intended for application use.
+ * @internal
+ *
+ * @param[in]  resources        array of resources, sorted by path (as by
+ *                              strcmp())
+ * @param[in]  resources_numof  number of resources in @p resources
+ * @param[in]  uri              null-terminated URI path to look up
+ * @param[in]  method_flag      method of the request, see coap_method2flag()
+ * @param[out] resource         the matching resource
+ *
+ * @return 0 if a matching resource was found
+ * @return -ENOENT if no resource matches @p uri
+ * @return -EPERM if resources match @p uri, but none allows @p method_flag
+ */
+int coap_find_resource(const coap_resource_t *resources, size_t resources_numof,
+                       const uint8_t *uri, coap_method_flags_t method_flag,
+                       const coap_resource_t **resource);
+
 #if defined(MODULE_GCOAP) || defined(DOXYGEN)
 /**
  * @name    Functions -- gcoap specific
@@ -139,6 +139,32 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Coap block-wise-transfer size SZX
+ */
+typedef enum {
+    COAP_BLOCKSIZE_32 = 1,
+    COAP_BLOCKSIZE_64,
+    COAP_BLOCKSIZE_128,
+    COAP_BLOCKSIZE_256,
+    COAP_BLOCKSIZE_512,
+    COAP_BLOCKSIZE_1024,
+} coap_blksize_t;
+
+/**
+ * @brief   Coap blockwise request callback descriptor
+ *
+ * @param[in] arg      Pointer to be passed as arguments to the callback
+ * @param[in] offset   Offset of received data
+ * @param[in] buf      Pointer to the received data
+ * @param[in] len      Length of the received data
+ * @param[in] more     -1 for no option, 0 for last block, 1 for more blocks
+ *
+ * @returns    0       on success
+ * @returns   -1       on error
+ */
+typedef int (*coap_blockwise_cb_t)(void *arg, size_t offset, uint8_t *buf, size_t len, int more);
+
 /**
  * @brief   Start a nanocoap server instance
  *
@@ -183,6 +209,35 @@ ssize_t nanocoap_get(sock_udp_ep_t *remote, const char *path, uint8_t *buf,
 ssize_t nanocoap_request(coap_pkt_t *pkt, sock_udp_ep_t *local,
                          sock_udp_ep_t *remote, size_t len);
 
+/**
+ * @brief   Performs a blockwise coap get request to the specified url.
+ *
+ * This function will fetch the content of the specified resource path via
+ * block-wise-transfer. A coap_blockwise_cb_t will be called on each received
+ * block, in order of the offset.
+ *
+ * Up to @p window block requests are kept in flight. The first block is
+ * requested on its own so the server can choose a smaller block size. Each
+ * request is retransmitted independently, duplicate responses are ignored.
+ *
+ * @note    RFC 7252, section 4.7 limits the number of outstanding interactions
+ *          with a server (NSTART) to 1 by default. Only pass a @p window
+ *          larger than 1 for servers known to accept a larger NSTART.
+ *
+ * @param[in]   remote      remote UDP endpoint
+ * @param[in]   path        remote path
+ * @param[in]   blksize     block size to request
+ * @param[in]   window      number of block requests kept in flight, >= 1
+ * @param[in]   callback    callback to be executed on each received block
+ * @param[in]   arg         optional function arguments
+ *
+ * @returns     0 on success
+ * @returns    <0 on error
+ */
+int nanocoap_get_blockwise(sock_udp_ep_t *remote, const char *path,
+                           coap_blksize_t blksize, unsigned window,
+                           coap_blockwise_cb_t callback, void *arg);
+
 #ifdef __cplusplus
 }
 #endif
@@ -34,9 +34,21 @@ extern "C" {
 #define NETSTATS_LAYER2     (0x01)
 #define NETSTATS_IPV6       (0x02)
 #define NETSTATS_RPL        (0x03)
+#define NETSTATS_EXT        (0x04)
 #define NETSTATS_ALL        (0xFF)
 /** @} */
 
+/**
+ * @brief   Number of buckets of the latency histogram of @ref netstats_ext_t
+ *
+ * Bucket 0 counts latencies below 1us, bucket `i` latencies in
+ * [2^(i-1), 2^i) us and the last bucket all longer latencies. The default
+ * covers latencies up to half a second.
+ */
+#ifndef CONFIG_NETSTATS_EXT_LATENCY_BUCKETS
+#define CONFIG_NETSTATS_EXT_LATENCY_BUCKETS (20U)
+#endif
+
 /**
  * @brief       Global statistics struct
  */
@@ -53,6 +65,83 @@ typedef struct {
     uint32_t rx_bytes;          /**< received bytes */
 } netstats_t;
 
+/**
+ * @brief   Causes of dropped packets counted by @ref netstats_ext_t
+ */
+typedef enum {
+    NETSTATS_DROP_PKTBUF,       /**< packet buffer exhausted */
+    NETSTATS_DROP_QUEUE,        /**< message queue or mailbox of the
+                                     receiving thread was full */
+    NETSTATS_DROP_FILTER,       /**< dropped by the link layer filter */
+    NETSTATS_DROP_NO_RECEIVER,  /**< nobody registered for the packet */
+    NETSTATS_DROP_INVALID,      /**< malformed frame or read error */
+    NETSTATS_DROP_NUMOF,        /**< number of drop causes */
+} netstats_drop_t;
+
+/**
+ * @brief   Extended statistics of a network interface
+ *
+ * Provided by the `netstats_ext` module. Retrieve them with
+ * @ref NETOPT_STATS and the context @ref NETSTATS_EXT.
+ *
+ * The counters are updated without locking, so a reader may see a torn
+ * 64-bit value on platforms without 64-bit stores, and concurrent updates
+ * from different threads may get lost. This keeps the cost per packet at a
+ * few increments.
+ */
+typedef struct {
+    uint64_t rx_count;          /**< received packets */
+    uint64_t rx_bytes;          /**< received bytes */
+    uint64_t tx_count;          /**< packets handed to the device */
+    uint64_t tx_bytes;          /**< sent bytes */
+    uint64_t tx_failed;         /**< failed sending operations */
+    uint64_t drops[NETSTATS_DROP_NUMOF];    /**< dropped packets by cause */
+    uint16_t netif_queue_max;   /**< high-water mark of the message queue
+                                     of the interface thread */
+    uint16_t sock_queue_max;    /**< high-water mark of the mailboxes of
+                                     the socks that received packets from
+                                     the interface */
+    /**
+     * @brief   Histogram of the latency in us from receiving a packet at
+     *          the interface to delivering it to a sock, see
+     *          @ref CONFIG_NETSTATS_EXT_LATENCY_BUCKETS
+     */
+    uint32_t latency[CONFIG_NETSTATS_EXT_LATENCY_BUCKETS];
+} netstats_ext_t;
+
+/**
+ * @brief   Adds a sample to the latency histogram of @p stats
+ *
+ * @param[in,out] stats     statistics to update
+ * @param[in]     usec      latency in us
+ */
+static inline void netstats_ext_add_latency(netstats_ext_t *stats,
+                                            uint32_t usec)
+{
+    /* number of significant bits, computed with a single instruction on
+     * most platforms */
+    unsigned bucket = (usec == 0) ? 0 : (8 * sizeof(unsigned long))
+                      - __builtin_clzl(usec);
+
+    if (bucket >= CONFIG_NETSTATS_EXT_LATENCY_BUCKETS) {
+        bucket = CONFIG_NETSTATS_EXT_LATENCY_BUCKETS - 1;
+    }
+    stats->latency[bucket]++;
+}
+
+/**
+ * @brief   Updates a queue high-water mark
+ *
+ * @param[in,out] max       high-water mark to update
+ * @param[in]     fill      current number of entries in the queue
+ */
+static inline void netstats_ext_queue_fill(uint16_t *max, unsigned fill)
+{
+    if (fill > *max) {
+        *max = fill;
+    }
+}
+
 #ifdef __cplusplus
 }
 #endif
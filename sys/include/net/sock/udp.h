@@ -300,6 +300,23 @@ typedef struct sock_udp sock_udp_t;
 # pragma clang diagnostic pop
 #endif
 
+/**
+ * @brief   A UDP message of a batched receive or send operation
+ *
+ * @see sock_udp_recv_many(), sock_udp_recv_buf_many(), sock_udp_send_many()
+ */
+typedef struct {
+    void *data;             /**< Payload or buffer space for the payload */
+    size_t len;             /**< Length of sock_udp_msg_t::data. On receive,
+                             *   space available at sock_udp_msg_t::data as
+                             *   input and the number of bytes received as
+                             *   output */
+    sock_udp_ep_t *remote;  /**< Remote end point. May be `NULL` */
+    void *buf_ctx;          /**< Stack-internal buffer context of
+                             *   @ref sock_udp_recv_buf_many(). Must be
+                             *   `NULL` before the first call */
+} sock_udp_msg_t;
+
 /**
  * @brief   Creates a new UDP sock object
  *
@@ -494,6 +511,100 @@ ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
 ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
                       const sock_udp_ep_t *remote);
 
+/**
+ * @brief   Receives multiple UDP messages from remote end points
+ *
+ * Only waits for the first message. Following messages are only received
+ * if they are already available, so a burst of messages is received with a
+ * single call.
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (num > 0)`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  Buffer spaces for the messages. For every received
+ *                      message, sock_udp_msg_t::len is set to the number of
+ *                      bytes received and sock_udp_msg_t::remote, if not
+ *                      `NULL`, to the remote end point of the message.
+ * @param[in] num       Number of entries in @p msgs.
+ * @param[in] timeout   Timeout for receiving the first message in
+ *                      microseconds. If 0 and no data is available, the
+ *                      function returns immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @return  The number of messages received on success. Receiving stops at
+ *          the first error, which is only reported if it occurred for the
+ *          first message. It also stops before a following message, that
+ *          does not fit into its buffer space. That message is left for the
+ *          next call, which fails with -ENOBUFS for it like
+ *          @ref sock_udp_recv().
+ * @return  Any error of @ref sock_udp_recv() for the first message.
+ */
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_msg_t *msgs, unsigned num,
+                       uint32_t timeout);
+
+/**
+ * @brief   Provides stack-internal buffer spaces containing multiple UDP
+ *          messages from remote end points
+ *
+ * Zero-copy variant of @ref sock_udp_recv_many(). Every received message
+ * is provided as a single stack-internal buffer space in
+ * sock_udp_msg_t::data. The buffers stay valid until they are released by
+ * calling the function again with the same @p msgs.
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (num > 0)`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  Messages to fill. If sock_udp_msg_t::buf_ctx of the
+ *                      first entry is not `NULL`, the buffers of all entries
+ *                      are released instead.
+ * @param[in] num       Number of entries in @p msgs.
+ * @param[in] timeout   Timeout for receiving the first message in
+ *                      microseconds. If 0 and no data is available, the
+ *                      function returns immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @return  The number of messages received on success. Receiving stops at
+ *          the first error, which is only reported if it occurred for the
+ *          first message.
+ * @return  0, if the buffers of @p msgs were released.
+ * @return  Any error of @ref sock_udp_recv_buf() for the first message.
+ */
+int sock_udp_recv_buf_many(sock_udp_t *sock, sock_udp_msg_t *msgs,
+                           unsigned num, uint32_t timeout);
+
+/**
+ * @brief   Sends multiple UDP messages to remote end points
+ *
+ * @pre `((sock != NULL) || (msgs[i].remote != NULL) for all i) && (msgs != NULL)`
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`, see
+ *                      @ref sock_udp_send().
+ * @param[in] msgs      Messages to send. sock_udp_msg_t::remote may be `NULL`
+ *                      if @p sock has a remote end point.
+ * @param[in] num       Number of entries in @p msgs.
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @return  The number of messages sent on success. Sending stops at the
+ *          first error, which is only reported if it occurred for the first
+ *          message.
+ * @return  Any error of @ref sock_udp_send() for the first message.
+ */
+int sock_udp_send_many(sock_udp_t *sock, const sock_udp_msg_t *msgs,
+                       unsigned num);
+
 #include "sock_types.h"
 
 #ifdef __cplusplus
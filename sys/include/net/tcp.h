@@ -43,6 +43,9 @@ extern "C" {
 #define TCP_OPTION_KIND_EOL (0x00)  /**< "End of List"-Option */
 #define TCP_OPTION_KIND_NOP (0x01)  /**< "No Operation"-Option */
 #define TCP_OPTION_KIND_MSS (0x02)  /**< "Maximum Segment Size"-Option */
+#define TCP_OPTION_KIND_WS  (0x03)  /**< "Window Scale"-Option (RFC 7323) */
+#define TCP_OPTION_KIND_SACK_PERM (0x04)  /**< "SACK Permitted"-Option (RFC 2018) */
+#define TCP_OPTION_KIND_SACK      (0x05)  /**< "SACK"-Option (RFC 2018) */
 /** @} */
 
 /**
@@ -51,8 +54,16 @@ extern "C" {
  */
 #define TCP_OPTION_LENGTH_MIN (2U)    /**< Minimum amount of bytes needed for an option with a length field */
 #define TCP_OPTION_LENGTH_MSS (0x04)  /**< MSS Option Size always 4 */
+#define TCP_OPTION_LENGTH_WS  (0x03)  /**< Window Scale Option Size always 3 */
+#define TCP_OPTION_LENGTH_SACK_PERM (0x02)  /**< SACK Permitted Option Size always 2 */
+#define TCP_OPTION_LENGTH_SACK_BLOCK (0x08) /**< Size of each block in a SACK Option */
 /** @} */
 
+/**
+ * @brief Largest shift count of the window scale option (RFC 7323).
+ */
+#define TCP_OPTION_WS_MAX (14U)
+
 /**
  * @brief TCP header definition
  */
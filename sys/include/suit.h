@@ -34,6 +34,7 @@
 #include <stdint.h>
 
 #include "cose/sign.h"
+#include "hashes/sha256.h"
 #include "nanocbor/nanocbor.h"
 #include "uuid.h"
 #include "riotboot/flashwrite.h"
@@ -154,6 +155,7 @@ typedef struct {
     uint8_t validation_buf[SUIT_COSE_BUF_SIZE];
     char *urlbuf;                   /**< Buffer containing the manifest url */
     size_t urlbuf_len;              /**< Length of the manifest url */
+    sha256_context_t image_sha256;  /**< Digest of the image while fetching */
 } suit_manifest_t;
 
 /**
@@ -164,6 +166,14 @@ typedef struct {
  * @brief Bit flags used to determine if SUIT manifest contains an image
  */
 #define SUIT_MANIFEST_HAVE_IMAGE        (0x2)
+/**
+ * @brief Bit flag set if the digest of the image is calculated while
+ *        fetching it
+ *
+ * suit_flashwrite_helper() only updates suit_manifest_t::image_sha256 while
+ * this flag is set.
+ */
+#define SUIT_MANIFEST_HAVE_DIGEST       (0x4)
 
 /**
  * @brief Parse a manifest
@@ -199,6 +209,9 @@ int suit_policy_check(suit_manifest_t *manifest);
  * @param[in]   len     length of bytes to write
  * @param[in]   more    whether more data is coming
  *
+ * If @ref SUIT_MANIFEST_HAVE_DIGEST is set in the manifest state, @p buf is
+ * also added to suit_manifest_t::image_sha256.
+ *
  * @return              0 on success
  * @return              <0 on error
  */
@@ -25,7 +25,7 @@
 #ifndef SUIT_TRANSPORT_COAP_H
 #define SUIT_TRANSPORT_COAP_H
 
-#include "net/nanocoap.h"
+#include "net/nanocoap_sock.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -91,42 +91,41 @@ typedef const struct {
 } coap_resource_subtree_t;
 
 /**
- * @brief   Coap blockwise request callback descriptor
- *
- * @param[in] arg      Pointer to be passed as arguments to the callback
- * @param[in] offset   Offset of received data
- * @param[in] buf      Pointer to the received data
- * @param[in] len      Length of the received data
- * @param[in] more     -1 for no option, 0 for last block, 1 for more blocks
- *
- * @returns    0       on success
- * @returns   -1       on error
+ * @brief   Reference to the coap resource subtree
  */
-typedef int (*coap_blockwise_cb_t)(void *arg, size_t offset, uint8_t *buf, size_t len, int more);
+extern const coap_resource_subtree_t coap_resource_subtree_suit;
 
 /**
- * @brief   Reference to the coap resource subtree
+ * @brief   Block size requested when downloading manifests and firmware
+ *
+ * The server may answer with smaller blocks.
  */
-extern const coap_resource_subtree_t coap_resource_subtree_suit;
+#ifndef CONFIG_SUIT_COAP_BLOCKSIZE
+#define CONFIG_SUIT_COAP_BLOCKSIZE  COAP_BLOCKSIZE_256
+#endif
 
 /**
- * @brief Coap block-wise-transfer size SZX
+ * @brief   Number of block requests kept in flight during a download
+ *
+ * Every block in flight takes a buffer of the block size on the stack. The
+ * responses to a whole window may arrive at once, so they need to fit into
+ * the packet buffer of the network stack.
+ *
+ * @note    The default exceeds the NSTART of 1 that RFC 7252, section 4.7
+ *          recommends, i.e. the number of outstanding requests to a server.
+ *          Set it to 1 unless the update server is known to accept more.
  */
-typedef enum {
-    COAP_BLOCKSIZE_32 = 1,
-    COAP_BLOCKSIZE_64,
-    COAP_BLOCKSIZE_128,
-    COAP_BLOCKSIZE_256,
-    COAP_BLOCKSIZE_512,
-    COAP_BLOCKSIZE_1024,
-} coap_blksize_t;
+#ifndef CONFIG_SUIT_COAP_WINDOW
+#define CONFIG_SUIT_COAP_WINDOW     (4U)
+#endif
 
 /**
  * @brief    Performs a blockwise coap get request to the specified url.
  *
  * This function will fetch the content of the specified resource path via
- * block-wise-transfer. A coap_blockwise_cb_t will be called on each received
- * block.
+ * block-wise-transfer. Up to @ref CONFIG_SUIT_COAP_WINDOW blocks are requested
+ * at once, a coap_blockwise_cb_t will be called on each received block in
+ * order.
  *
  * @param[in]   url        url pointer to source path
  * @param[in]   blksize    sender suggested SZX for the COAP block request
@@ -174,6 +174,11 @@ typedef struct vfs_dir_ops vfs_dir_ops_t;
  */
 typedef struct vfs_file_system_ops vfs_file_system_ops_t;
 
+/**
+ * @brief struct @c vfs_poll_waiter typedef
+ */
+typedef struct vfs_poll_waiter vfs_poll_waiter_t;
+
 /**
  * @brief struct @c vfs_mount_struct typedef
  */
@@ -347,6 +352,24 @@ struct vfs_file_ops {
      */
     int (*open) (vfs_file_t *filp, const char *name, int flags, mode_t mode, const char *abs_path);
 
+    /**
+     * @brief Query the readiness of an open file
+     *
+     * Registers @p waiter with the file, replacing a waiter registered
+     * before. The waiter is notified each time the readiness of the file may
+     * have changed, until it is replaced or unregistered by passing NULL.
+     * After this function returns, a replaced waiter is not notified anymore.
+     * Closing the file unregisters the waiter and notifies it a last time.
+     *
+     * @param[in]  filp     pointer to open file
+     * @param[in]  waiter   waiter to notify, NULL to unregister the waiter
+     *
+     * @return POLLIN, POLLOUT, POLLERR and POLLHUP events of the file, see
+     *         man 3p poll
+     * @return <0 on error
+     */
+    int (*poll) (vfs_file_t *filp, vfs_poll_waiter_t *waiter);
+
     /**
      * @brief Read bytes from an open file
      *
@@ -420,6 +443,23 @@ struct vfs_dir_ops {
     int (*closedir) (vfs_DIR *dirp);
 };
 
+/**
+ * @brief Waiter notified when the readiness of an open file may have changed
+ *
+ * @see vfs_file_ops::poll
+ */
+struct vfs_poll_waiter {
+    /**
+     * @brief Notification callback
+     *
+     * @note Called in the context of the thread or interrupt changing the
+     *       readiness of the file, the callback must not block.
+     *
+     * @param[in]  waiter   the waiter itself
+     */
+    void (*cb)(vfs_poll_waiter_t *waiter);
+};
+
 /**
  * @brief Operations on mounted file systems
  *
@@ -603,6 +643,21 @@ int vfs_fcntl(int fd, int cmd, int arg);
  */
 int vfs_fstat(int fd, struct stat *buf);
 
+/**
+ * @brief Query the readiness of an open file
+ *
+ * @see vfs_file_ops::poll
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[in]  waiter   waiter to notify on changes, NULL to unregister the
+ *                      waiter registered before
+ *
+ * @return POLLIN, POLLOUT, POLLERR and POLLHUP events of the file
+ * @return -ENOTSUP if the driver can't report the readiness of the file
+ * @return <0 on error
+ */
+int vfs_poll(int fd, vfs_poll_waiter_t *waiter);
+
 /**
  * @brief Get file system status of the file system containing an open file
  *
@@ -122,6 +122,17 @@
  * (now() - B) + T[1]). Thus even though the list is keeping relative offsets,
  * the time keeping is done by keeping track of the absolute times.
  *
+ * Setting a timer has to walk the list up to the new timer's position, which
+ * becomes expensive with many pending timers. With the `ztimer_heap` module,
+ * a clock can instead keep its timers in a pairing heap by setting
+ * @ref ztimer_clock::use_heap before setting the first timer. Inserting a
+ * timer is then O(1), and removing a timer O(log n) amortized. Timers stored
+ * in the heap keep their absolute target time, and only expired timers are
+ * moved into the list, so the handling described above applies unchanged.
+ * For the default clocks this is enabled with `CONFIG_ZTIMER_USEC_HEAP` and
+ * `CONFIG_ZTIMER_MSEC_HEAP`. Timers with identical targets might trigger in a
+ * different order than they were set when using a heap.
+ *
  *
  * ## Clock extension
  *
@@ -214,6 +225,7 @@
 #ifndef ZTIMER_H
 #define ZTIMER_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "kernel_types.h"
@@ -237,8 +249,13 @@ typedef struct ztimer_clock ztimer_clock_t;
  * @brief   Minimum information for each timer
  */
 struct ztimer_base {
-    ztimer_base_t *next;        /**< next timer in list */
-    uint32_t offset;            /**< offset from last timer in list */
+    ztimer_base_t *next;        /**< next timer in list, next sibling in heap */
+    uint32_t offset;            /**< offset from last timer in list, absolute
+                                     target in heap */
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    ztimer_base_t *child;       /**< first child in heap */
+    ztimer_base_t *prev;        /**< parent or previous sibling in heap */
+#endif
 };
 
 #if MODULE_ZTIMER_NOW64
@@ -297,6 +314,10 @@ struct ztimer_clock {
     uint32_t lower_last;            /**< timer value at last now() call     */
     ztimer_now_t checkpoint;        /**< cumulated time at last now() call  */
 #endif
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    ztimer_base_t *heap;            /**< heap of timers not yet expired     */
+    bool use_heap;                  /**< keep timers in the heap            */
+#endif
 };
 
 /**
@@ -385,30 +385,16 @@ static int _find_resource(coap_pkt_t *pdu, const coap_resource_t **resource_ptr,
     }
 
     while (listener) {
-        const coap_resource_t *resource = listener->resources;
-        for (size_t i = 0; i < listener->resources_len; i++) {
-            if (i) {
-                resource++;
-            }
-
-            int res = coap_match_path(resource, uri);
-            if (res > 0) {
-                continue;
-            }
-            else if (res < 0) {
-                /* resources expected in alphabetical order */
-                break;
-            }
-            else {
-                if (! (resource->methods & method_flag)) {
-                    ret = GCOAP_RESOURCE_WRONG_METHOD;
-                    continue;
-                }
-
-                *resource_ptr = resource;
-                *listener_ptr = listener;
-                return GCOAP_RESOURCE_FOUND;
-            }
+        /* resources expected in alphabetical order */
+        int res = coap_find_resource(listener->resources,
+                                     listener->resources_len, uri,
+                                     method_flag, resource_ptr);
+        if (res == 0) {
+            *listener_ptr = listener;
+            return GCOAP_RESOURCE_FOUND;
+        }
+        else if (res == -EPERM) {
+            ret = GCOAP_RESOURCE_WRONG_METHOD;
         }
         listener = listener->next;
     }
@@ -416,6 +402,19 @@ static int _find_resource(coap_pkt_t *pdu, const coap_resource_t **resource_ptr,
     return ret;
 }
 
+#ifndef NDEBUG
+static bool _resources_sorted(const gcoap_listener_t *listener)
+{
+    for (size_t i = 1; i < listener->resources_len; i++) {
+        if (strcmp(listener->resources[i - 1].path,
+                   listener->resources[i].path) > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
 /*
  * Finds the memo for an outstanding request within the _coap_state.open_reqs
  * array. Matches on remote endpoint and token.
@@ -619,6 +618,9 @@ kernel_pid_t gcoap_init(void)
 
 void gcoap_register_listener(gcoap_listener_t *listener)
 {
+    /* resources are looked up by binary search */
+    assert(_resources_sorted(listener));
+
     /* Add the listener to the end of the linked list. */
     gcoap_listener_t *_last = _coap_state.listeners;
     while (_last->next) {
@@ -23,6 +23,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -163,6 +164,62 @@ int coap_match_path(const coap_resource_t *resource, uint8_t *uri)
     return res;
 }
 
+/* returns the first resource in [lo, hi) whose path has a character greater
+ * than (or equal to, if !upper) c at pos */
+static size_t _resource_bound(const coap_resource_t *resources, size_t lo,
+                              size_t hi, size_t pos, uint8_t c, bool upper)
+{
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        uint8_t m = resources[mid].path[pos];
+
+        if ((m < c) || (upper && (m == c))) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+int coap_find_resource(const coap_resource_t *resources, size_t resources_numof,
+                       const uint8_t *uri, coap_method_flags_t method_flag,
+                       const coap_resource_t **resource)
+{
+    assert(resources || !resources_numof);
+    assert(uri && resource);
+    size_t lo = 0, hi = resources_numof;
+    int res = -ENOENT;
+
+    /* All resources in [lo, hi) start with the first pos characters of the
+     * URI. Being sorted, those with a path of exactly these characters come
+     * first, and are the only ones that can match besides the ones narrowed
+     * down to for the following characters. As shorter paths sort first, the
+     * first match found is the first matching resource in the array. */
+    for (size_t pos = 0; lo < hi; pos++) {
+        for (; (lo < hi) && (resources[lo].path[pos] == '\0'); lo++) {
+            const coap_resource_t *r = &resources[lo];
+
+            if ((uri[pos] != '\0') && !(r->methods & COAP_MATCH_SUBTREE)) {
+                continue;
+            }
+            if (!(r->methods & method_flag)) {
+                res = -EPERM;
+                continue;
+            }
+            *resource = r;
+            return 0;
+        }
+        if (uri[pos] == '\0') {
+            break;
+        }
+        lo = _resource_bound(resources, lo, hi, pos, uri[pos], false);
+        hi = _resource_bound(resources, lo, hi, pos, uri[pos], true);
+    }
+    return res;
+}
+
 uint8_t *coap_find_option(const coap_pkt_t *pkt, unsigned opt_num)
 {
     const coap_optpos_t *optpos = pkt->options;
@@ -401,22 +458,10 @@ ssize_t coap_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
     }
     DEBUG("nanocoap: URI path: \"%s\"\n", uri);
 
-    for (unsigned i = 0; i < resources_numof; i++) {
-        const coap_resource_t *resource = &resources[i];
-        if (!(resource->methods & method_flag)) {
-            continue;
-        }
-
-        int res = coap_match_path(resource, uri);
-        if (res > 0) {
-            continue;
-        }
-        else if (res < 0) {
-            break;
-        }
-        else {
-            return resource->handler(pkt, resp_buf, resp_buf_len, resource->context);
-        }
+    const coap_resource_t *resource;
+    if (coap_find_resource(resources, resources_numof, uri, method_flag,
+                           &resource) == 0) {
+        return resource->handler(pkt, resp_buf, resp_buf_len, resource->context);
     }
 
     return coap_build_reply(pkt, COAP_CODE_404, resp_buf, resp_buf_len, 0);
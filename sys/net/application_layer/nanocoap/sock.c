@@ -20,12 +20,15 @@
  * @}
  */
 
+#include <assert.h>
 #include <errno.h>
+#include <inttypes.h>
 #include <string.h>
 #include <stdio.h>
 
 #include "net/nanocoap_sock.h"
 #include "net/sock/udp.h"
+#include "xtimer.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
@@ -118,6 +121,247 @@ ssize_t nanocoap_get(sock_udp_ep_t *remote, const char *path, uint8_t *buf, size
     return res;
 }
 
+static inline uint32_t _now(void)
+{
+    return xtimer_now_usec();
+}
+
+static inline uint32_t deadline_from_interval(int32_t interval)
+{
+    assert(interval >= 0);
+    return _now() + (uint32_t)interval;
+}
+
+static inline uint32_t deadline_left(uint32_t deadline)
+{
+    int32_t left = (int32_t)(deadline - _now());
+
+    if (left < 0) {
+        left = 0;
+    }
+    return left;
+}
+
+/* state of a block request within the window */
+enum {
+    _BLOCK_FREE,            /**< slot unused */
+    _BLOCK_SENT,            /**< request sent, waiting for the response */
+    _BLOCK_DONE,            /**< response received */
+};
+
+typedef struct {
+    uint32_t deadline;      /**< retransmission deadline */
+    uint32_t timeout;       /**< current retransmission timeout */
+    size_t offset;          /**< offset of the payload */
+    uint16_t len;           /**< payload length */
+    uint8_t tries_left;     /**< transmissions left */
+    uint8_t state;          /**< _BLOCK_FREE, _BLOCK_SENT or _BLOCK_DONE */
+    int8_t more;            /**< more flag of the Block2 option */
+    int8_t failed;          /**< the server did not answer with 2.05 */
+} _block_req_t;
+
+static int _send_block_request(uint8_t *buf, sock_udp_t *sock,
+                               const char *path, coap_blksize_t blksize,
+                               uint32_t num)
+{
+    uint8_t *pktpos = buf;
+
+    /* the message id is derived from the block number, so retransmissions
+     * of a request keep their id */
+    pktpos += coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_CON, NULL, 0,
+                             COAP_METHOD_GET, num);
+    pktpos += coap_opt_put_uri_path(pktpos, 0, path);
+    pktpos +=
+        coap_opt_put_uint(pktpos, COAP_OPT_URI_PATH, COAP_OPT_BLOCK2,
+                          (num << 4) | blksize);
+
+    ssize_t res = sock_udp_send(sock, buf, pktpos - buf, NULL);
+    if (res <= 0) {
+        DEBUG("nanocoap: error sending coap request, %d\n", (int)res);
+        return (res < 0) ? res : -EIO;
+    }
+    return 0;
+}
+
+static int _retransmit(_block_req_t *reqs, unsigned window, uint8_t *buf,
+                       sock_udp_t *sock, const char *path,
+                       coap_blksize_t blksize, uint32_t first, uint32_t last)
+{
+    for (uint32_t num = first; num < last; num++) {
+        _block_req_t *req = &reqs[num % window];
+
+        if ((req->state != _BLOCK_SENT) || deadline_left(req->deadline)) {
+            continue;
+        }
+        DEBUG("nanocoap: timeout of block %" PRIu32 "\n", num);
+        if (--req->tries_left == 0) {
+            DEBUG("nanocoap: maximum retries reached\n");
+            return -ETIMEDOUT;
+        }
+        req->timeout *= 2;
+        req->deadline = deadline_from_interval(req->timeout);
+        int res = _send_block_request(buf, sock, path, blksize, num);
+        if (res < 0) {
+            return res;
+        }
+    }
+    return 0;
+}
+
+int nanocoap_get_blockwise(sock_udp_ep_t *remote, const char *path,
+                           coap_blksize_t blksize, unsigned window,
+                           coap_blockwise_cb_t callback, void *arg)
+{
+    assert(window > 0);
+
+    /* mmmmh dynamically sized arrays */
+    uint8_t buf[64 + (0x1 << (blksize + 4))];
+    uint8_t blocks[window][0x1 << (blksize + 4)];
+    _block_req_t reqs[window];
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    coap_pkt_t pkt;
+
+    /* HACK: use random local port */
+    local.port = 0x8000 + (xtimer_now_usec() % 0XFFF);
+
+    sock_udp_t sock;
+    int res = sock_udp_create(&sock, &local, remote, 0);
+    if (res < 0) {
+        return res;
+    }
+
+    memset(reqs, 0, sizeof(reqs));
+
+    /* blocks [next, requested) are in flight or waiting to be passed to the
+     * callback in order. Only the first block is requested until the server
+     * chose the block size, then up to window blocks at once. */
+    uint32_t next = 0;
+    uint32_t requested = 0;
+    uint32_t end = UINT32_MAX;
+    unsigned in_flight = 1;
+
+    while (1) {
+        while ((requested < end) && (requested < next + in_flight)) {
+            _block_req_t *req = &reqs[requested % window];
+
+            DEBUG("fetching block %" PRIu32 "\n", requested);
+            req->state = _BLOCK_SENT;
+            req->failed = 0;
+            /* add 1 for initial transmit */
+            req->tries_left = COAP_MAX_RETRANSMIT + 1;
+            /* TODO: timeout random between between ACK_TIMEOUT and
+             * (ACK_TIMEOUT * ACK_RANDOM_FACTOR) */
+            req->timeout = COAP_ACK_TIMEOUT * US_PER_SEC;
+            req->deadline = deadline_from_interval(req->timeout);
+            res = _send_block_request(buf, &sock, path, blksize, requested);
+            if (res < 0) {
+                goto err;
+            }
+            requested++;
+        }
+
+        _block_req_t *req = &reqs[next % window];
+        if (req->state == _BLOCK_DONE) {
+            if (req->failed) {
+                DEBUG("error fetching block\n");
+                goto err;
+            }
+            if (callback(arg, req->offset,
+                         blocks[next % window], req->len,
+                         req->more)) {
+                DEBUG("callback res != 0, aborting.\n");
+                goto err;
+            }
+            req->state = _BLOCK_FREE;
+            next++;
+            if (req->more != 1) {
+                res = 0;
+                goto out;
+            }
+            continue;
+        }
+
+        /* wait until the first retransmission is due, requests beyond the
+         * last block are not repeated */
+        uint32_t last = (requested < end) ? requested : end;
+        uint32_t timeout = UINT32_MAX;
+        for (uint32_t num = next; num < last; num++) {
+            _block_req_t *sent = &reqs[num % window];
+            if (sent->state == _BLOCK_SENT) {
+                uint32_t left = deadline_left(sent->deadline);
+                if (left < timeout) {
+                    timeout = left;
+                }
+            }
+        }
+
+        res = sock_udp_recv(&sock, buf, sizeof(buf), timeout, NULL);
+        if ((res == -ETIMEDOUT) || (res == -EAGAIN)) {
+            res = _retransmit(reqs, window, buf, &sock, path, blksize,
+                              next, last);
+            if (res < 0) {
+                goto err;
+            }
+            continue;
+        }
+        else if (res < 0) {
+            DEBUG("nanocoap: error receiving coap response, %d\n", (int)res);
+            if (res == -ENOBUFS) {
+                continue;
+            }
+            goto err;
+        }
+        if (coap_parse(&pkt, buf, res) < 0) {
+            DEBUG("nanocoap: error parsing packet\n");
+            continue;
+        }
+
+        /* map the 16 bit message id back to a block in flight */
+        uint32_t num = next + (uint16_t)(coap_get_id(&pkt) - (uint16_t)next);
+        req = &reqs[num % window];
+        if ((num >= requested) || (req->state != _BLOCK_SENT)) {
+            /* duplicate or unrelated response */
+            continue;
+        }
+        req->state = _BLOCK_DONE;
+
+        DEBUG("code=%i\n", coap_get_code(&pkt));
+        coap_block1_t block2;
+        coap_get_block2(&pkt, &block2);
+        if ((coap_get_code(&pkt) != 205) ||
+            ((block2.more >= 0) && (block2.blknum != num)) ||
+            (pkt.payload_len > sizeof(blocks[0]))) {
+            /* only an error if the block is needed, requests beyond the
+             * last block fail */
+            req->failed = 1;
+            continue;
+        }
+
+        if ((num == 0) && (block2.more >= 0)) {
+            /* the server may choose a smaller block size */
+            if (block2.szx < blksize) {
+                blksize = block2.szx;
+            }
+            in_flight = window;
+        }
+        if (block2.more != 1) {
+            end = num + 1;
+        }
+
+        memcpy(blocks[num % window], pkt.payload,
+               pkt.payload_len);
+        req->offset = block2.offset;
+        req->len = pkt.payload_len;
+        req->more = block2.more;
+    }
+
+err:
+    res = -1;
+out:
+    sock_udp_close(&sock);
+    return res;
+}
+
 int nanocoap_server(sock_udp_ep_t *local, uint8_t *buf, size_t bufsize)
 {
     sock_udp_t sock;
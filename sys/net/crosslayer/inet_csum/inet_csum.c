@@ -13,13 +13,111 @@
  */
 
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+#if __SIZEOF_POINTER__ >= 4
+/* word types that may alias the byte buffer */
+typedef uint16_t __attribute__((may_alias)) _u16_alias_t;
+typedef uint32_t __attribute__((may_alias)) _u32_alias_t;
+
+/* Returns the 16-bit word in host byte order that has @p byte at memory
+ * offset @p pos and zero in the other half */
+static inline uint16_t _byte_word(uint8_t byte, unsigned pos)
+{
+    uint8_t tmp[2] = { 0, 0 };
+    uint16_t word;
+
+    tmp[pos] = byte;
+    memcpy(&word, tmp, sizeof(word));
+    return word;
+}
+
+/*
+ * Sums up @p buf as big-endian 16-bit words, with an odd last byte as the top
+ * half of a word. The one's complement sum is independent of byte order as long
+ * as all words are swapped the same way, so the buffer is summed in host byte
+ * order using aligned 32-bit loads into a 64-bit accumulator and only the
+ * folded result is converted. If @p buf starts at an odd address, the words
+ * are loaded shifted by one byte, which the final byte swap compensates.
+ */
+static uint16_t _sum_be16(const uint8_t *buf, uint16_t len)
+{
+    uint64_t acc = 0;
+    bool odd = (uintptr_t)buf & 1;
+    uint16_t res;
+
+    if (len == 0) {
+        return 0;
+    }
+    if (odd) {
+        /* first byte is the top half of a big-endian word but is the low half
+         * of the (shifted) word at the aligned address */
+        acc += _byte_word(*buf, 1);
+        buf++;
+        len--;
+    }
+    if (((uintptr_t)buf & 2) && (len >= 2)) {
+        acc += *(const _u16_alias_t *)buf;
+        buf += 2;
+        len -= 2;
+    }
+    while (len >= 16) {
+        const _u32_alias_t *words = (const _u32_alias_t *)buf;
+
+        acc += (uint64_t)words[0] + words[1] + words[2] + words[3];
+        buf += 16;
+        len -= 16;
+    }
+    while (len >= 4) {
+        acc += *(const _u32_alias_t *)buf;
+        buf += 4;
+        len -= 4;
+    }
+    if (len >= 2) {
+        acc += *(const _u16_alias_t *)buf;
+        buf += 2;
+        len -= 2;
+    }
+    if (len) {
+        acc += _byte_word(*buf, 0);
+    }
+
+    acc = (acc >> 32) + (acc & 0xffffffff);
+    acc = (acc >> 32) + (acc & 0xffffffff);
+    acc = (acc >> 16) + (acc & 0xffff);
+    acc = (acc >> 16) + (acc & 0xffff);
+    res = ntohs((uint16_t)acc);
+
+    return (odd) ? byteorder_swaps(res) : res;
+}
+#else
+/* 8- and 16-bit platforms gain nothing from wider loads */
+static uint32_t _sum_be16(const uint8_t *buf, uint16_t len)
+{
+    uint32_t csum = 0;
+
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
+                                                    /* and add them */
+    }
+
+    if (len & 1) {                      /* if length is odd */
+        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
+    }
+
+    return csum;
+}
+#endif
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -41,16 +139,9 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         csum += *buf;         /* add first byte as bottom half of 16-byte word */
         buf++;
         len--;
-        accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
-    }
-
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
+    csum += _sum_be16(buf, len);
 
     while (csum >> 16) {
         uint16_t carry = csum >> 16;
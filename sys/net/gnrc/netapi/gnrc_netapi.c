@@ -19,12 +19,17 @@
  */
 
 #include <errno.h>
+#include <stdbool.h>
 
+#include "irq.h"
 #include "mbox.h"
 #include "msg.h"
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/netapi.h"
+#ifdef MODULE_NETSTATS_EXT
+#include "net/gnrc/netif.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -50,9 +55,76 @@ int _gnrc_netapi_get_set(kernel_pid_t pid, netopt_t opt, uint16_t context,
     return (int)ack.content.value;
 }
 
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+static gnrc_netapi_direct_t *_direct[KERNEL_PID_LAST + 1];
+
+void gnrc_netapi_direct_register(gnrc_netapi_direct_t *direct,
+                                 gnrc_netapi_direct_handler_t handler)
+{
+    mutex_init(&direct->lock);
+    direct->owner = KERNEL_PID_UNDEF;
+    direct->handler = handler;
+    cib_init(&direct->deferred_idx, CONFIG_GNRC_NETAPI_DIRECT_DEFER_SIZE);
+    _direct[thread_getpid()] = direct;
+}
+
+void gnrc_netapi_direct_lock(gnrc_netapi_direct_t *direct)
+{
+    mutex_lock(&direct->lock);
+    direct->owner = thread_getpid();
+}
+
+void gnrc_netapi_direct_unlock(gnrc_netapi_direct_t *direct)
+{
+    int idx;
+
+    while ((idx = cib_get(&direct->deferred_idx)) >= 0) {
+        direct->handler(direct->deferred[idx].type,
+                        direct->deferred[idx].content.ptr);
+    }
+    /* reset before unlocking, so no other thread can find itself as owner */
+    direct->owner = KERNEL_PID_UNDEF;
+    mutex_unlock(&direct->lock);
+}
+
+static bool _direct_call(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type)
+{
+    gnrc_netapi_direct_t *direct;
+
+    if (!pid_is_valid(pid) || irq_is_in() || ((direct = _direct[pid]) == NULL)) {
+        return false;
+    }
+    if (direct->owner == thread_getpid()) {
+        /* this thread is within the module's handler already */
+        int idx = cib_put(&direct->deferred_idx);
+
+        if (idx < 0) {
+            return false;
+        }
+        direct->deferred[idx].type = type;
+        direct->deferred[idx].content.ptr = pkt;
+        return true;
+    }
+    /* another thread is within the module's handler, so fall back to its
+     * queue */
+    if (!mutex_trylock(&direct->lock)) {
+        return false;
+    }
+    direct->owner = thread_getpid();
+    direct->handler(type, pkt);
+    gnrc_netapi_direct_unlock(direct);
+    return true;
+}
+#endif
+
 int _gnrc_netapi_send_recv(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type)
 {
     msg_t msg;
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+    if (_direct_call(pid, pkt, type)) {
+        return 1;
+    }
+#endif
     /* set the outgoing message's fields */
     msg.type = type;
     msg.content.ptr = (void *)pkt;
@@ -61,6 +133,11 @@ int _gnrc_netapi_send_recv(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type)
     if (ret < 1) {
         DEBUG("gnrc_netapi: dropped message to %" PRIkernel_pid " (%s)\n", pid,
               (ret == 0) ? "receiver queue is full" : "invalid receiver");
+#ifdef MODULE_NETSTATS_EXT
+        if (ret == 0) {
+            gnrc_netif_stats_drop(pkt, NETSTATS_DROP_QUEUE);
+        }
+#endif
     }
     return ret;
 }
@@ -76,6 +153,9 @@ static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt
     int ret = mbox_try_put(mbox, &msg);
     if (ret < 1) {
         DEBUG("gnrc_netapi: dropped message to %p (was full)\n", (void*)mbox);
+#ifdef MODULE_NETSTATS_EXT
+        gnrc_netif_stats_drop(pkt, NETSTATS_DROP_QUEUE);
+#endif
     }
     return ret;
 }
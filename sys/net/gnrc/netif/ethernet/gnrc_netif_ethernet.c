@@ -15,6 +15,7 @@
  * @author  Kaspar Schleiser <kaspar@schleiser.de>
  */
 
+#include <assert.h>
 #include <string.h>
 
 #include "net/ethernet/hdr.h"
@@ -32,6 +33,10 @@
 #endif
 
 static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
+#if CONFIG_GNRC_NETIF_TX_BATCH_SIZE > 1U
+static int _send_batch(gnrc_netif_t *netif, gnrc_pktsnip_t *pkts[],
+                       unsigned num);
+#endif
 static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif);
 #ifdef MODULE_GNRC_SIXLOENC
 static int _set(gnrc_netif_t *netif, const gnrc_netapi_opt_t *opt);
@@ -47,6 +52,9 @@ static const gnrc_netif_ops_t ethernet_ops = {
     .recv = _recv,
     .get = gnrc_netif_get_from_netdev,
     .set = _set,
+#if CONFIG_GNRC_NETIF_TX_BATCH_SIZE > 1U
+    .send_batch = _send_batch,
+#endif
 };
 
 int gnrc_netif_ethernet_create(gnrc_netif_t *netif, char *stack, int stacksize,
@@ -79,12 +87,11 @@ static inline void _addr_set_multicast(uint8_t *dst, gnrc_pktsnip_t *payload)
     }
 }
 
-static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+static int _set_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
+                    ethernet_hdr_t *hdr)
 {
-    ethernet_hdr_t hdr;
     gnrc_netif_hdr_t *netif_hdr;
     gnrc_pktsnip_t *payload;
-    int res;
 
     netdev_t *dev = netif->dev;
 
@@ -101,25 +108,25 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     }
 
     if (payload) {
-        hdr.type = byteorder_htons(gnrc_nettype_to_ethertype(payload->type));
+        hdr->type = byteorder_htons(gnrc_nettype_to_ethertype(payload->type));
     }
     else {
-        hdr.type = byteorder_htons(ETHERTYPE_UNKNOWN);
+        hdr->type = byteorder_htons(ETHERTYPE_UNKNOWN);
     }
 
     netif_hdr = pkt->data;
 
     /* set ethernet header */
     if (netif_hdr->src_l2addr_len == ETHERNET_ADDR_LEN) {
-        memcpy(hdr.dst, gnrc_netif_hdr_get_src_addr(netif_hdr),
+        memcpy(hdr->dst, gnrc_netif_hdr_get_src_addr(netif_hdr),
                netif_hdr->src_l2addr_len);
     }
     else {
-        dev->driver->get(dev, NETOPT_ADDRESS, hdr.src, ETHERNET_ADDR_LEN);
+        dev->driver->get(dev, NETOPT_ADDRESS, hdr->src, ETHERNET_ADDR_LEN);
     }
 
     if (netif_hdr->flags & GNRC_NETIF_HDR_FLAGS_BROADCAST) {
-        _addr_set_broadcast(hdr.dst);
+        _addr_set_broadcast(hdr->dst);
     }
     else if (netif_hdr->flags & GNRC_NETIF_HDR_FLAGS_MULTICAST) {
         if (payload == NULL) {
@@ -127,10 +134,10 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
                   "are not yet supported\n");
             return -ENOTSUP;
         }
-        _addr_set_multicast(hdr.dst, payload);
+        _addr_set_multicast(hdr->dst, payload);
     }
     else if (netif_hdr->dst_l2addr_len == ETHERNET_ADDR_LEN) {
-        memcpy(hdr.dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+        memcpy(hdr->dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
                ETHERNET_ADDR_LEN);
     }
     else {
@@ -140,14 +147,8 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     }
 
     DEBUG("gnrc_netif_ethernet: send to %02x:%02x:%02x:%02x:%02x:%02x\n",
-          hdr.dst[0], hdr.dst[1], hdr.dst[2],
-          hdr.dst[3], hdr.dst[4], hdr.dst[5]);
-
-    iolist_t iolist = {
-        .iol_next = (iolist_t *)payload,
-        .iol_base = &hdr,
-        .iol_len = sizeof(ethernet_hdr_t)
-    };
+          hdr->dst[0], hdr->dst[1], hdr->dst[2],
+          hdr->dst[3], hdr->dst[4], hdr->dst[5]);
 
 #ifdef MODULE_NETSTATS_L2
     if ((netif_hdr->flags & GNRC_NETIF_HDR_FLAGS_BROADCAST) ||
@@ -158,6 +159,26 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         netif->stats.tx_unicast_count++;
     }
 #endif
+    return 0;
+}
+
+static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    ethernet_hdr_t hdr;
+    int res;
+
+    netdev_t *dev = netif->dev;
+
+    if ((res = _set_hdr(netif, pkt, &hdr)) < 0) {
+        return res;
+    }
+
+    iolist_t iolist = {
+        .iol_next = (iolist_t *)pkt->next,
+        .iol_base = &hdr,
+        .iol_len = sizeof(ethernet_hdr_t)
+    };
+
     res = dev->driver->send(dev, &iolist);
 
     gnrc_pktbuf_release(pkt);
@@ -165,6 +186,63 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     return res;
 }
 
+#if CONFIG_GNRC_NETIF_TX_BATCH_SIZE > 1U
+static int _send_batch(gnrc_netif_t *netif, gnrc_pktsnip_t *pkts[],
+                       unsigned num)
+{
+    ethernet_hdr_t hdrs[CONFIG_GNRC_NETIF_TX_BATCH_SIZE];
+    iolist_t iolists[CONFIG_GNRC_NETIF_TX_BATCH_SIZE];
+    const iolist_t *frames[CONFIG_GNRC_NETIF_TX_BATCH_SIZE];
+    unsigned frames_numof = 0;
+    int res = 0;
+
+    netdev_t *dev = netif->dev;
+
+    assert(num <= CONFIG_GNRC_NETIF_TX_BATCH_SIZE);
+    for (unsigned i = 0; i < num; i++) {
+        int err = _set_hdr(netif, pkts[i], &hdrs[frames_numof]);
+
+        if (err < 0) {
+            DEBUG("gnrc_netif_ethernet: dropping packet %p (code: %i)\n",
+                  (void *)pkts[i], err);
+            res = err;
+            continue;
+        }
+        iolists[frames_numof].iol_next = (iolist_t *)pkts[i]->next;
+        iolists[frames_numof].iol_base = &hdrs[frames_numof];
+        iolists[frames_numof].iol_len = sizeof(ethernet_hdr_t);
+        frames[frames_numof] = &iolists[frames_numof];
+        frames_numof++;
+    }
+
+    if (frames_numof > 0) {
+        if (dev->driver->send_batch) {
+            res = dev->driver->send_batch(dev, frames, frames_numof);
+        }
+        else {
+            res = 0;
+            for (unsigned i = 0; i < frames_numof; i++) {
+                int sent = dev->driver->send(dev, frames[i]);
+
+                if (sent < 0) {
+                    res = (i == 0) ? sent : res;
+                    break;
+                }
+                res += sent;
+            }
+        }
+    }
+
+    for (unsigned i = 0; i < num; i++) {
+        if (pkts[i] != NULL) {
+            gnrc_pktbuf_release(pkts[i]);
+        }
+    }
+
+    return res;
+}
+#endif  /* CONFIG_GNRC_NETIF_TX_BATCH_SIZE > 1U */
+
 static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 {
     netdev_t *dev = netif->dev;
@@ -178,6 +256,7 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 
         if (!pkt) {
             DEBUG("gnrc_netif_ethernet: cannot allocate pktsnip.\n");
+            gnrc_netif_stats_ext_drop(netif, NETSTATS_DROP_PKTBUF);
 
             /* drop the packet */
             dev->driver->recv(dev, NULL, bytes_expected, NULL);
@@ -188,6 +267,7 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
         int nread = dev->driver->recv(dev, pkt->data, bytes_expected, NULL);
         if (nread <= 0) {
             DEBUG("gnrc_netif_ethernet: read error.\n");
+            gnrc_netif_stats_ext_drop(netif, NETSTATS_DROP_INVALID);
             goto safe_out;
         }
 #ifdef MODULE_NETSTATS_L2
@@ -213,6 +293,7 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
         gnrc_pktsnip_t *eth_hdr = gnrc_pktbuf_mark(pkt, sizeof(ethernet_hdr_t), GNRC_NETTYPE_UNDEF);
         if (!eth_hdr) {
             DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
+            gnrc_netif_stats_ext_drop(netif, NETSTATS_DROP_PKTBUF);
             goto safe_out;
         }
 
@@ -221,6 +302,7 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 #ifdef MODULE_L2FILTER
         if (!l2filter_pass(dev->filter, hdr->src, ETHERNET_ADDR_LEN)) {
             DEBUG("gnrc_netif_ethernet: incoming packet filtered by l2filter\n");
+            gnrc_netif_stats_ext_drop(netif, NETSTATS_DROP_FILTER);
             goto safe_out;
         }
 #endif
@@ -236,6 +318,7 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 
         if (netif_hdr == NULL) {
             DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
+            gnrc_netif_stats_ext_drop(netif, NETSTATS_DROP_PKTBUF);
             pkt = eth_hdr;
             goto safe_out;
         }
@@ -29,6 +29,9 @@
 #ifdef MODULE_NETSTATS
 #include "net/netstats.h"
 #endif
+#ifdef MODULE_NETSTATS_EXT
+#include "net/gnrc/netif/hdr.h"
+#endif
 #include "fmt.h"
 #include "log.h"
 #include "sched.h"
@@ -40,6 +43,10 @@
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+/* batching would bypass the minimum wait time between sends */
+#define _TX_BATCH   ((CONFIG_GNRC_NETIF_TX_BATCH_SIZE > 1U) && \
+                     (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US == 0U))
+
 static void _update_l2addr_from_dev(gnrc_netif_t *netif);
 static void _configure_netdev(netdev_t *dev);
 static void *_gnrc_netif_thread(void *args);
@@ -137,6 +144,13 @@ int gnrc_netif_get_from_netdev(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt)
                     *((netstats_t **)opt->data) = &netif->stats;
                     res = sizeof(&netif->stats);
                     break;
+#endif
+#ifdef MODULE_NETSTATS_EXT
+                case NETSTATS_EXT:
+                    assert(opt->data_len == sizeof(netstats_ext_t *));
+                    *((netstats_ext_t **)opt->data) = &netif->stats_ext;
+                    res = sizeof(&netif->stats_ext);
+                    break;
 #endif
                 default:
                     /* take from device */
@@ -389,6 +403,48 @@ gnrc_netif_t *gnrc_netif_get_by_pid(kernel_pid_t pid)
     return NULL;
 }
 
+#ifdef MODULE_NETSTATS_EXT
+void gnrc_netif_stats_drop(gnrc_pktsnip_t *pkt, netstats_drop_t reason)
+{
+    gnrc_pktsnip_t *hdr = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+
+    if (hdr != NULL) {
+        gnrc_netif_t *netif;
+
+        netif = gnrc_netif_get_by_pid(((gnrc_netif_hdr_t *)hdr->data)->if_pid);
+        if (netif != NULL) {
+            netif->stats_ext.drops[reason]++;
+        }
+    }
+}
+
+static void _stats_ext_sent(gnrc_netif_t *netif, unsigned num, int res)
+{
+    if (res < 0) {
+        netif->stats_ext.tx_failed += num;
+    }
+    else {
+        netif->stats_ext.tx_count += num;
+        netif->stats_ext.tx_bytes += res;
+    }
+}
+
+static void _stats_ext_received(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
+                                uint32_t rx_time)
+{
+    gnrc_pktsnip_t *hdr = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+    size_t len = gnrc_pkt_len(pkt);
+
+    if (hdr != NULL) {
+        /* stamp the packet for the latency histogram */
+        ((gnrc_netif_hdr_t *)hdr->data)->rx_time = rx_time;
+        len -= hdr->size;
+    }
+    netif->stats_ext.rx_count++;
+    netif->stats_ext.rx_bytes += len;
+}
+#endif /* MODULE_NETSTATS_EXT */
+
 char *gnrc_netif_addr_to_str(const uint8_t *addr, size_t addr_len, char *out)
 {
     char *res = out;
@@ -1348,6 +1404,53 @@ void gnrc_netif_default_init(gnrc_netif_t *netif)
 #endif
 }
 
+#if _TX_BATCH
+/**
+ * @brief   Sends the packet of @p msg together with the packets of the send
+ *          requests queued up behind it
+ *
+ * @param[in] netif The network interface.
+ * @param[in,out] msg   The send request. Holds the first message that was not
+ *                      a send request on return, if there was one.
+ *
+ * @return  true, if @p msg holds a message that still needs to be handled.
+ * @return  false, if all received messages were handled.
+ */
+static bool _send_batch(gnrc_netif_t *netif, msg_t *msg)
+{
+    gnrc_pktsnip_t *pkts[CONFIG_GNRC_NETIF_TX_BATCH_SIZE];
+    unsigned num = 0;
+    bool pending = false;
+    int res;
+
+    pkts[num++] = msg->content.ptr;
+    while ((num < CONFIG_GNRC_NETIF_TX_BATCH_SIZE) &&
+           (msg_try_receive(msg) == 1)) {
+        if (msg->type != GNRC_NETAPI_MSG_TYPE_SND) {
+            /* keep order: send the batch before handling this message */
+            pending = true;
+            break;
+        }
+        pkts[num++] = msg->content.ptr;
+    }
+    DEBUG("gnrc_netif: sending batch of %u packets\n", num);
+    res = netif->ops->send_batch(netif, pkts, num);
+    if (res < 0) {
+        DEBUG("gnrc_netif: error sending batch of %u packets (code: %i)\n",
+              num, res);
+    }
+#ifdef MODULE_NETSTATS_L2
+    else {
+        netif->stats.tx_bytes += res;
+    }
+#endif
+#ifdef MODULE_NETSTATS_EXT
+    _stats_ext_sent(netif, num, res);
+#endif
+    return pending;
+}
+#endif  /* _TX_BATCH */
+
 static void *_gnrc_netif_thread(void *args)
 {
     gnrc_netapi_opt_t *opt;
@@ -1356,6 +1459,7 @@ static void *_gnrc_netif_thread(void *args)
     int res;
     msg_t reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK };
     msg_t msg, msg_queue[CONFIG_GNRC_NETIF_MSG_QUEUE_SIZE];
+    bool msg_pending = false;
 
     DEBUG("gnrc_netif: starting thread %i\n", sched_active_pid);
     netif = args;
@@ -1386,6 +1490,9 @@ static void *_gnrc_netif_thread(void *args)
 #endif
 #ifdef MODULE_NETSTATS_L2
     memset(&netif->stats, 0, sizeof(netstats_t));
+#endif
+#ifdef MODULE_NETSTATS_EXT
+    memset(&netif->stats_ext, 0, sizeof(netstats_ext_t));
 #endif
     /* now let rest of GNRC use the interface */
     gnrc_netif_release(netif);
@@ -1394,8 +1501,19 @@ static void *_gnrc_netif_thread(void *args)
 #endif
 
     while (1) {
-        DEBUG("gnrc_netif: waiting for incoming messages\n");
-        msg_receive(&msg);
+        if (msg_pending) {
+            /* message left over from collecting a batch of send requests */
+            msg_pending = false;
+        }
+        else {
+            DEBUG("gnrc_netif: waiting for incoming messages\n");
+            msg_receive(&msg);
+#ifdef MODULE_NETSTATS_EXT
+            /* the received message counts as well */
+            netstats_ext_queue_fill(&netif->stats_ext.netif_queue_max,
+                                    msg_avail() + 1);
+#endif
+        }
         /* dispatch netdev, MAC and gnrc_netapi messages */
         switch (msg.type) {
             case NETDEV_MSG_TYPE_EVENT:
@@ -1404,6 +1522,12 @@ static void *_gnrc_netif_thread(void *args)
                 break;
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
+#if _TX_BATCH
+                if (netif->ops->send_batch) {
+                    msg_pending = _send_batch(netif, &msg);
+                    break;
+                }
+#endif
                 res = netif->ops->send(netif, msg.content.ptr);
                 if (res < 0) {
                     DEBUG("gnrc_netif: error sending packet %p (code: %i)\n",
@@ -1414,6 +1538,9 @@ static void *_gnrc_netif_thread(void *args)
                     netif->stats.tx_bytes += res;
                 }
 #endif
+#ifdef MODULE_NETSTATS_EXT
+                _stats_ext_sent(netif, 1, res);
+#endif
 #if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
                 xtimer_periodic_wakeup(
                         &last_wakeup,
@@ -1477,6 +1604,9 @@ static void _pass_on_packet(gnrc_pktsnip_t *pkt)
     if (!gnrc_netapi_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL,
                                       pkt)) {
         DEBUG("gnrc_netif: unable to forward packet of type %i\n", pkt->type);
+#ifdef MODULE_NETSTATS_EXT
+        gnrc_netif_stats_drop(pkt, NETSTATS_DROP_NO_RECEIVER);
+#endif
         gnrc_pktbuf_release(pkt);
         return;
     }
@@ -1492,18 +1622,28 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
 
         if (msg_send(&msg, netif->pid) <= 0) {
             puts("gnrc_netif: possibly lost interrupt.");
+#ifdef MODULE_NETSTATS_EXT
+            netif->stats_ext.drops[NETSTATS_DROP_QUEUE]++;
+#endif
         }
     }
     else {
         DEBUG("gnrc_netif: event triggered -> %i\n", event);
         gnrc_pktsnip_t *pkt = NULL;
         switch (event) {
-            case NETDEV_EVENT_RX_COMPLETE:
+            case NETDEV_EVENT_RX_COMPLETE: {
+#ifdef MODULE_NETSTATS_EXT
+                uint32_t rx_time = xtimer_now_usec();
+#endif
                 pkt = netif->ops->recv(netif);
                 if (pkt) {
+#ifdef MODULE_NETSTATS_EXT
+                    _stats_ext_received(netif, pkt, rx_time);
+#endif
                     _pass_on_packet(pkt);
                 }
                 break;
+            }
 #ifdef MODULE_NETSTATS_L2
             case NETDEV_EVENT_TX_MEDIUM_BUSY:
                 /* we are the only ones supposed to touch this variable,
@@ -14,6 +14,7 @@
  */
 
 #include "net/gnrc/pktbuf.h"
+#include "net/gnrc/netif/internal.h"
 #include "net/gnrc/netif/raw.h"
 
 #define ENABLE_DEBUG    (0)
@@ -60,6 +61,7 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 
         if (!pkt) {
             DEBUG("gnrc_netif_raw: cannot allocate pktsnip.\n");
+            gnrc_netif_stats_ext_drop(netif, NETSTATS_DROP_PKTBUF);
             /* drop packet */
             dev->driver->recv(dev, NULL, bytes_expected, NULL);
             return pkt;
@@ -67,6 +69,7 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
         nread = dev->driver->recv(dev, pkt->data, bytes_expected, NULL);
         if (nread <= 1) {   /* we need at least 1 byte to identify IP version */
             DEBUG("gnrc_netif_raw: read error.\n");
+            gnrc_netif_stats_ext_drop(netif, NETSTATS_DROP_INVALID);
             gnrc_pktbuf_release(pkt);
             return NULL;
         }
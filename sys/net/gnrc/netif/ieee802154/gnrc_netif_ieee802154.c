@@ -105,12 +105,14 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
         pkt = gnrc_pktbuf_add(NULL, NULL, bytes_expected, GNRC_NETTYPE_UNDEF);
         if (pkt == NULL) {
             DEBUG("_recv_ieee802154: cannot allocate pktsnip.\n");
+            gnrc_netif_stats_ext_drop(netif, NETSTATS_DROP_PKTBUF);
             /* Discard packet on netdev device */
             dev->driver->recv(dev, NULL, bytes_expected, NULL);
             return NULL;
         }
         nread = dev->driver->recv(dev, pkt->data, bytes_expected, &rx_info);
         if (nread <= 0) {
+            gnrc_netif_stats_ext_drop(netif, NETSTATS_DROP_INVALID);
             gnrc_pktbuf_release(pkt);
             return NULL;
         }
@@ -125,6 +127,7 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
             gnrc_pktsnip_t *netif_snip = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
             if (netif_snip == NULL) {
                 DEBUG("_recv_ieee802154: no space left in packet buffer\n");
+                gnrc_netif_stats_ext_drop(netif, NETSTATS_DROP_PKTBUF);
                 gnrc_pktbuf_release(pkt);
                 return NULL;
             }
@@ -147,6 +150,7 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
              * unsigned */
             if ((mhr_len == 0) || ((size_t)nread < mhr_len)) {
                 DEBUG("_recv_ieee802154: illegally formatted frame received\n");
+                gnrc_netif_stats_ext_drop(netif, NETSTATS_DROP_INVALID);
                 gnrc_pktbuf_release(pkt);
                 return NULL;
             }
@@ -155,12 +159,14 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
             ieee802154_hdr = gnrc_pktbuf_mark(pkt, mhr_len, GNRC_NETTYPE_UNDEF);
             if (ieee802154_hdr == NULL) {
                 DEBUG("_recv_ieee802154: no space left in packet buffer\n");
+                gnrc_netif_stats_ext_drop(netif, NETSTATS_DROP_PKTBUF);
                 gnrc_pktbuf_release(pkt);
                 return NULL;
             }
             netif_hdr = _make_netif_hdr(ieee802154_hdr->data);
             if (netif_hdr == NULL) {
                 DEBUG("_recv_ieee802154: no space left in packet buffer\n");
+                gnrc_netif_stats_ext_drop(netif, NETSTATS_DROP_PKTBUF);
                 gnrc_pktbuf_release(pkt);
                 return NULL;
             }
@@ -173,6 +179,7 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
                 gnrc_pktbuf_release(pkt);
                 gnrc_pktbuf_release(netif_hdr);
                 DEBUG("_recv_ieee802154: packet dropped by l2filter\n");
+                gnrc_netif_stats_ext_drop(netif, NETSTATS_DROP_FILTER);
                 return NULL;
             }
 #endif
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <string.h>
+
+#include "fmt.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/stats_coap.h"
+#include "net/netstats.h"
+
+typedef struct {
+    coap_block_slicer_t slicer;
+    uint8_t *pos;
+} _writer_t;
+
+static const char *_drop_names[NETSTATS_DROP_NUMOF] = {
+    [NETSTATS_DROP_PKTBUF] = "pktbuf",
+    [NETSTATS_DROP_QUEUE] = "queue",
+    [NETSTATS_DROP_FILTER] = "filter",
+    [NETSTATS_DROP_NO_RECEIVER] = "no_rcv",
+    [NETSTATS_DROP_INVALID] = "invalid",
+};
+
+static void _put_str(_writer_t *w, const char *str)
+{
+    w->pos += coap_blockwise_put_bytes(&w->slicer, w->pos,
+                                       (const uint8_t *)str, strlen(str));
+}
+
+static void _put_u64(_writer_t *w, uint64_t val)
+{
+    char tmp[20];   /* UINT64_MAX has 20 digits */
+
+    w->pos += coap_blockwise_put_bytes(&w->slicer, w->pos, (uint8_t *)tmp,
+                                       fmt_u64_dec(tmp, val));
+}
+
+static void _put_netif(_writer_t *w, const gnrc_netif_t *netif)
+{
+    const netstats_ext_t *stats = &netif->stats_ext;
+
+    _put_str(w, "{\"if\":");
+    _put_u64(w, netif->pid);
+    _put_str(w, ",\"rx\":[");
+    _put_u64(w, stats->rx_count);
+    _put_str(w, ",");
+    _put_u64(w, stats->rx_bytes);
+    _put_str(w, "],\"tx\":[");
+    _put_u64(w, stats->tx_count);
+    _put_str(w, ",");
+    _put_u64(w, stats->tx_bytes);
+    _put_str(w, ",");
+    _put_u64(w, stats->tx_failed);
+    _put_str(w, "],\"drops\":{");
+    for (unsigned i = 0; i < NETSTATS_DROP_NUMOF; i++) {
+        _put_str(w, (i == 0) ? "\"" : ",\"");
+        _put_str(w, _drop_names[i]);
+        _put_str(w, "\":");
+        _put_u64(w, stats->drops[i]);
+    }
+    _put_str(w, "},\"queue_max\":[");
+    _put_u64(w, stats->netif_queue_max);
+    _put_str(w, ",");
+    _put_u64(w, stats->sock_queue_max);
+    _put_str(w, "],\"latency\":[");
+    for (unsigned i = 0; i < CONFIG_NETSTATS_EXT_LATENCY_BUCKETS; i++) {
+        if (i > 0) {
+            _put_str(w, ",");
+        }
+        _put_u64(w, stats->latency[i]);
+    }
+    _put_str(w, "]}");
+}
+
+ssize_t gnrc_netif_stats_coap_handler(coap_pkt_t *pkt, uint8_t *buf,
+                                      size_t len, void *context)
+{
+    (void)context;
+    _writer_t w;
+    gnrc_netif_t *netif = NULL;
+    const char *sep = "[";
+    uint8_t *payload = buf + coap_get_total_hdr_len(pkt);
+
+    coap_block2_init(pkt, &w.slicer);
+    w.pos = payload;
+    w.pos += coap_put_option_ct(w.pos, 0, COAP_FORMAT_JSON);
+    w.pos += coap_opt_put_block2(w.pos, COAP_OPT_CONTENT_FORMAT, &w.slicer, 1);
+    *w.pos++ = 0xff;
+
+    while ((netif = gnrc_netif_iter(netif))) {
+        _put_str(&w, sep);
+        _put_netif(&w, netif);
+        sep = ",";
+    }
+    /* an empty array, if there is no interface */
+    _put_str(&w, (*sep == '[') ? "[]" : "]");
+
+    return coap_block2_build_reply(pkt, COAP_CODE_205, buf, len,
+                                   w.pos - payload, &w.slicer);
+}
+
+/** @} */
@@ -28,13 +28,25 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
-/* The registry as lookup table by gnrc_nettype_t */
-static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
+/* The registry as lookup table by gnrc_nettype_t, with the entries of a type
+ * hashed into buckets by demux context. All entries with the same demux
+ * context are in the same bucket, so gnrc_netreg_getnext() only needs to
+ * follow the bucket's list. */
+static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF][CONFIG_GNRC_NETREG_BUCKETS];
+
+static inline gnrc_netreg_entry_t **_bucket(gnrc_nettype_t type,
+                                            uint32_t demux_ctx)
+{
+    /* fold in the upper half, as e.g. GNRC_NETREG_DEMUX_CTX_ALL only sets
+     * those bits */
+    return &netreg[type][(demux_ctx ^ (demux_ctx >> 16)) %
+                         CONFIG_GNRC_NETREG_BUCKETS];
+}
 
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
 }
 
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
@@ -59,7 +71,7 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return -EINVAL;
     }
 
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(*_bucket(type, entry->demux_ctx), entry);
 
     return 0;
 }
@@ -70,7 +82,7 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return;
     }
 
-    LL_DELETE(netreg[type], entry);
+    LL_DELETE(*_bucket(type, entry->demux_ctx), entry);
 }
 
 /**
@@ -92,7 +104,8 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
+        gnrc_netreg_entry_t *head = (from) ? from->next
+                                           : *_bucket(type, demux_ctx);
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
 
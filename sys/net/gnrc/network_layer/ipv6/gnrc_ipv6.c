@@ -171,6 +171,20 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
     }
 }
 
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+static gnrc_netapi_direct_t _direct;
+
+static void _direct_handler(uint16_t type, gnrc_pktsnip_t *pkt)
+{
+    if (type == GNRC_NETAPI_MSG_TYPE_RCV) {
+        _receive(pkt);
+    }
+    else {
+        _send(pkt, true);
+    }
+}
+#endif
+
 static void *_event_loop(void *args)
 {
     msg_t msg, reply, msg_q[CONFIG_GNRC_IPV6_MSG_QUEUE_SIZE];
@@ -186,6 +200,9 @@ static void *_event_loop(void *args)
 #endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
     /* register interest in all IPv6 packets */
     gnrc_netreg_register(GNRC_NETTYPE_IPV6, &me_reg);
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+    gnrc_netapi_direct_register(&_direct, _direct_handler);
+#endif
 
     /* preinitialize ACK */
     reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
@@ -194,6 +211,9 @@ static void *_event_loop(void *args)
     while (1) {
         DEBUG("ipv6: waiting for incoming message.\n");
         msg_receive(&msg);
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+        gnrc_netapi_direct_lock(&_direct);
+#endif
 
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
@@ -248,6 +268,9 @@ static void *_event_loop(void *args)
             default:
                 break;
         }
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+        gnrc_netapi_direct_unlock(&_direct);
+#endif
     }
 
     return NULL;
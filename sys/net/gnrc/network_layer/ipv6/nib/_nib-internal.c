@@ -43,6 +43,13 @@ static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
 static _nib_abr_entry_t _abrs[CONFIG_GNRC_IPV6_NIB_ABR_NUMOF];
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_INDEX)
+/* hash index over _dsts: chains store (index in _dsts + 1), 0 ends a chain */
+static uint16_t _dsts_idx_heads[CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_BUCKETS];
+static uint16_t _dsts_idx_next[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+/* number of indexed entries per prefix length (index is prefix length - 1) */
+static uint16_t _dsts_idx_pfx_lens[IPV6_ADDR_BIT_LEN];
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX */
 static rmutex_t _nib_mutex = RMUTEX_INIT;
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
@@ -52,6 +59,10 @@ evtimer_msg_t _nib_evtimer;
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node);
 static inline bool _node_unreachable(_nib_onl_entry_t *node);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_INDEX)
+static void _offl_idx_add(_nib_offl_entry_t *dst);
+static void _offl_idx_remove(_nib_offl_entry_t *dst);
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX */
 
 void _nib_init(void)
 {
@@ -64,6 +75,11 @@ void _nib_init(void)
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_INDEX)
+    memset(_dsts_idx_heads, 0, sizeof(_dsts_idx_heads));
+    memset(_dsts_idx_next, 0, sizeof(_dsts_idx_next));
+    memset(_dsts_idx_pfx_lens, 0, sizeof(_dsts_idx_pfx_lens));
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX */
 #endif  /* TEST_SUITES */
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
@@ -513,6 +529,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_INDEX)
+        _offl_idx_add(dst);
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX */
     }
     return dst;
 }
@@ -549,6 +568,9 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_INDEX)
+        _offl_idx_remove(dst);
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX */
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -572,6 +594,79 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
     return (entry >= _dsts) && _in_dsts(entry);
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_INDEX)
+static unsigned _offl_idx_bucket(const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    uint32_t hash = pfx_len;
+
+    /* prefix is zero-padded beyond pfx_len, so only hash significant words */
+    for (unsigned i = 0; i < ((pfx_len + 31) / 32); i++) {
+        hash = (hash ^ pfx->u32[i].u32) * 0x9e3779b1;
+        hash ^= hash >> 15;
+    }
+    return hash % CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_BUCKETS;
+}
+
+static void _offl_idx_add(_nib_offl_entry_t *dst)
+{
+    unsigned bucket = _offl_idx_bucket(&dst->pfx, dst->pfx_len);
+
+    _dsts_idx_next[dst - _dsts] = _dsts_idx_heads[bucket];
+    _dsts_idx_heads[bucket] = (dst - _dsts) + 1;
+    _dsts_idx_pfx_lens[dst->pfx_len - 1]++;
+}
+
+static void _offl_idx_remove(_nib_offl_entry_t *dst)
+{
+    uint16_t *ptr = &_dsts_idx_heads[_offl_idx_bucket(&dst->pfx,
+                                                      dst->pfx_len)];
+
+    while (*ptr != 0) {
+        if (&_dsts[*ptr - 1] == dst) {
+            *ptr = _dsts_idx_next[dst - _dsts];
+            _dsts_idx_next[dst - _dsts] = 0;
+            _dsts_idx_pfx_lens[dst->pfx_len - 1]--;
+            return;
+        }
+        ptr = &_dsts_idx_next[*ptr - 1];
+    }
+}
+
+static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
+{
+    DEBUG("nib: get match for destination %s from NIB index\n",
+          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+    for (unsigned pfx_len = IPV6_ADDR_BIT_LEN; pfx_len > 0; pfx_len--) {
+        _nib_offl_entry_t *res = NULL;
+        ipv6_addr_t pfx;
+
+        if (_dsts_idx_pfx_lens[pfx_len - 1] == 0) {
+            continue;
+        }
+        /* indexed prefixes are zero-padded */
+        ipv6_addr_set_unspecified(&pfx);
+        ipv6_addr_init_prefix(&pfx, dst, pfx_len);
+        for (uint16_t i = _dsts_idx_heads[_offl_idx_bucket(&pfx, pfx_len)];
+             i != 0; i = _dsts_idx_next[i - 1]) {
+            _nib_offl_entry_t *entry = &_dsts[i - 1];
+
+            /* prefer the first entry in _dsts, as the linear scan does */
+            if ((entry->mode != _EMPTY) && (entry->pfx_len == pfx_len) &&
+                ((res == NULL) || (entry < res)) &&
+                ipv6_addr_equal(&entry->pfx, &pfx)) {
+                res = entry;
+            }
+        }
+        if (res != NULL) {
+            DEBUG("nib: best match %s/%u\n",
+                  ipv6_addr_to_str(addr_str, &res->pfx, sizeof(addr_str)),
+                  res->pfx_len);
+            return res;
+        }
+    }
+    return NULL;
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX */
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
     _nib_offl_entry_t *res = NULL;
@@ -600,6 +695,7 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
     }
     return res;
 }
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_INDEX */
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
 {
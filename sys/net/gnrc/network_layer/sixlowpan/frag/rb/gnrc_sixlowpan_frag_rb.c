@@ -53,8 +53,20 @@
 #endif
 
 static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
+/* intervals returned by gnrc_sixlowpan_frag_rb_base_rm() */
+static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_free;
+/* intervals from rbuf_int_unused on were never used */
+static unsigned _rbuf_int_unused;
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+/* entries in use, hashed by link-layer addresses and tag */
+static gnrc_sixlowpan_frag_rb_t *_rbuf_buckets[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS];
+/* entries in use, ordered by gnrc_sixlowpan_frag_rb_base_t::arrival */
+static gnrc_sixlowpan_frag_rb_t *_rbuf_by_arrival;
+/* entries returned by gnrc_sixlowpan_frag_rb_remove() */
+static gnrc_sixlowpan_frag_rb_t *_rbuf_free;
+/* entries from _rbuf_unused on were never used */
+static unsigned _rbuf_unused;
 
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
@@ -77,6 +89,14 @@ static int _rbuf_get(const void *src, size_t src_len,
                      const void *dst, size_t dst_len,
                      size_t size, uint16_t tag,
                      unsigned page);
+/* gets the hash bucket of a datagram */
+static gnrc_sixlowpan_frag_rb_t **_rbuf_bucket(const uint8_t *src, size_t src_len,
+                                               const uint8_t *dst, size_t dst_len,
+                                               uint16_t tag);
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
+/* (re-)inserts an entry into the list ordered by arrival */
+static void _rbuf_arrival_insert(gnrc_sixlowpan_frag_rb_t *entry);
+#endif
 /* gets an entry only by link-layer information and tag */
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag);
@@ -164,16 +184,17 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
     const uint8_t src_len = netif_hdr->src_l2addr_len;
     const uint8_t dst_len = netif_hdr->dst_l2addr_len;
 
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
+    gnrc_sixlowpan_frag_rb_t *e = *_rbuf_bucket(src, src_len, dst, dst_len, tag);
 
-        if ((e->pkt != NULL) && (e->super.tag == tag) &&
+    while (e != NULL) {
+        if ((e->super.tag == tag) &&
             (e->super.src_len == src_len) &&
             (e->super.dst_len == dst_len) &&
             (memcmp(e->super.src, src, src_len) == 0) &&
             (memcmp(e->super.dst, dst, dst_len) == 0)) {
             return e;
         }
+        e = e->bucket_next;
     }
     return NULL;
 }
@@ -321,15 +342,23 @@ static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
         ((start != i->start) || (end != i->end)); /* not identical */
 }
 
+static inline bool _rbuf_int_is_free(const gnrc_sixlowpan_frag_rb_int_t *i)
+{
+    return i->start > i->end;
+}
+
 static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void)
 {
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
-        if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
-            return rbuf_int + i;
-        }
-    }
+    gnrc_sixlowpan_frag_rb_int_t *res = _rbuf_int_free;
 
-    return NULL;
+    if (res != NULL) {
+        _rbuf_int_free = res->next;
+        res->next = NULL;
+    }
+    else if (_rbuf_int_unused < RBUF_INT_SIZE) {
+        res = &rbuf_int[_rbuf_int_unused++];
+    }
+    return res;
 }
 
 static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
@@ -377,26 +406,24 @@ static void _gc_pkt(gnrc_sixlowpan_frag_rb_t *rbuf)
 void gnrc_sixlowpan_frag_rb_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
-    unsigned int i;
-
-    for (i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* since pkt occupies pktbuf, aggressivly collect garbage */
-        if (!gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i]) &&
-              ((now_usec - rbuf[i].super.arrival) >
-               CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)) {
-            DEBUG("6lo rfrag: entry (%s, ",
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) timed out\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
 
-            _gc_pkt(&rbuf[i]);
-            gnrc_sixlowpan_frag_rb_remove(&(rbuf[i]));
-        }
+    /* since pkt occupies pktbuf, aggressivly collect garbage. Entries are
+     * ordered by arrival, so only the oldest ones need to be checked */
+    while ((_rbuf_by_arrival != NULL) &&
+           ((now_usec - _rbuf_by_arrival->super.arrival) >
+            CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)) {
+        gnrc_sixlowpan_frag_rb_t *e = _rbuf_by_arrival;
+
+        DEBUG("6lo rfrag: entry (%s, ",
+              gnrc_netif_addr_to_str(e->super.src, e->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u) timed out\n",
+              gnrc_netif_addr_to_str(e->super.dst, e->super.dst_len,
+                                     l2addr_str),
+              (unsigned)e->super.datagram_size, e->super.tag);
+
+        _gc_pkt(e);
+        gnrc_sixlowpan_frag_rb_remove(e);
     }
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
     gnrc_sixlowpan_frag_vrb_gc();
@@ -409,61 +436,101 @@ static inline void _set_rbuf_timeout(void)
                    &_gc_timer_msg, sched_active_pid);
 }
 
+static gnrc_sixlowpan_frag_rb_t **_rbuf_bucket(const uint8_t *src, size_t src_len,
+                                               const uint8_t *dst, size_t dst_len,
+                                               uint16_t tag)
+{
+    uint32_t hash = tag;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash * 31) + src[i];
+    }
+    for (unsigned i = 0; i < dst_len; i++) {
+        hash = (hash * 31) + dst[i];
+    }
+    return &_rbuf_buckets[hash % CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_BUCKETS];
+}
+
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
+static void _rbuf_arrival_insert(gnrc_sixlowpan_frag_rb_t *entry)
+{
+    gnrc_sixlowpan_frag_rb_t *succ = NULL;
+
+    /* most entries just arrived and are appended, so search from the end */
+    if (_rbuf_by_arrival != NULL) {
+        gnrc_sixlowpan_frag_rb_t *iter = _rbuf_by_arrival->prev;
+
+        while ((int32_t)(iter->super.arrival - entry->super.arrival) > 0) {
+            succ = iter;
+            if (iter == _rbuf_by_arrival) {
+                break;
+            }
+            iter = iter->prev;
+        }
+    }
+    if (succ != NULL) {
+        DL_PREPEND_ELEM(_rbuf_by_arrival, succ, entry);
+    }
+    else {
+        DL_APPEND(_rbuf_by_arrival, entry);
+    }
+}
+#endif
+
 static int _rbuf_get(const void *src, size_t src_len,
                      const void *dst, size_t dst_len,
                      size_t size, uint16_t tag,
                      unsigned page)
 {
-    gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
+    gnrc_sixlowpan_frag_rb_t **bucket = _rbuf_bucket(src, src_len, dst, dst_len, tag);
+    gnrc_sixlowpan_frag_rb_t *res;
     uint32_t now_usec = xtimer_now_usec();
 
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+    for (res = *bucket; res != NULL; res = res->bucket_next) {
         /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.datagram_size == size) &&
-            (rbuf[i].super.tag == tag) && (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
+        if ((res->super.datagram_size == size) &&
+            (res->super.tag == tag) && (res->super.src_len == src_len) &&
+            (res->super.dst_len == dst_len) &&
+            (memcmp(res->super.src, src, src_len) == 0) &&
+            (memcmp(res->super.dst, dst, dst_len) == 0)) {
+            DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
+                  gnrc_netif_addr_to_str(res->super.src,
+                                         res->super.src_len,
                                          l2addr_str));
             DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
+                  gnrc_netif_addr_to_str(res->super.dst,
+                                         res->super.dst_len,
                                          l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+                  (unsigned)res->super.datagram_size, res->super.tag);
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
+            if (res->super.current_size == 0) {
                 /* ensure that only empty reassembly buffer entries and entries
                  * scheduled for deletion have `current_size == 0` */
                 DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
                 return -1;
             }
 #endif
-            rbuf[i].super.arrival = now_usec;
+            res->super.arrival = now_usec;
+            DL_DELETE(_rbuf_by_arrival, res);
+            DL_APPEND(_rbuf_by_arrival, res);
             _set_rbuf_timeout();
-            return i;
-        }
-
-        /* if there is a free spot: remember it */
-        if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
-            res = &(rbuf[i]);
-        }
-
-        /* remember oldest slot */
-        /* note that xtimer_now will overflow in ~1.2 hours */
-        if ((oldest == NULL) ||
-            (oldest->super.arrival - rbuf[i].super.arrival < UINT32_MAX / 2)) {
-            oldest = &(rbuf[i]);
+            return res - &(rbuf[0]);
         }
     }
 
+    /* take an unused entry */
+    if ((res = _rbuf_free) != NULL) {
+        _rbuf_free = res->bucket_next;
+    }
+    else if (_rbuf_unused < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE) {
+        res = &rbuf[_rbuf_unused++];
+    }
     /* entry not in buffer and no empty spot found */
-    if (res == NULL) {
+    else {
+        /* the oldest entry is the first one ordered by arrival */
+        gnrc_sixlowpan_frag_rb_t *oldest = _rbuf_by_arrival;
+
         assert(oldest != NULL);
-        /* if oldest is not empty, res must not be NULL (because otherwise
-         * oldest could have been picked as res) */
         assert(!gnrc_sixlowpan_frag_rb_entry_empty(oldest));
         if (GNRC_SIXLOWPAN_FRAG_RBUF_AGGRESSIVE_OVERRIDE ||
             ((now_usec - oldest->super.arrival) >
@@ -471,7 +538,8 @@ static int _rbuf_get(const void *src, size_t src_len,
             DEBUG("6lo rfrag: reassembly buffer full, remove oldest entry\n");
             gnrc_pktbuf_release(oldest->pkt);
             gnrc_sixlowpan_frag_rb_remove(oldest);
-            res = oldest;
+            res = _rbuf_free;
+            _rbuf_free = res->bucket_next;
 #if GNRC_SIXLOWPAN_FRAG_RBUF_AGGRESSIVE_OVERRIDE && \
     defined(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
             gnrc_sixlowpan_frag_stats_get()->rbuf_full++;
@@ -501,6 +569,8 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->pkt = gnrc_pktbuf_add(NULL, NULL, size, reass_type);
     if (res->pkt == NULL) {
         DEBUG("6lo rfrag: can not allocate reassembly buffer space.\n");
+        res->bucket_next = _rbuf_free;
+        _rbuf_free = res;
         return -1;
     }
 
@@ -514,6 +584,9 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->super.dst_len = dst_len;
     res->super.tag = tag;
     res->super.current_size = 0;
+    res->bucket_next = *bucket;
+    *bucket = res;
+    DL_APPEND(_rbuf_by_arrival, res);
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
@@ -533,6 +606,8 @@ void gnrc_sixlowpan_frag_rb_reset(void)
 {
     xtimer_remove(&_gc_timer);
     memset(rbuf_int, 0, sizeof(rbuf_int));
+    _rbuf_int_free = NULL;
+    _rbuf_int_unused = 0;
     for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         if ((rbuf[i].pkt != NULL) &&
             (rbuf[i].pkt->users > 0)) {
@@ -540,6 +615,10 @@ void gnrc_sixlowpan_frag_rb_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+    memset(_rbuf_buckets, 0, sizeof(_rbuf_buckets));
+    _rbuf_by_arrival = NULL;
+    _rbuf_free = NULL;
+    _rbuf_unused = 0;
 }
 
 const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
@@ -550,17 +629,52 @@ const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
 
 void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
 {
-    while (entry->ints != NULL) {
+    /* a VRB entry shares the interval list of the reassembly buffer entry it
+     * was created from, so the list may have been freed already */
+    while ((entry->ints != NULL) && !_rbuf_int_is_free(entry->ints)) {
         gnrc_sixlowpan_frag_rb_int_t *next = entry->ints->next;
 
-        entry->ints->start = 0;
+        /* start > end marks the interval as freed */
+        entry->ints->start = UINT16_MAX;
         entry->ints->end = 0;
         entry->ints->next = NULL;
+        /* only intervals of the interval buffer can be reused */
+        if ((entry->ints >= &rbuf_int[0]) &&
+            (entry->ints < &rbuf_int[RBUF_INT_SIZE])) {
+            entry->ints->next = _rbuf_int_free;
+            _rbuf_int_free = entry->ints;
+        }
         entry->ints = next;
     }
+    entry->ints = NULL;
     entry->datagram_size = 0;
 }
 
+void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf)
+{
+    assert(rbuf != NULL);
+    /* entries not in use are not linked to any list */
+    if (rbuf->prev != NULL) {
+        gnrc_sixlowpan_frag_rb_t **bucket = _rbuf_bucket(rbuf->super.src,
+                                                         rbuf->super.src_len,
+                                                         rbuf->super.dst,
+                                                         rbuf->super.dst_len,
+                                                         rbuf->super.tag);
+
+        while (*bucket != rbuf) {
+            bucket = &(*bucket)->bucket_next;
+        }
+        *bucket = rbuf->bucket_next;
+        DL_DELETE(_rbuf_by_arrival, rbuf);
+        rbuf->prev = NULL;
+        rbuf->next = NULL;
+        rbuf->bucket_next = _rbuf_free;
+        _rbuf_free = rbuf;
+    }
+    gnrc_sixlowpan_frag_rb_base_rm(&rbuf->super);
+    rbuf->pkt = NULL;
+}
+
 static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
 {
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0U
@@ -572,6 +686,8 @@ static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
         rbuf->super.arrival = xtimer_now_usec() -
                               (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US -
                                CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER);
+        DL_DELETE(_rbuf_by_arrival, rbuf);
+        _rbuf_arrival_insert(rbuf);
         /* reset current size to prevent late duplicates to trigger another
          * dispatch */
         rbuf->super.current_size = 0;
@@ -623,6 +739,9 @@ int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf
         new_netif_hdr->flags = netif_hdr->flags;
         new_netif_hdr->lqi = netif_hdr->lqi;
         new_netif_hdr->rssi = netif_hdr->rssi;
+#if IS_USED(MODULE_NETSTATS_EXT)
+        new_netif_hdr->rx_time = netif_hdr->rx_time;
+#endif
         LL_APPEND(rbuf->pkt, netif);
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
         gnrc_sixlowpan_frag_stats_get()->fragments += _count_frags(rbuf);
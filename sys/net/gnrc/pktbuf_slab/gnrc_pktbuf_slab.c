@@ -0,0 +1,658 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Packet buffer using segregated size classes
+ *
+ * The packet buffer is split into pages of @ref GNRC_PKTBUF_SLAB_PAGE_SIZE
+ * bytes. Allocations of up to half a page are served from pages dedicated to
+ * a power-of-two size class, larger ones from a run of consecutive pages. So
+ * in contrast to `gnrc_pktbuf_static` neither allocating nor freeing needs to
+ * walk a list of holes, and small header allocations do not fragment the
+ * space needed for full frames.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/types.h>
+
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#define _PAGE_SIZE      (GNRC_PKTBUF_SLAB_PAGE_SIZE)
+#define _PAGES_NUMOF    (GNRC_PKTBUF_SIZE / _PAGE_SIZE)
+#define _MIN_BLOCK      (16U)   /**< block size of the smallest size class */
+
+#if (_PAGE_SIZE == 128)
+#define _CLASSES_NUMOF  (3U)    /* 16, 32, 64 */
+#elif (_PAGE_SIZE == 256)
+#define _CLASSES_NUMOF  (4U)    /* 16, 32, 64, 128 */
+#elif (_PAGE_SIZE == 512)
+#define _CLASSES_NUMOF  (5U)    /* 16, 32, 64, 128, 256 */
+#else
+#error "GNRC_PKTBUF_SLAB_PAGE_SIZE must be 128, 256, or 512"
+#endif
+
+#if (_PAGES_NUMOF == 0) || (_PAGES_NUMOF > 255)
+#error "GNRC_PKTBUF_SIZE must be between 1 and 255 times GNRC_PKTBUF_SLAB_PAGE_SIZE"
+#endif
+
+/* page types beside the size class index */
+#define _PAGE_FREE      (0xffU) /**< page is not in use */
+#define _PAGE_RUN       (0xfeU) /**< first page of a run */
+#define _PAGE_RUN_TAIL  (0xfdU) /**< further page of a run */
+
+typedef struct _block {
+    struct _block *next;
+} _block_t;
+
+/**
+ * @brief   Page descriptor
+ *
+ * Page indexes in `prev` and `next` are stored incremented by one, so 0 marks
+ * the end of a list.
+ */
+typedef struct {
+    _block_t *free;     /**< free blocks of a size class page */
+    uint8_t type;       /**< size class index or one of the _PAGE_* types */
+    uint8_t used;       /**< allocated blocks of a size class page, number of
+                         *   pages of a run */
+    uint8_t prev;       /**< previous size class page with free blocks, first
+                         *   page of the run for _PAGE_RUN_TAIL */
+    uint8_t next;       /**< next size class page with free blocks */
+} _page_t;
+
+static mutex_t _mutex = MUTEX_INIT;
+static uint8_t _pktbuf[_PAGES_NUMOF * _PAGE_SIZE] __attribute__((aligned(_MIN_BLOCK)));
+static _page_t _pages[_PAGES_NUMOF];
+/* per size class list of pages with free blocks */
+static uint8_t _partial[_CLASSES_NUMOF];
+
+#ifdef DEVELHELP
+/* maximum number of pages in use */
+static uint8_t _max_pages_used = 0;
+static uint8_t _pages_used = 0;
+#endif
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void *_pktbuf_alloc(size_t size);
+static void _pktbuf_free(void *data);
+
+static inline bool _pktbuf_contains(void *ptr)
+{
+    return (size_t)((uint8_t *)ptr - _pktbuf) < sizeof(_pktbuf);
+}
+
+static inline size_t _class_size(unsigned cls)
+{
+    return _MIN_BLOCK << cls;
+}
+
+static inline unsigned _page_idx(const void *ptr)
+{
+    return ((const uint8_t *)ptr - _pktbuf) / _PAGE_SIZE;
+}
+
+static inline uint8_t *_page_start(unsigned idx)
+{
+    return &_pktbuf[idx * _PAGE_SIZE];
+}
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&_mutex);
+    for (unsigned i = 0; i < _PAGES_NUMOF; i++) {
+        _pages[i].free = NULL;
+        _pages[i].type = _PAGE_FREE;
+        _pages[i].used = 0;
+        _pages[i].prev = 0;
+        _pages[i].next = 0;
+    }
+    memset(_partial, 0, sizeof(_partial));
+#ifdef DEVELHELP
+    _pages_used = 0;
+#endif
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > GNRC_PKTBUF_SIZE) {
+        DEBUG("pktbuf: size (%u) > GNRC_PKTBUF_SIZE (%u)\n",
+              (unsigned)size, GNRC_PKTBUF_SIZE);
+        return NULL;
+    }
+    mutex_lock(&_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+    void *new_data_marked;
+
+    mutex_lock(&_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->size == size) {
+        new_data_marked = pkt->data;
+        pkt->data = NULL;
+    }
+    else {
+        /* a chunk can only be freed as a whole, so copy the (usually small)
+         * marked section out and leave the rest where it is */
+        new_data_marked = _pktbuf_alloc(size);
+        if (new_data_marked == NULL) {
+            DEBUG("pktbuf: could not reallocate marked section.\n");
+            _pktbuf_free(marked_snip);
+            mutex_unlock(&_mutex);
+            return NULL;
+        }
+        memcpy(new_data_marked, pkt->data, size);
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    pkt->size -= size;
+    _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
+    pkt->next = marked_snip;
+    mutex_unlock(&_mutex);
+    return marked_snip;
+}
+
+/* number of bytes usable from ptr up to the end of its chunk */
+static size_t _capacity(void *ptr)
+{
+    unsigned idx = _page_idx(ptr);
+    _page_t *page = &_pages[idx];
+    size_t offset = (uint8_t *)ptr - _page_start(idx);
+
+    if (page->type == _PAGE_RUN_TAIL) {
+        idx = page->prev - 1;
+        page = &_pages[idx];
+        offset = (uint8_t *)ptr - _page_start(idx);
+    }
+    if (page->type == _PAGE_RUN) {
+        return (page->used * _PAGE_SIZE) - offset;
+    }
+    return _class_size(page->type) - (offset & (_class_size(page->type) - 1));
+}
+
+/* return the pages of a run behind ptr + size */
+static void _trim(void *ptr, size_t size)
+{
+    unsigned idx = _page_idx(ptr);
+    unsigned last = _page_idx((uint8_t *)ptr + size - 1);
+    _page_t *page = &_pages[idx];
+
+    if (page->type == _PAGE_RUN_TAIL) {
+        idx = page->prev - 1;
+        page = &_pages[idx];
+    }
+    if (page->type != _PAGE_RUN) {
+        return;
+    }
+    for (unsigned i = last + 1; i < (idx + page->used); i++) {
+        _pages[i].type = _PAGE_FREE;
+        _pages[i].prev = 0;
+#ifdef DEVELHELP
+        _pages_used--;
+#endif
+    }
+    page->used = last + 1 - idx;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && _pktbuf_contains(pkt->data)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        _pktbuf_free(pkt->data);
+        pkt->data = NULL;
+    }
+    /* new size does not fit into the current chunk */
+    else if ((pkt->data == NULL) || (size > _capacity(pkt->data))) {
+        void *new_data = _pktbuf_alloc(size);
+        if (new_data == NULL) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            mutex_unlock(&_mutex);
+            return ENOMEM;
+        }
+        if (pkt->data != NULL) {            /* if old data exist */
+            memcpy(new_data, pkt->data, pkt->size);
+            _pktbuf_free(pkt->data);
+        }
+        pkt->data = new_data;
+    }
+    else if (size < pkt->size) {
+        _trim(pkt->data, size);
+    }
+    pkt->size = size;
+    mutex_unlock(&_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&_mutex);
+}
+
+static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    while (pkt) {
+        gnrc_pktsnip_t *tmp;
+        assert(_pktbuf_contains(pkt));
+        assert(pkt->users > 0);
+        tmp = pkt->next;
+        if (pkt->users == 1) {
+            pkt->users = 0; /* not necessary but to be on the safe side */
+            if (pkt->data != NULL) {
+                _pktbuf_free(pkt->data);
+            }
+            _pktbuf_free(pkt);
+        }
+        else {
+            pkt->users--;
+        }
+        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+        gnrc_neterr_report(pkt, err);
+        pkt = tmp;
+    }
+}
+
+void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    mutex_lock(&_mutex);
+    _release_error_locked(pkt, err);
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&_mutex);
+        return new;
+    }
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    unsigned free_pages = 0, run_pages = 0;
+
+    mutex_lock(&_mutex);
+    printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
+           (void *)&_pktbuf[0], (void *)&_pktbuf[sizeof(_pktbuf)],
+           (unsigned)sizeof(_pktbuf));
+    printf("  pages: %u of %u bytes, maximum in use: %u\n",
+           (unsigned)_PAGES_NUMOF, (unsigned)_PAGE_SIZE,
+           (unsigned)_max_pages_used);
+    for (unsigned cls = 0; cls < _CLASSES_NUMOF; cls++) {
+        unsigned pages = 0, used = 0;
+
+        for (unsigned i = 0; i < _PAGES_NUMOF; i++) {
+            if (_pages[i].type == cls) {
+                pages++;
+                used += _pages[i].used;
+            }
+        }
+        printf("  %4u byte blocks: %u used in %u pages\n",
+               (unsigned)_class_size(cls), used, pages);
+    }
+    for (unsigned i = 0; i < _PAGES_NUMOF; i++) {
+        if (_pages[i].type == _PAGE_FREE) {
+            free_pages++;
+        }
+        else if ((_pages[i].type == _PAGE_RUN) ||
+                 (_pages[i].type == _PAGE_RUN_TAIL)) {
+            run_pages++;
+        }
+    }
+    printf("  large chunks: %u pages\n", run_pages);
+    printf("  free: %u pages\n", free_pages);
+    mutex_unlock(&_mutex);
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < _PAGES_NUMOF; i++) {
+        if (_pages[i].type != _PAGE_FREE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariants of this implementation:
+     *  - forall size class pages: used + number of free blocks == blocks per
+     *    page, and all free blocks are aligned blocks within the page
+     *  - a size class page is in the partial list of its class iff it has
+     *    free blocks, and the list is properly doubly linked
+     *  - forall runs: all following pages of the run are _PAGE_RUN_TAIL
+     *    pointing back to the first page
+     */
+    unsigned partial_pages = 0, listed_pages = 0;
+
+    for (unsigned i = 0; i < _PAGES_NUMOF; i++) {
+        _page_t *page = &_pages[i];
+
+        if (page->type < _CLASSES_NUMOF) {
+            size_t block_size = _class_size(page->type);
+            unsigned free_blocks = 0;
+
+            for (_block_t *b = page->free; b != NULL; b = b->next) {
+                size_t offset = (uint8_t *)b - _page_start(i);
+
+                if ((offset >= _PAGE_SIZE) || (offset & (block_size - 1)) ||
+                    (free_blocks > (_PAGE_SIZE / block_size))) {
+                    return false;
+                }
+                free_blocks++;
+            }
+            if ((page->used + free_blocks) != (_PAGE_SIZE / block_size)) {
+                return false;
+            }
+            if (free_blocks > 0) {
+                partial_pages++;
+            }
+        }
+        else if (page->type == _PAGE_RUN) {
+            if ((page->used == 0) || ((i + page->used) > _PAGES_NUMOF)) {
+                return false;
+            }
+            for (unsigned j = i + 1; j < (i + page->used); j++) {
+                if ((_pages[j].type != _PAGE_RUN_TAIL) ||
+                    (_pages[j].prev != (i + 1))) {
+                    return false;
+                }
+            }
+            i += page->used - 1;
+        }
+        else if (page->type != _PAGE_FREE) {
+            /* run tail without a preceding run */
+            return false;
+        }
+    }
+    for (unsigned cls = 0; cls < _CLASSES_NUMOF; cls++) {
+        uint8_t prev = 0;
+
+        for (uint8_t idx = _partial[cls]; idx != 0; idx = _pages[idx - 1].next) {
+            _page_t *page = &_pages[idx - 1];
+
+            if ((page->type != cls) || (page->free == NULL) ||
+                (page->prev != prev) || (listed_pages >= _PAGES_NUMOF)) {
+                return false;
+            }
+            listed_pages++;
+            prev = idx;
+        }
+    }
+    return listed_pages == partial_pages;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _pktbuf_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            _pktbuf_free(pkt);
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+/* returns the index of the first of num free consecutive pages or -1 */
+static int _pages_alloc(unsigned num)
+{
+    unsigned start = 0;
+
+    for (unsigned i = 0; i < _PAGES_NUMOF; i++) {
+        if (_pages[i].type != _PAGE_FREE) {
+            start = i + 1;
+        }
+        else if ((i + 1 - start) == num) {
+#ifdef DEVELHELP
+            _pages_used += num;
+            if (_pages_used > _max_pages_used) {
+                _max_pages_used = _pages_used;
+            }
+#endif
+            return start;
+        }
+    }
+    return -1;
+}
+
+static void _pages_free(unsigned idx, unsigned num)
+{
+    for (unsigned i = idx; i < (idx + num); i++) {
+        _pages[i].free = NULL;
+        _pages[i].type = _PAGE_FREE;
+        _pages[i].used = 0;
+        _pages[i].prev = 0;
+        _pages[i].next = 0;
+    }
+#ifdef DEVELHELP
+    _pages_used -= num;
+#endif
+}
+
+static void _partial_add(unsigned cls, unsigned idx)
+{
+    _page_t *page = &_pages[idx];
+
+    page->prev = 0;
+    page->next = _partial[cls];
+    if (_partial[cls] != 0) {
+        _pages[_partial[cls] - 1].prev = idx + 1;
+    }
+    _partial[cls] = idx + 1;
+}
+
+static void _partial_remove(unsigned cls, unsigned idx)
+{
+    _page_t *page = &_pages[idx];
+
+    if (page->prev == 0) {
+        _partial[cls] = page->next;
+    }
+    else {
+        _pages[page->prev - 1].next = page->next;
+    }
+    if (page->next != 0) {
+        _pages[page->next - 1].prev = page->prev;
+    }
+    page->prev = 0;
+    page->next = 0;
+}
+
+static void *_pktbuf_alloc(size_t size)
+{
+    if (size > (_PAGE_SIZE / 2)) {
+        unsigned num = (size + _PAGE_SIZE - 1) / _PAGE_SIZE;
+        int idx = _pages_alloc(num);
+
+        if (idx < 0) {
+            DEBUG("pktbuf: no space left in packet buffer\n");
+            return NULL;
+        }
+        _pages[idx].type = _PAGE_RUN;
+        _pages[idx].used = num;
+        for (unsigned i = idx + 1; i < (idx + num); i++) {
+            _pages[i].type = _PAGE_RUN_TAIL;
+            _pages[i].prev = idx + 1;
+        }
+        return _page_start(idx);
+    }
+
+    unsigned cls = 0;
+    _page_t *page;
+    _block_t *block;
+
+    while (_class_size(cls) < size) {
+        cls++;
+    }
+    if (_partial[cls] == 0) {
+        /* carve a fresh page into blocks */
+        size_t block_size = _class_size(cls);
+        int idx = _pages_alloc(1);
+
+        if (idx < 0) {
+            DEBUG("pktbuf: no space left in packet buffer\n");
+            return NULL;
+        }
+        page = &_pages[idx];
+        page->type = cls;
+        page->used = 0;
+        page->free = NULL;
+        for (size_t offset = _PAGE_SIZE; offset > 0; offset -= block_size) {
+            block = (_block_t *)(_page_start(idx) + offset - block_size);
+            block->next = page->free;
+            page->free = block;
+        }
+        _partial_add(cls, idx);
+    }
+    page = &_pages[_partial[cls] - 1];
+    block = page->free;
+    page->free = block->next;
+    page->used++;
+    if (page->free == NULL) {
+        _partial_remove(cls, _partial[cls] - 1);
+    }
+    return block;
+}
+
+static void _pktbuf_free(void *data)
+{
+    unsigned idx;
+    _page_t *page;
+
+    if (!_pktbuf_contains(data)) {
+        return;
+    }
+    idx = _page_idx(data);
+    page = &_pages[idx];
+    if (page->type == _PAGE_RUN_TAIL) {
+        idx = page->prev - 1;
+        page = &_pages[idx];
+    }
+    assert(page->type != _PAGE_FREE);
+    if (page->type == _PAGE_RUN) {
+        _pages_free(idx, page->used);
+        return;
+    }
+
+    unsigned cls = page->type;
+    size_t offset = (uint8_t *)data - _page_start(idx);
+    /* data may point into the block after gnrc_pktbuf_mark() */
+    _block_t *block = (_block_t *)(_page_start(idx) +
+                                   (offset & ~(_class_size(cls) - 1)));
+
+    assert(page->used > 0);
+    if (page->free == NULL) {
+        _partial_add(cls, idx);
+    }
+    block->next = page->free;
+    page->free = block;
+    if (--page->used == 0) {
+        _partial_remove(cls, idx);
+        _pages_free(idx, 1);
+    }
+}
+
+/** @} */
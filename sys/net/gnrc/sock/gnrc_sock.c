@@ -21,6 +21,10 @@
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/hdr.h"
 #include "net/gnrc/netreg.h"
+#ifdef MODULE_NETSTATS_EXT
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#endif
 #include "net/udp.h"
 #include "utlist.h"
 #include "xtimer.h"
@@ -56,6 +60,12 @@ static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
         if (mbox_try_put(&reg->mbox, &msg) < 1) {
             LOG_WARNING("gnrc_sock: dropped message to %p (was full)\n",
                         (void *)&reg->mbox);
+#ifdef MODULE_NETSTATS_EXT
+            gnrc_netif_stats_drop(pkt, NETSTATS_DROP_QUEUE);
+#endif
+            /* the callback was handed the packet, so release it */
+            gnrc_pktbuf_release(pkt);
+            return;
         }
         if (reg->async_cb.generic) {
             reg->async_cb.generic(reg, SOCK_ASYNC_MSG_RECV, reg->async_cb_arg);
@@ -64,6 +74,25 @@ static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
 }
 #endif /* SOCK_HAS_ASYNC */
 
+#ifdef MODULE_NETSTATS_EXT
+static void _stats_ext_delivered(gnrc_sock_reg_t *reg,
+                                 const gnrc_netif_hdr_t *netif_hdr)
+{
+    gnrc_netif_t *netif = gnrc_netif_get_by_pid(netif_hdr->if_pid);
+
+    if (netif == NULL) {
+        return;
+    }
+    /* the received message counts as well */
+    netstats_ext_queue_fill(&netif->stats_ext.sock_queue_max,
+                            cib_avail(&reg->mbox.cib) + 1);
+    if (netif_hdr->rx_time != 0) {
+        netstats_ext_add_latency(&netif->stats_ext,
+                                 xtimer_now_usec() - netif_hdr->rx_time);
+    }
+}
+#endif
+
 void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_ctx)
 {
     mbox_init(&reg->mbox, reg->mbox_queue, SOCK_MBOX_SIZE);
@@ -135,11 +164,32 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
         gnrc_netif_hdr_t *netif_hdr = netif->data;
         /* TODO: use API in #5511 */
         remote->netif = (uint16_t)netif_hdr->if_pid;
+#ifdef MODULE_NETSTATS_EXT
+        _stats_ext_delivered(reg, netif_hdr);
+#endif
     }
     *pkt_out = pkt; /* set out parameter */
     return 0;
 }
 
+ssize_t gnrc_sock_peek_size(gnrc_sock_reg_t *reg)
+{
+    ssize_t res = -EAGAIN;
+    unsigned state = irq_disable();
+    int idx = cib_peek(&reg->mbox.cib);
+
+    if (idx >= 0) {
+        msg_t *msg = &reg->mbox.msg_array[idx];
+
+        /* only the receiving thread takes packets from the mailbox */
+        res = (msg->type == GNRC_NETAPI_MSG_TYPE_RCV)
+            ? (ssize_t)((gnrc_pktsnip_t *)msg->content.ptr)->size
+            : -EAGAIN;
+    }
+    irq_restore(state);
+    return res;
+}
+
 ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
                        const sock_ip_ep_t *remote, uint8_t nh)
 {
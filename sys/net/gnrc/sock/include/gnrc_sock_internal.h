@@ -118,6 +118,15 @@ void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_
 ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt, uint32_t timeout,
                        sock_ip_ep_t *remote);
 
+/**
+ * @brief   Get the size of the packet a sock receives next, without taking it
+ * @internal
+ *
+ * @return  size of the first snip of the packet, i.e. its payload
+ * @return  -EAGAIN, if no packet is queued
+ */
+ssize_t gnrc_sock_peek_size(gnrc_sock_reg_t *reg);
+
 /**
  * @brief   Send a packet internally
  * @internal
@@ -29,6 +29,9 @@
 #include "net/af.h"
 #include "net/gnrc.h"
 #include "net/gnrc/netreg.h"
+#ifdef MODULE_GNRC_SOCK_TCP
+#include "net/gnrc/tcp.h"
+#endif
 #ifdef SOCK_HAS_ASYNC
 #include "net/sock/async/types.h"
 #endif
@@ -116,6 +119,27 @@ struct sock_udp {
     uint16_t flags;                     /**< option flags */
 };
 
+#ifdef MODULE_GNRC_SOCK_TCP
+/**
+ * @brief   TCP sock type
+ * @internal
+ *
+ * @note    Must only consist of the TCB, sock_tcp_listen() hands an array of
+ *          socks to @ref gnrc_tcp_listen() as an array of TCBs.
+ */
+struct sock_tcp {
+    gnrc_tcp_tcb_t tcb;                 /**< TCB of the connection */
+};
+
+/**
+ * @brief   TCP listening queue type
+ * @internal
+ */
+struct sock_tcp_queue {
+    gnrc_tcp_tcb_queue_t queue;         /**< GNRC TCP listening queue */
+};
+#endif
+
 #ifdef __cplusplus
 }
 #endif
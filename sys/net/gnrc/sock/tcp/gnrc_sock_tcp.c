@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       GNRC implementation of @ref net_sock_tcp
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "net/af.h"
+#include "net/gnrc/tcp.h"
+#include "net/sock/tcp.h"
+
+/* sock_tcp_listen() passes the array of socks as array of TCBs */
+static_assert(sizeof(sock_tcp_t) == sizeof(gnrc_tcp_tcb_t),
+              "sock_tcp_t must only consist of gnrc_tcp_tcb_t");
+
+/**
+ * @brief   Converts a sock end point to a GNRC TCP end point
+ */
+static int _ep_from_sock(gnrc_tcp_ep_t *ep, const sock_tcp_ep_t *sock_ep)
+{
+    if (sock_ep->family != AF_INET6) {
+        return -EAFNOSUPPORT;
+    }
+    return gnrc_tcp_ep_init(ep, sock_ep->family, sock_ep->addr.ipv6,
+                            sizeof(sock_ep->addr.ipv6), sock_ep->port,
+                            sock_ep->netif);
+}
+
+/**
+ * @brief   Fills a sock end point from the information held in a TCB
+ */
+static void _ep_to_sock(sock_tcp_ep_t *ep, int family, const uint8_t *addr,
+                        int netif, uint16_t port)
+{
+    memset(ep, 0, sizeof(*ep));
+    ep->family = family;
+    memcpy(ep->addr.ipv6, addr, sizeof(ep->addr.ipv6));
+    ep->netif = (netif > 0) ? (uint16_t)netif : SOCK_ADDR_ANY_NETIF;
+    ep->port = port;
+}
+
+int sock_tcp_connect(sock_tcp_t *sock, const sock_tcp_ep_t *remote,
+                     uint16_t local_port, uint16_t flags)
+{
+    assert(sock != NULL);
+    assert((remote != NULL) && (remote->port != 0));
+
+    gnrc_tcp_ep_t ep;
+    int res;
+
+    /* a TCB only ever connects one pair of end points */
+    (void)flags;
+    if ((res = _ep_from_sock(&ep, remote)) < 0) {
+        return res;
+    }
+    gnrc_tcp_tcb_init(&sock->tcb);
+    return gnrc_tcp_open_active(&sock->tcb, &ep, local_port);
+}
+
+int sock_tcp_listen(sock_tcp_queue_t *queue, const sock_tcp_ep_t *local,
+                    sock_tcp_t *queue_array, unsigned queue_len,
+                    uint16_t flags)
+{
+    assert(queue != NULL);
+    assert((local != NULL) && (local->port != 0));
+    assert((queue_array != NULL) && (queue_len != 0));
+
+    gnrc_tcp_ep_t ep;
+    int res;
+
+    /* listening queues never share a port, see gnrc_tcp_listen() */
+    (void)flags;
+    if ((res = _ep_from_sock(&ep, local)) < 0) {
+        return res;
+    }
+    return gnrc_tcp_listen(&queue->queue, &queue_array->tcb, queue_len, &ep);
+}
+
+void sock_tcp_disconnect(sock_tcp_t *sock)
+{
+    assert(sock != NULL);
+    gnrc_tcp_close(&sock->tcb);
+}
+
+void sock_tcp_stop_listen(sock_tcp_queue_t *queue)
+{
+    assert(queue != NULL);
+    gnrc_tcp_stop_listen(&queue->queue);
+}
+
+int sock_tcp_get_local(sock_tcp_t *sock, sock_tcp_ep_t *ep)
+{
+    assert((sock != NULL) && (ep != NULL));
+
+    if (sock->tcb.local_port == 0) {
+        return -EADDRNOTAVAIL;
+    }
+    _ep_to_sock(ep, sock->tcb.address_family, sock->tcb.local_addr,
+                sock->tcb.ll_iface, sock->tcb.local_port);
+    return 0;
+}
+
+int sock_tcp_get_remote(sock_tcp_t *sock, sock_tcp_ep_t *ep)
+{
+    assert((sock != NULL) && (ep != NULL));
+
+    if (sock->tcb.peer_port == 0) {
+        return -ENOTCONN;
+    }
+    _ep_to_sock(ep, sock->tcb.address_family, sock->tcb.peer_addr,
+                sock->tcb.ll_iface, sock->tcb.peer_port);
+    return 0;
+}
+
+int sock_tcp_queue_get_local(sock_tcp_queue_t *queue, sock_tcp_ep_t *ep)
+{
+    assert((queue != NULL) && (ep != NULL));
+
+    if (queue->queue.local_port == 0) {
+        return -EADDRNOTAVAIL;
+    }
+    _ep_to_sock(ep, queue->queue.address_family, queue->queue.local_addr,
+                0, queue->queue.local_port);
+    return 0;
+}
+
+int sock_tcp_accept(sock_tcp_queue_t *queue, sock_tcp_t **sock,
+                    uint32_t timeout)
+{
+    assert((queue != NULL) && (sock != NULL));
+
+    gnrc_tcp_tcb_t *tcb;
+    int res;
+
+    /* SOCK_NO_TIMEOUT and GNRC_TCP_NO_TIMEOUT are the same */
+    if ((res = gnrc_tcp_accept(&queue->queue, &tcb, timeout)) == 0) {
+        *sock = container_of(tcb, sock_tcp_t, tcb);
+    }
+    return res;
+}
+
+ssize_t sock_tcp_read(sock_tcp_t *sock, void *data, size_t max_len,
+                      uint32_t timeout)
+{
+    assert((sock != NULL) && (data != NULL) && (max_len > 0));
+    return gnrc_tcp_recv(&sock->tcb, data, max_len, timeout);
+}
+
+ssize_t sock_tcp_write(sock_tcp_t *sock, const void *data, size_t len)
+{
+    assert(sock != NULL);
+    assert((len == 0) || (data != NULL)); /* (len != 0) => (data != NULL) */
+
+    const uint8_t *ptr = data;
+    size_t sent = 0;
+
+    /* gnrc_tcp_send() transmits at most one segment per call */
+    while (sent < len) {
+        ssize_t res = gnrc_tcp_send(&sock->tcb, ptr + sent, len - sent, 0);
+
+        if (res < 0) {
+            return (sent > 0) ? (ssize_t)sent : res;
+        }
+        sent += res;
+    }
+    return sent;
+}
+
+#ifdef SOCK_HAS_ASYNC
+/* The socks only consist of the GNRC TCP types and GNRC TCP reports events
+ * with the values of sock_async_flags_t, so the callbacks are passed on as
+ * they are */
+static_assert((GNRC_TCP_EVENT_CONN_RDY == SOCK_ASYNC_CONN_RDY) &&
+              (GNRC_TCP_EVENT_CONN_FIN == SOCK_ASYNC_CONN_FIN) &&
+              (GNRC_TCP_EVENT_CONN_RECV == SOCK_ASYNC_CONN_RECV) &&
+              (GNRC_TCP_EVENT_MSG_RECV == SOCK_ASYNC_MSG_RECV) &&
+              (GNRC_TCP_EVENT_MSG_SENT == SOCK_ASYNC_MSG_SENT),
+              "GNRC TCP events must match sock_async_flags_t");
+
+void sock_tcp_set_cb(sock_tcp_t *sock, sock_tcp_cb_t cb, void *cb_arg)
+{
+    assert(sock != NULL);
+    gnrc_tcp_tcb_set_cb(&sock->tcb, (gnrc_tcp_tcb_cb_t)cb, cb_arg);
+}
+
+void sock_tcp_queue_set_cb(sock_tcp_queue_t *queue, sock_tcp_queue_cb_t cb,
+                           void *cb_arg)
+{
+    assert(queue != NULL);
+    gnrc_tcp_tcb_queue_set_cb(&queue->queue, (gnrc_tcp_tcb_queue_cb_t)cb,
+                              cb_arg);
+}
+#endif  /* SOCK_HAS_ASYNC */
+
+/** @} */
@@ -194,21 +194,17 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
     return (nobufs) ? -ENOBUFS : ((res < 0) ? res : ret);
 }
 
-ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
-                          uint32_t timeout, sock_udp_ep_t *remote)
+/**
+ * @brief   Receives a packet for @p sock from the expected remote end point
+ */
+static ssize_t _recv(sock_udp_t *sock, gnrc_pktsnip_t **pkt_out,
+                     uint32_t timeout, sock_udp_ep_t *remote)
 {
     gnrc_pktsnip_t *pkt, *udp;
     udp_hdr_t *hdr;
     sock_ip_ep_t tmp;
     int res;
 
-    assert((sock != NULL) && (data != NULL) && (buf_ctx != NULL));
-    if (*buf_ctx != NULL) {
-        *data = NULL;
-        gnrc_pktbuf_release(*buf_ctx);
-        *buf_ctx = NULL;
-        return 0;
-    }
     if (sock->local.family == AF_UNSPEC) {
         return -EADDRNOTAVAIL;
     }
@@ -235,14 +231,93 @@ ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
         gnrc_pktbuf_release(pkt);
         return -EPROTO;
     }
+    *pkt_out = pkt;
+    return (ssize_t)pkt->size;
+}
+
+ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
+                          uint32_t timeout, sock_udp_ep_t *remote)
+{
+    gnrc_pktsnip_t *pkt;
+    ssize_t res;
+
+    assert((sock != NULL) && (data != NULL) && (buf_ctx != NULL));
+    if (*buf_ctx != NULL) {
+        *data = NULL;
+        gnrc_pktbuf_release(*buf_ctx);
+        *buf_ctx = NULL;
+        return 0;
+    }
+    res = _recv(sock, &pkt, timeout, remote);
+    if (res < 0) {
+        return res;
+    }
     *data = pkt->data;
     *buf_ctx = pkt;
-    res = (int)pkt->size;
     return res;
 }
 
-ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
-                      const sock_udp_ep_t *remote)
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_msg_t *msgs, unsigned num,
+                       uint32_t timeout)
+{
+    assert((sock != NULL) && (msgs != NULL) && (num > 0));
+    for (unsigned i = 0; i < num; i++) {
+        gnrc_pktsnip_t *pkt;
+        ssize_t res;
+
+        /* leave a following message that does not fit for the next call,
+         * instead of dropping it */
+        if ((i > 0) &&
+            ((res = gnrc_sock_peek_size((gnrc_sock_reg_t *)sock)) >= 0) &&
+            ((size_t)res > msgs[i].len)) {
+            return i;
+        }
+        /* only the first message is waited for, so the receive timer is
+         * armed at most once per batch */
+        res = _recv(sock, &pkt, (i == 0) ? timeout : 0, msgs[i].remote);
+        if ((res >= 0) && ((size_t)res > msgs[i].len)) {
+            gnrc_pktbuf_release(pkt);
+            res = -ENOBUFS;
+        }
+        if (res < 0) {
+            return (i == 0) ? res : (int)i;
+        }
+        memcpy(msgs[i].data, pkt->data, res);
+        msgs[i].len = res;
+        gnrc_pktbuf_release(pkt);
+    }
+    return num;
+}
+
+int sock_udp_recv_buf_many(sock_udp_t *sock, sock_udp_msg_t *msgs,
+                           unsigned num, uint32_t timeout)
+{
+    assert((sock != NULL) && (msgs != NULL) && (num > 0));
+    if (msgs[0].buf_ctx != NULL) {
+        for (unsigned i = 0; (i < num) && (msgs[i].buf_ctx != NULL); i++) {
+            gnrc_pktbuf_release(msgs[i].buf_ctx);
+            msgs[i].data = NULL;
+            msgs[i].buf_ctx = NULL;
+        }
+        return 0;
+    }
+    for (unsigned i = 0; i < num; i++) {
+        gnrc_pktsnip_t *pkt;
+        ssize_t res = _recv(sock, &pkt, (i == 0) ? timeout : 0,
+                            msgs[i].remote);
+
+        if (res < 0) {
+            return (i == 0) ? res : (int)i;
+        }
+        msgs[i].data = pkt->data;
+        msgs[i].len = res;
+        msgs[i].buf_ctx = pkt;
+    }
+    return num;
+}
+
+static ssize_t _send(sock_udp_t *sock, const void *data, size_t len,
+                     const sock_udp_ep_t *remote)
 {
     int res;
     gnrc_pktsnip_t *payload, *pkt;
@@ -338,15 +413,48 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
     }
+    return res;
+}
+
+static void _notify_sent(sock_udp_t *sock)
+{
 #ifdef SOCK_HAS_ASYNC
     if ((sock != NULL) && (sock->reg.async_cb.udp)) {
         sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
                                sock->reg.async_cb_arg);
     }
+#else   /* SOCK_HAS_ASYNC */
+    (void)sock;
 #endif  /* SOCK_HAS_ASYNC */
+}
+
+ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
+                      const sock_udp_ep_t *remote)
+{
+    ssize_t res = _send(sock, data, len, remote);
+
+    _notify_sent(sock);
     return res;
 }
 
+int sock_udp_send_many(sock_udp_t *sock, const sock_udp_msg_t *msgs,
+                       unsigned num)
+{
+    unsigned i;
+    ssize_t res = 0;
+
+    assert(msgs != NULL);
+    for (i = 0; i < num; i++) {
+        res = _send(sock, msgs[i].data, msgs[i].len, msgs[i].remote);
+        if (res < 0) {
+            break;
+        }
+    }
+    /* the sock is notified once for the whole batch */
+    _notify_sent(sock);
+    return ((i == 0) && (res < 0)) ? res : (int)i;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
@@ -30,6 +30,7 @@
 #include "internal/option.h"
 #include "internal/eventloop.h"
 #include "internal/rcvbuf.h"
+#include "internal/synq.h"
 
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
@@ -38,6 +39,11 @@
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
+/**
+ * @brief Helper macro for LL_SEARCH to compare listening queues
+ */
+#define QUEUE_EQUAL(a,b)    ((a) != (b))
+
 /**
  * @brief Allocate memory for GNRC TCP thread stack.
  */
@@ -62,6 +68,16 @@ gnrc_tcp_tcb_t *_list_tcb_head;
  */
 mutex_t _list_tcb_lock;
 
+/**
+ * @brief Head of linked listening queue list.
+ */
+gnrc_tcp_tcb_queue_t *_list_queue_head;
+
+/**
+ * @brief Mutex for listening queue list and SYN queue synchronization.
+ */
+mutex_t _list_queue_lock;
+
 /**
  * @brief Helper struct, holding all argument data for_cb_mbox_put_msg.
  */
@@ -98,6 +114,21 @@ static void _setup_timeout(xtimer_t *timer, const uint32_t duration, const xtime
     xtimer_set(timer, duration);
 }
 
+/**
+ * @brief Hands a TCB returned by gnrc_tcp_accept() back to its listening queue.
+ *
+ * @note Must be called after the TCB was closed and is no longer locked,
+ *       the listening queue may reinitialize it right away.
+ *
+ * @param[in,out] tcb   TCB to hand back.
+ */
+static void _release_accepted(gnrc_tcp_tcb_t *tcb)
+{
+    mutex_lock(&(tcb->fsm_lock));
+    tcb->status &= ~STATUS_ACCEPTED;
+    mutex_unlock(&(tcb->fsm_lock));
+}
+
 /**
  * @brief   Establishes a new TCP connection
  *
@@ -248,6 +279,34 @@ static int _gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote,
     return ret;
 }
 
+/**
+ * @brief Takes an established connection, that was not accepted yet, from a listening queue.
+ *
+ * @param[in,out] queue   Listening queue.
+ *
+ * @returns   TCB of the connection, now marked as accepted.
+ *            NULL if there is no such connection.
+ */
+static gnrc_tcp_tcb_t *_accept_established(gnrc_tcp_tcb_queue_t *queue)
+{
+    gnrc_tcp_tcb_t *ret = NULL;
+
+    mutex_lock(&_list_queue_lock);
+    for (size_t i = 0; (i < queue->tcbs_len) && (ret == NULL); i++) {
+        gnrc_tcp_tcb_t *tcb = &queue->tcbs[i];
+
+        mutex_lock(&(tcb->fsm_lock));
+        if (!(tcb->status & STATUS_ACCEPTED) &&
+            (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_CLOSE_WAIT)) {
+            tcb->status |= STATUS_ACCEPTED;
+            ret = tcb;
+        }
+        mutex_unlock(&(tcb->fsm_lock));
+    }
+    mutex_unlock(&_list_queue_lock);
+    return ret;
+}
+
 /* External GNRC TCP API */
 int gnrc_tcp_ep_init(gnrc_tcp_ep_t *ep, int family, const uint8_t *addr, size_t addr_size,
                      uint16_t port, uint16_t netif)
@@ -385,8 +444,12 @@ int gnrc_tcp_init(void)
     /* Initialize mutex for TCB list synchronization */
     mutex_init(&(_list_tcb_lock));
 
-    /* Initialize TCB list */
+    /* Initialize mutex for listening queue list synchronization */
+    mutex_init(&(_list_queue_lock));
+
+    /* Initialize TCB list and listening queue list */
     _list_tcb_head = NULL;
+    _list_queue_head = NULL;
     _rcvbuf_init();
 
     /* Start TCP processing thread */
@@ -459,6 +522,144 @@ int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *local)
 #endif
 }
 
+int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tcbs_len,
+                    const gnrc_tcp_ep_t *local)
+{
+    assert(queue != NULL);
+    assert(tcbs != NULL);
+    assert(tcbs_len > 0);
+    assert(local != NULL);
+    assert(local->port != PORT_UNSPEC);
+
+#ifdef MODULE_GNRC_IPV6
+    gnrc_tcp_tcb_queue_t *iter = NULL;
+    gnrc_tcp_tcb_t *tcb = NULL;
+
+    /* Check if given AF-Family in local is supported */
+    if (local->family != AF_INET6) {
+        return -EAFNOSUPPORT;
+    }
+
+    mutex_lock(&_list_queue_lock);
+
+    /* Check if the port is used by another listening queue or a passively opened TCB */
+    LL_SEARCH_SCALAR(_list_queue_head, iter, local_port, local->port);
+    mutex_lock(&_list_tcb_lock);
+    LL_FOREACH(_list_tcb_head, tcb) {
+        if (tcb->local_port == local->port && tcb->state == FSM_STATE_LISTEN) {
+            break;
+        }
+    }
+    mutex_unlock(&_list_tcb_lock);
+    if (iter != NULL || tcb != NULL) {
+        mutex_unlock(&_list_queue_lock);
+        return -EADDRINUSE;
+    }
+
+    /* Setup listening queue and its TCBs */
+    queue->address_family = local->family;
+    memcpy(queue->local_addr, local->addr.ipv6, sizeof(queue->local_addr));
+    queue->local_port = local->port;
+    queue->tcbs = tcbs;
+    queue->tcbs_len = tcbs_len;
+    for (size_t i = 0; i < tcbs_len; i++) {
+        gnrc_tcp_tcb_init(&tcbs[i]);
+    }
+    mbox_init(&(queue->mbox), queue->mbox_raw, GNRC_TCP_TCB_MBOX_SIZE);
+    mutex_init(&(queue->function_lock));
+
+    /* From now on connection requests to local are answered */
+    LL_PREPEND(_list_queue_head, queue);
+    mutex_unlock(&_list_queue_lock);
+    return 0;
+#else
+    return -EAFNOSUPPORT;
+#endif
+}
+
+int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
+                    const uint32_t user_timeout_duration_us)
+{
+    assert(queue != NULL);
+    assert(tcb != NULL);
+
+    msg_t msg;
+    xtimer_t user_timeout;
+    cb_arg_t user_timeout_arg = {MSG_TYPE_USER_SPEC_TIMEOUT, &(queue->mbox)};
+    bool timeout_set = (user_timeout_duration_us > 0) &&
+                       (user_timeout_duration_us != GNRC_TCP_NO_TIMEOUT);
+    int ret = 0;
+
+    /* Lock the queue for this function call */
+    mutex_lock(&(queue->function_lock));
+
+    /* Check if queue is listening */
+    if (queue->tcbs_len == 0) {
+        mutex_unlock(&(queue->function_lock));
+        return -EINVAL;
+    }
+
+    /* 'Flush' mbox */
+    while (mbox_try_get(&(queue->mbox), &msg) != 0) {
+    }
+
+    /* Setup user specified timeout */
+    if (timeout_set) {
+        _setup_timeout(&user_timeout, user_timeout_duration_us, _cb_mbox_put_msg,
+                       &user_timeout_arg);
+    }
+
+    /* Wait until a connection was established on queue */
+    while ((*tcb = _accept_established(queue)) == NULL) {
+        if (user_timeout_duration_us == 0) {
+            ret = -EAGAIN;
+            break;
+        }
+
+        mbox_get(&(queue->mbox), &msg);
+        if (msg.type == MSG_TYPE_USER_SPEC_TIMEOUT) {
+            DEBUG("gnrc_tcp.c : gnrc_tcp_accept() : USER_SPEC_TIMEOUT\n");
+            ret = -ETIMEDOUT;
+            break;
+        }
+    }
+
+    /* Cleanup */
+    if (timeout_set) {
+        xtimer_remove(&user_timeout);
+    }
+    mutex_unlock(&(queue->function_lock));
+    return ret;
+}
+
+void gnrc_tcp_stop_listen(gnrc_tcp_tcb_queue_t *queue)
+{
+    assert(queue != NULL);
+
+    gnrc_tcp_tcb_queue_t *iter = NULL;
+
+    /* Lock the queue for this function call */
+    mutex_lock(&(queue->function_lock));
+
+    /* Stop answering connection requests, drop half-open connections */
+    mutex_lock(&_list_queue_lock);
+    LL_SEARCH(_list_queue_head, iter, queue, QUEUE_EQUAL);
+    if (iter != NULL) {
+        LL_DELETE(_list_queue_head, queue);
+    }
+    _synq_flush(queue);
+    mutex_unlock(&_list_queue_lock);
+
+    /* Abort connections, that were not accepted */
+    for (size_t i = 0; i < queue->tcbs_len; i++) {
+        if (!(queue->tcbs[i].status & STATUS_ACCEPTED)) {
+            gnrc_tcp_abort(&queue->tcbs[i]);
+        }
+    }
+    queue->tcbs_len = 0;
+    mutex_unlock(&(queue->function_lock));
+}
+
 ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                       const uint32_t timeout_duration_us)
 {
@@ -501,8 +702,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         _setup_timeout(&user_timeout, timeout_duration_us, _cb_mbox_put_msg, &user_timeout_arg);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until everything was sent and acked */
+    while (ret >= 0 && ((size_t)ret < len || tcb->pkt_retransmit_num > 0)) {
         /* Check if the connections state is closed. If so, a reset was received */
         if (tcb->state == FSM_STATE_CLOSED) {
             ret = -ECONNRESET;
@@ -521,9 +722,9 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                            &probe_timeout_arg);
         }
 
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
-            ret = _fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+        /* Try to send data in case there is data left and we are not probing */
+        if ((size_t)ret < len && !probing_mode) {
+            ret += _fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (uint8_t *) data + ret, len - ret);
         }
 
         /* Wait for responses */
@@ -703,6 +904,7 @@ void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb)
     /* Return if connection is closed */
     if (tcb->state == FSM_STATE_CLOSED) {
         mutex_unlock(&(tcb->function_lock));
+        _release_accepted(tcb);
         return;
     }
 
@@ -742,6 +944,7 @@ void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb)
     xtimer_remove(&connection_timeout);
     tcb->status &= ~STATUS_WAIT_FOR_MSG;
     mutex_unlock(&(tcb->function_lock));
+    _release_accepted(tcb);
 }
 
 void gnrc_tcp_abort(gnrc_tcp_tcb_t *tcb)
@@ -755,7 +958,54 @@ void gnrc_tcp_abort(gnrc_tcp_tcb_t *tcb)
         _fsm(tcb, FSM_EVENT_CALL_ABORT, NULL, NULL, 0);
     }
     mutex_unlock(&(tcb->function_lock));
+    _release_accepted(tcb);
+}
+
+#ifdef SOCK_HAS_ASYNC
+void gnrc_tcp_tcb_set_cb(gnrc_tcp_tcb_t *tcb, gnrc_tcp_tcb_cb_t cb, void *arg)
+{
+    assert(tcb != NULL);
+
+    unsigned events = 0;
+
+    mutex_lock(&(tcb->fsm_lock));
+    tcb->async_cb = cb;
+    tcb->async_cb_arg = arg;
+
+    /* Report what happened before the callback was set */
+    if (tcb->rcv_buf.avail > 0) {
+        events |= GNRC_TCP_EVENT_MSG_RECV;
+    }
+    if (tcb->state == FSM_STATE_CLOSE_WAIT || tcb->state == FSM_STATE_CLOSED) {
+        events |= GNRC_TCP_EVENT_CONN_FIN;
+    }
+    if ((cb != NULL) && events) {
+        cb(tcb, events, arg);
+    }
+    mutex_unlock(&(tcb->fsm_lock));
+}
+
+void gnrc_tcp_tcb_queue_set_cb(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_queue_cb_t cb,
+                               void *arg)
+{
+    assert(queue != NULL);
+
+    mutex_lock(&_list_queue_lock);
+    queue->async_cb = cb;
+    queue->async_cb_arg = arg;
+
+    /* Report connections established before the callback was set */
+    for (size_t i = 0; (cb != NULL) && (i < queue->tcbs_len); i++) {
+        gnrc_tcp_tcb_t *tcb = &queue->tcbs[i];
+
+        if (!(tcb->status & STATUS_ACCEPTED) &&
+            (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_CLOSE_WAIT)) {
+            cb(queue, GNRC_TCP_EVENT_CONN_RECV, arg);
+        }
+    }
+    mutex_unlock(&_list_queue_lock);
 }
+#endif
 
 int gnrc_tcp_calc_csum(const gnrc_pktsnip_t *hdr, const gnrc_pktsnip_t *pseudo_hdr)
 {
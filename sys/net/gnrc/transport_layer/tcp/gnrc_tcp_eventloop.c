@@ -26,6 +26,7 @@
 #include "internal/pkt.h"
 #include "internal/fsm.h"
 #include "internal/eventloop.h"
+#include "internal/synq.h"
 
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
@@ -83,6 +84,47 @@ static int _send(gnrc_pktsnip_t *pkt)
     return 0;
 }
 
+/**
+ * @brief Passes a packet to the listening queue on its destination, if any.
+ *
+ * @param[in] pkt   Incoming packet.
+ * @param[in] ip    Network layer header of @p pkt.
+ * @param[in] dst   Destination port of @p pkt.
+ *
+ * @returns   Zero if a listening queue handled @p pkt.
+ *            -ENOTCONN if @p pkt should be reset.
+ */
+static int _receive_queue(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *ip, uint16_t dst)
+{
+    gnrc_tcp_tcb_queue_t *queue = NULL;
+    int ret = -ENOTCONN;
+
+    mutex_lock(&_list_queue_lock);
+    LL_FOREACH(_list_queue_head, queue) {
+#ifdef MODULE_GNRC_IPV6
+        /* Port must match, local addr must be unspec or equal to the destination */
+        if (ip->type == GNRC_NETTYPE_IPV6 && queue->address_family == AF_INET6 &&
+            queue->local_port == dst) {
+            ipv6_addr_t *tmp_addr = &((ipv6_hdr_t *)ip->data)->dst;
+
+            if (ipv6_addr_equal((ipv6_addr_t *) queue->local_addr, tmp_addr) ||
+                ipv6_addr_is_unspecified((ipv6_addr_t *) queue->local_addr)) {
+                break;
+            }
+        }
+#else
+        /* Suppress compiler warnings if TCP is built without network layer */
+        (void) ip;
+        (void) dst;
+#endif
+    }
+    if (queue != NULL) {
+        ret = _synq_rcvd_pkt(queue, pkt);
+    }
+    mutex_unlock(&_list_queue_lock);
+    return ret;
+}
+
 /**
  * @brief Receive function, receive packet from network layer.
  *
@@ -219,6 +261,10 @@ static int _receive(gnrc_pktsnip_t *pkt)
     if (tcb != NULL) {
         _fsm(tcb, FSM_EVENT_RCVD_PKT, pkt, NULL, 0);
     }
+    /* Otherwise let a listening queue on the destination port handle the packet */
+    else if (_receive_queue(pkt, ip, dst) == 0) {
+        DEBUG("gnrc_tcp_eventloop.c : _receive() : Handled by listening queue\n");
+    }
     /* No fitting TCB has been found. Respond with reset */
     else {
         DEBUG("gnrc_tcp_eventloop.c : _receive() : Can't find fitting tcb\n");
@@ -292,6 +338,12 @@ void *_event_loop(__attribute__((unused)) void *arg)
                      NULL, NULL, 0);
                 break;
 
+            /* SYN queue timer expired: Retransmit SYN+ACKs, drop expired entries */
+            case MSG_TYPE_SYNQ_TIMEOUT:
+                DEBUG("gnrc_tcp_eventloop.c : _event_loop() : MSG_TYPE_SYNQ_TIMEOUT\n");
+                _synq_timeout();
+                break;
+
             default:
                 DEBUG("gnrc_tcp_eventloop.c : _event_loop() : received expected message\n");
         }
@@ -83,14 +83,183 @@ static uint16_t _get_random_local_port(void)
  */
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
-    if (tcb->pkt_retransmit != NULL) {
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
+    if (tcb->pkt_retransmit_num > 0) {
+        for (uint8_t i = 0; i < tcb->pkt_retransmit_num; i++) {
+            gnrc_pktbuf_release(tcb->pkt_retransmit[i]);
+        }
         xtimer_remove(&(tcb->tim_tout));
-        tcb->pkt_retransmit = NULL;
+        tcb->pkt_retransmit_num = 0;
+        tcb->pkt_sacked = 0;
     }
     return 0;
 }
 
+/**
+ * @brief Calculates the sender maximum segment size (SMSS).
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @return   Largest payload of a segment sent to the peer.
+ */
+static inline uint32_t _get_smss(const gnrc_tcp_tcb_t *tcb)
+{
+    return (tcb->mss < GNRC_TCP_MSS) ? tcb->mss : GNRC_TCP_MSS;
+}
+
+/**
+ * @brief Initializes congestion control of an established connection (RFC 5681).
+ *
+ * @param[in,out] tcb   TCB holding the congestion control state.
+ */
+static void _congestion_init(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = _get_smss(tcb);
+
+    /* Initial window, see RFC 5681 section 3.1 */
+    if (smss > 2190) {
+        tcb->cwnd = 2 * smss;
+    }
+    else if (smss > 1095) {
+        tcb->cwnd = 3 * smss;
+    }
+    else {
+        tcb->cwnd = 4 * smss;
+    }
+    tcb->ssthresh = UINT32_MAX;
+    tcb->dup_acks = 0;
+    tcb->status &= ~STATUS_RECOVERY;
+}
+
+/**
+ * @brief Adjusts congestion control on acknowledgment of new data (RFC 5681, RFC 6582).
+ *
+ * @note Must be called after snd_una and the retransmit queue were updated.
+ *
+ * @param[in,out] tcb     TCB holding the congestion control state.
+ * @param[in]     acked   Number of newly acknowledged bytes.
+ */
+static void _congestion_ack(gnrc_tcp_tcb_t *tcb, const uint32_t acked)
+{
+    uint32_t smss = _get_smss(tcb);
+
+    if (tcb->status & STATUS_RECOVERY) {
+        /* Full acknowledgment: Leave loss recovery, deflate window after fast recovery */
+        if (LEQ_32_BIT(tcb->recover, tcb->snd_una)) {
+            if (tcb->dup_acks >= 3) {
+                uint32_t flight = tcb->snd_nxt - tcb->snd_una;
+                flight = ((flight > smss) ? flight : smss) + smss;
+                tcb->cwnd = (flight < tcb->ssthresh) ? flight : tcb->ssthresh;
+            }
+            tcb->status &= ~STATUS_RECOVERY;
+            tcb->dup_acks = 0;
+            return;
+        }
+        /* Partial acknowledgment in fast recovery: Deflate window by the acknowledged data */
+        if (tcb->dup_acks >= 3) {
+            tcb->cwnd = (tcb->cwnd > acked + smss) ? tcb->cwnd - acked : smss;
+            if (acked >= smss) {
+                tcb->cwnd += smss;
+            }
+        }
+        /* Partial acknowledgment after a timeout: Slow start */
+        else {
+            tcb->cwnd += (acked < smss) ? acked : smss;
+        }
+        /* Retransmit the next segment considered lost */
+        _pkt_retransmit_lost(tcb);
+        return;
+    }
+    tcb->dup_acks = 0;
+
+    /* A window larger than the retransmit queue can hold is of no use */
+    if (tcb->cwnd >= GNRC_TCP_RETRANSMIT_QUEUE_SIZE * smss) {
+        return;
+    }
+    /* Slow start: Grow by at most one SMSS per ACK */
+    if (tcb->cwnd < tcb->ssthresh) {
+        tcb->cwnd += (acked < smss) ? acked : smss;
+    }
+    /* Congestion avoidance: Grow by about one SMSS per round trip */
+    else {
+        tcb->cwnd += (smss * smss >= tcb->cwnd) ? (smss * smss) / tcb->cwnd : 1;
+    }
+}
+
+/**
+ * @brief Adjusts congestion control on a duplicate acknowledgment (RFC 5681, RFC 6582).
+ *
+ * @param[in,out] tcb   TCB holding the congestion control state.
+ */
+static void _congestion_dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = _get_smss(tcb);
+
+    /* Fast retransmit on the third duplicate ACK, then enter fast recovery */
+    if (!(tcb->status & STATUS_RECOVERY)) {
+        if (++(tcb->dup_acks) == 3) {
+            uint32_t flight = tcb->snd_nxt - tcb->snd_una;
+
+            tcb->ssthresh = (flight / 2 > 2 * smss) ? flight / 2 : 2 * smss;
+            tcb->recover = tcb->snd_nxt;
+            tcb->rxt_nxt = tcb->snd_una;
+            tcb->status |= STATUS_RECOVERY;
+            _pkt_retransmit_lost(tcb);
+            tcb->cwnd = tcb->ssthresh + 3 * smss;
+        }
+    }
+    /* Fast recovery: Every duplicate ACK signals a segment that has left the network */
+    else if (tcb->dup_acks >= 3) {
+        tcb->cwnd += smss;
+        _pkt_retransmit_lost(tcb);
+
+        /* Signal user, the inflated window may allow sending new data */
+        tcb->status |= STATUS_NOTIFY_USER;
+    }
+}
+
+/**
+ * @brief Adjusts congestion control on a retransmission timeout (RFC 5681, RFC 6582).
+ *
+ * @param[in,out] tcb   TCB holding the congestion control state.
+ */
+static void _congestion_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = _get_smss(tcb);
+
+    /* Only the first timeout of a segment reduces the slow start threshold */
+    if (tcb->retries == 0) {
+        uint32_t flight = tcb->snd_nxt - tcb->snd_una;
+        tcb->ssthresh = (flight / 2 > 2 * smss) ? flight / 2 : 2 * smss;
+    }
+    tcb->cwnd = smss;
+    tcb->dup_acks = 0;
+    tcb->recover = tcb->snd_nxt;
+    tcb->status |= STATUS_RECOVERY;
+
+    /* The peer may discard data it SACKed, SACK information must be ignored (RFC 2018) */
+    tcb->pkt_sacked = 0;
+}
+
+/**
+ * @brief Applies the options negotiated on connection setup.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[in]     opts   Options of the peers SYN.
+ */
+static void _negotiate_options(gnrc_tcp_tcb_t *tcb, const option_values_t *opts)
+{
+    tcb->status &= ~(STATUS_WND_SCALE | STATUS_SACK_PERM);
+    tcb->status |= _option_select(opts);
+    if (tcb->status & STATUS_WND_SCALE) {
+        tcb->snd_wnd_scale = opts->wnd_scale;
+        tcb->rcv_wnd_scale = _option_get_rcv_wnd_scale();
+    }
+    else {
+        tcb->snd_wnd_scale = 0;
+        tcb->rcv_wnd_scale = 0;
+    }
+}
+
 /**
  * @brief Restarts timewait timer.
  *
@@ -123,8 +292,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
 
     switch (state) {
         case FSM_STATE_CLOSED:
-            /* Clear retransmit queue */
+            /* Clear retransmit queue and segments held back */
             _clear_retransmit(tcb);
+            _pkt_ooo_clear(tcb);
 
             /* Remove connection from active connections */
             mutex_lock(&_list_tcb_lock);
@@ -152,6 +322,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
             if (_rcvbuf_get_buffer(tcb) == -ENOMEM) {
                 return -ENOMEM;
             }
+            tcb->rcv_wnd = _rcvbuf_get_free(tcb);
 
             /* Add connection to active connections (if not already active) */
             mutex_lock(&_list_tcb_lock);
@@ -167,6 +338,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
             if (_rcvbuf_get_buffer(tcb) == -ENOMEM) {
                 return -ENOMEM;
             }
+            tcb->rcv_wnd = _rcvbuf_get_free(tcb);
 
             /* Add connection to active connections (if not already active) */
             mutex_lock(&_list_tcb_lock);
@@ -192,7 +364,27 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
             break;
 
         case FSM_STATE_SYN_RCVD:
+            /* Allocate receive buffer, only missing if handed out by a listening queue */
+            if (_rcvbuf_get_buffer(tcb) == -ENOMEM) {
+                return -ENOMEM;
+            }
+            tcb->rcv_wnd = _rcvbuf_get_free(tcb);
+
+            /* Add connection to active connections (if not already active) */
+            mutex_lock(&_list_tcb_lock);
+            LL_SEARCH(_list_tcb_head, iter, tcb, TCB_EQUAL);
+            if (iter == NULL) {
+                LL_PREPEND(_list_tcb_head, tcb);
+            }
+            mutex_unlock(&_list_tcb_lock);
+            tcb->status |= STATUS_NOTIFY_USER;
+            break;
+
         case FSM_STATE_ESTABLISHED:
+            _congestion_init(tcb);
+            tcb->status |= STATUS_NOTIFY_USER;
+            break;
+
         case FSM_STATE_CLOSE_WAIT:
             tcb->status |= STATUS_NOTIFY_USER;
             break;
@@ -222,7 +414,6 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
     int ret = 0;
 
     DEBUG("gnrc_tcp_fsm.c : _fsm_call_open()\n");
-    tcb->rcv_wnd = GNRC_TCP_DEFAULT_WINDOW;
 
     if (tcb->status & STATUS_PASSIVE) {
         /* Passive open, T: CLOSED -> LISTEN */
@@ -237,6 +428,12 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         tcb->snd_nxt = tcb->iss;
         tcb->snd_una = tcb->iss;
 
+        /* Offer options, the SYN+ACK tells which ones the peer supports */
+        tcb->status &= ~(STATUS_WND_SCALE | STATUS_SACK_PERM);
+        tcb->status |= _option_select(NULL);
+        tcb->snd_wnd_scale = 0;
+        tcb->rcv_wnd_scale = 0;
+
         /* Transition FSM to SYN_SENT */
         ret = _transition_to(tcb, FSM_STATE_SYN_SENT);
         if (ret < 0) {
@@ -267,24 +464,40 @@ static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_call_send()\n");
 
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    uint32_t smss = _get_smss(tcb);
+    size_t sent = 0;
+
+    /* Send segments as long as the retransmit queue, send and congestion window allow */
+    while (sent < len && tcb->pkt_retransmit_num < GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
+        uint32_t flight = tcb->snd_nxt - tcb->snd_una;
+        uint32_t wnd = (tcb->snd_wnd < tcb->cwnd) ? tcb->snd_wnd : tcb->cwnd;
+
+        /* Check if window is open */
+        if (wnd <= flight) {
+            break;
+        }
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
-        payload = (payload < GNRC_TCP_MSS) ? payload : GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        size_t payload = wnd - flight;
+        payload = (payload < smss) ? payload : smss;
+        payload = (payload < len - sent) ? payload : len - sent;
+
+        /* Avoid small segments while data is in flight (Silly Window Syndrome) */
+        if (flight > 0 && payload < smss && payload < len - sent) {
+            break;
+        }
 
-        /* Calculate payload size for this segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt, tcb->rcv_nxt,
+                       (uint8_t *)buf + sent, payload) < 0) {
+            break;
+        }
         _pkt_setup_retransmit(tcb, out_pkt, false);
         _pkt_send(tcb, out_pkt, seq_con, false);
-        return payload;
+        sent += payload;
     }
-    return 0;
+    return sent;
 }
 
 /**
@@ -300,16 +513,21 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_call_recv()\n");
 
-    if (ringbuffer_empty(&tcb->rcv_buf)) {
+    if (tcb->rcv_buf.avail == 0) {
         return 0;
     }
 
     /* Read data into 'buf' up to 'len' bytes from receive buffer */
-    size_t rcvd = ringbuffer_get(&(tcb->rcv_buf), buf, len);
+    size_t rcvd = _rcvbuf_get(tcb, buf, len);
 
-    /* If receive buffer can store more than GNRC_TCP_MSS: open window to available buffer size */
-    if (ringbuffer_get_free(&tcb->rcv_buf) >= GNRC_TCP_MSS) {
-        tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+    /* If the window can grow by GNRC_TCP_MSS or half the receive buffer: open window to
+     * available buffer size. Smaller updates are held back (Receiver SWS avoidance), they
+     * would also look like duplicate ACKs to the peer. */
+    uint32_t rcv_wnd = _rcvbuf_get_free(tcb);
+    if (rcv_wnd > tcb->rcv_wnd &&
+        rcv_wnd - tcb->rcv_wnd >= ((GNRC_TCP_MSS < GNRC_TCP_RCV_BUF_SIZE / 2) ?
+                                   GNRC_TCP_MSS : GNRC_TCP_RCV_BUF_SIZE / 2)) {
+        tcb->rcv_wnd = rcv_wnd;
 
         /* Send ACK to anounce window update */
         gnrc_pktsnip_t *out_pkt = NULL;
@@ -404,6 +622,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     uint32_t seg_wnd = 0;            /* Receive window of the incoming packet */
     uint32_t seg_len = 0;            /* Segment length of the incoming packet */
     uint32_t pay_len = 0;            /* Payload length of the incoming packet */
+    option_values_t opts;            /* Options of the incoming packet */
 
     DEBUG("gnrc_tcp_fsm.c : _fsm_rcvd_pkt()\n");
     /* Search for TCP header. */
@@ -411,9 +630,12 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     tcp_hdr_t *tcp_hdr = (tcp_hdr_t *) snp->data;
 
     /* Parse packet options, return if they are malformed */
-    if (_option_parse(tcb, tcp_hdr) < 0) {
+    if (_option_parse(&opts, tcp_hdr) < 0) {
         return 0;
     }
+    if (opts.present & OPTION_MSS) {
+        tcb->mss = opts.mss;
+    }
 
     /* Extract header values */
     ctl = byteorder_ntohs(tcp_hdr->off_ctl);
@@ -421,6 +643,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     seg_ack = byteorder_ntohl(tcp_hdr->ack_num);
     seg_wnd = byteorder_ntohs(tcp_hdr->window);
 
+    /* The window of a SYN is never scaled (RFC 7323) */
+    if (!(ctl & MSK_SYN)) {
+        seg_wnd <<= tcb->snd_wnd_scale;
+    }
+
     /* Extract network layer header */
 #ifdef MODULE_GNRC_IPV6
     LL_SEARCH_SCALAR(in_pkt, snp, type, GNRC_NETTYPE_IPV6);
@@ -506,6 +733,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->snd_una = tcb->iss;
             tcb->snd_nxt = tcb->iss;
             tcb->snd_wnd = seg_wnd;
+            _negotiate_options(tcb, &opts);
 
             /* Send SYN+ACK: seq_no = iss, ack_no = rcv_nxt, T: LISTEN -> SYN_RCVD */
             _pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN_ACK, tcb->iss, tcb->rcv_nxt, NULL, 0);
@@ -541,6 +769,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
         if (ctl & MSK_SYN) {
             tcb->rcv_nxt = seg_seq + 1;
             tcb->irs = seg_seq;
+            _negotiate_options(tcb, &opts);
             if (ctl & MSK_ACK) {
                 tcb->snd_una = seg_ack;
                 _pkt_acknowledge(tcb, seg_ack);
@@ -632,8 +861,30 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    uint32_t acked = seg_ack - tcb->snd_una;
+
                     tcb->snd_una = seg_ack;
                     _pkt_acknowledge(tcb, seg_ack);
+                    if ((tcb->status & STATUS_SACK_PERM) && opts.sack_num > 0) {
+                        _pkt_mark_sacked(tcb, &opts);
+                    }
+                    _congestion_ack(tcb, acked);
+
+                    /* Signal user, more data may be sent */
+                    tcb->status |= STATUS_NOTIFY_USER;
+                }
+                /* Duplicate ACK: Acknowledges nothing new, while data is outstanding. It
+                 * either repeats the window or SACKs new data (RFC 5681, RFC 6675). */
+                else if (seg_ack == tcb->snd_una && pay_len == 0 && !(ctl & (MSK_SYN | MSK_FIN)) &&
+                         tcb->pkt_retransmit_num > 0) {
+                    int sacked = 0;
+
+                    if ((tcb->status & STATUS_SACK_PERM) && opts.sack_num > 0) {
+                        sacked = _pkt_mark_sacked(tcb, &opts);
+                    }
+                    if (seg_wnd == tcb->snd_wnd || sacked > 0) {
+                        _congestion_dup_ack(tcb);
+                    }
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -657,25 +908,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_num == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_num == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_num == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit_num == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         return 0;
                     }
@@ -690,21 +941,31 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             /* Check if state is valid for payload receiving */
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2) {
-                /* Search for begin of payload */
-                LL_SEARCH_SCALAR(in_pkt, snp, type, GNRC_NETTYPE_UNDEF);
+                /* Accept only data that is expected, to be received. Segments starting
+                 * before rcv_nxt are retransmissions of data partially received. */
+                if (LEQ_32_BIT(seg_seq, tcb->rcv_nxt) &&
+                    LSS_32_BIT(tcb->rcv_nxt, seg_seq + pay_len)) {
+                    uint32_t r_edge = tcb->rcv_nxt + tcb->rcv_wnd;
 
-                /* Accept only data that is expected, to be received */
-                if (tcb->rcv_nxt == seg_seq) {
                     /* Copy contents into receive buffer */
-                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
-                        snp = snp->next;
+                    _pkt_add_payload(tcb, in_pkt);
+                    /* Segments held back behind the filled gap follow */
+                    _pkt_ooo_drain(tcb);
+
+                    /* Shrink receive window. If other connections took pages from the pool,
+                     * less space is left than announced: do not move the right edge back. */
+                    tcb->rcv_wnd = _rcvbuf_get_free(tcb);
+                    if (LSS_32_BIT(tcb->rcv_nxt + tcb->rcv_wnd, r_edge)) {
+                        tcb->rcv_wnd = r_edge - tcb->rcv_nxt;
                     }
-                    /* Shrink receive window */
-                    tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
+                /* Hold back data behind a gap, if it fits into the receive window */
+                else if (LSS_32_BIT(tcb->rcv_nxt, seg_seq) && !(ctl & MSK_FIN) &&
+                         LEQ_32_BIT(seg_seq + pay_len, tcb->rcv_nxt + tcb->rcv_wnd)) {
+                    _pkt_ooo_add(tcb, in_pkt);
+                }
                 /* Send ACK, if FIN processing sends ACK already */
                 /* NOTE: this is the place to add payload piggybagging in the future */
                 if (!(ctl & MSK_FIN)) {
@@ -720,6 +981,12 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_SYN_SENT) {
                 return 0;
             }
+            /* A FIN behind a gap is processed on retransmission, acknowledge the gap */
+            if (tcb->rcv_nxt != seg_seq + pay_len) {
+                _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
+                _pkt_send(tcb, out_pkt, seq_con, false);
+                return 0;
+            }
             /* Advance rcv_nxt over FIN bit */
             tcb->rcv_nxt = seg_seq + seg_len;
             _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
@@ -729,7 +996,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->pkt_retransmit_num == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -747,6 +1014,29 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     return 0;
 }
 
+/**
+ * @brief FSM handling function for a handshake completed on a listening queue.
+ *
+ * @note The SYN+ACK was sent from the SYN queue, the caller has set up @p tcb
+ *       from the SYN queue entry.
+ *
+ * @param[in,out] tcb      TCB holding the connection information.
+ * @param[in]     in_pkt   Incoming packet acknowledging the SYN+ACK.
+ *
+ * @returns   Zero on success.
+ *            -ENOMEM if receive buffer could not be allocated.
+ */
+static int _fsm_rcvd_handshake(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
+{
+    DEBUG("gnrc_tcp_fsm.c : _fsm_rcvd_handshake()\n");
+
+    /* T: CLOSED -> SYN_RCVD, the regular processing of the ACK leads to ESTABLISHED */
+    if (_transition_to(tcb, FSM_STATE_SYN_RCVD) == -ENOMEM) {
+        return -ENOMEM;
+    }
+    return _fsm_rcvd_pkt(tcb, in_pkt);
+}
+
 /**
  * @brief FSM handling function for timewait timeout handling.
  *
@@ -771,9 +1061,14 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit()\n");
-    if (tcb->pkt_retransmit != NULL) {
-        _pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->pkt_retransmit_num > 0) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[0];
+
+        /* Retransmit the oldest segment, the others follow during loss recovery */
+        _congestion_timeout(tcb);
+        tcb->rxt_nxt = tcb->snd_una + _pkt_get_seg_len(pkt);
+        _pkt_setup_retransmit(tcb, pkt, true);
+        _pkt_send(tcb, pkt, 0, true);
     }
     else {
         DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit() : Retransmit queue is empty\n");
@@ -883,15 +1178,69 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, fsm_event_t event, gnrc_pktsnip
         case FSM_EVENT_CLEAR_RETRANSMIT :
             ret = _fsm_clear_retransmit(tcb);
             break;
+        case FSM_EVENT_RCVD_HANDSHAKE :
+            ret = _fsm_rcvd_handshake(tcb, in_pkt);
+            break;
     }
     return ret;
 }
 
+#ifdef SOCK_HAS_ASYNC
+/**
+ * @brief Reports events caused by an FSM call to the event callback of a TCB.
+ *
+ * @param[in] tcb       TCB the FSM was called on.
+ * @param[in] state     State of @p tcb before the FSM call.
+ * @param[in] avail     Number of bytes in the receive buffer before the FSM call.
+ * @param[in] snd_una   snd_una of @p tcb before the FSM call.
+ */
+static void _fsm_report_events(gnrc_tcp_tcb_t *tcb, uint8_t state, uint32_t avail,
+                               uint32_t snd_una)
+{
+    unsigned events = 0;
+
+    if (tcb->async_cb == NULL) {
+        return;
+    }
+    if (tcb->rcv_buf.avail > avail) {
+        events |= GNRC_TCP_EVENT_MSG_RECV;
+    }
+    /* snd_una is initialized when a connection is opened */
+    if (state != FSM_STATE_CLOSED && LSS_32_BIT(snd_una, tcb->snd_una)) {
+        events |= GNRC_TCP_EVENT_MSG_SENT;
+    }
+    if (tcb->state != state) {
+        switch (tcb->state) {
+            case FSM_STATE_ESTABLISHED:
+                events |= GNRC_TCP_EVENT_CONN_RDY;
+                break;
+            case FSM_STATE_CLOSE_WAIT:
+            case FSM_STATE_CLOSING:
+            case FSM_STATE_TIME_WAIT:
+            case FSM_STATE_CLOSED:
+                events |= GNRC_TCP_EVENT_CONN_FIN;
+                break;
+            default:
+                break;
+        }
+    }
+    if (events) {
+        tcb->async_cb(tcb, events, tcb->async_cb_arg);
+    }
+}
+#endif
+
 int _fsm(gnrc_tcp_tcb_t *tcb, fsm_event_t event, gnrc_pktsnip_t *in_pkt, void *buf, size_t len)
 {
     /* Lock FSM */
     mutex_lock(&(tcb->fsm_lock));
 
+#ifdef SOCK_HAS_ASYNC
+    uint8_t state = tcb->state;
+    uint32_t avail = tcb->rcv_buf.avail;
+    uint32_t snd_una = tcb->snd_una;
+#endif
+
     /* Call FSM */
     tcb->status &= ~STATUS_NOTIFY_USER;
     int32_t result = _fsm_unprotected(tcb, event, in_pkt, buf, len);
@@ -902,6 +1251,9 @@ int _fsm(gnrc_tcp_tcb_t *tcb, fsm_event_t event, gnrc_pktsnip_t *in_pkt, void *b
         msg.type = MSG_TYPE_NOTIFY_USER;
         mbox_try_put(&(tcb->mbox), &msg);
     }
+#ifdef SOCK_HAS_ASYNC
+    _fsm_report_events(tcb, state, avail, snd_una);
+#endif
     /* Unlock FSM */
     mutex_unlock(&(tcb->fsm_lock));
     return result;
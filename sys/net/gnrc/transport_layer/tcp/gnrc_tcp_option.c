@@ -16,14 +16,98 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  * @}
  */
+#include <string.h>
 #include "internal/common.h"
 #include "internal/option.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
-int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
+uint16_t _option_select(const option_values_t *opts)
 {
+    uint16_t status = 0;
+
+    /* Larger windows and SACK are only of use if several segments can be in flight */
+    if (GNRC_TCP_RETRANSMIT_QUEUE_SIZE > 1 || _option_get_rcv_wnd_scale() > 0) {
+        status |= STATUS_WND_SCALE;
+    }
+    if (GNRC_TCP_RETRANSMIT_QUEUE_SIZE > 1 || GNRC_TCP_RCV_OOO_QUEUE_SIZE > 0) {
+        status |= STATUS_SACK_PERM;
+    }
+
+    /* Options are only used if both sides sent them in their SYN */
+    if (opts != NULL) {
+        if (!(opts->present & OPTION_WS)) {
+            status &= ~STATUS_WND_SCALE;
+        }
+        if (!(opts->present & OPTION_SACK_PERM)) {
+            status &= ~STATUS_SACK_PERM;
+        }
+    }
+    return status;
+}
+
+uint8_t _option_get_syn_len(uint16_t status)
+{
+    uint8_t len = 1;
+
+    if (status & STATUS_WND_SCALE) {
+        len += 1;
+    }
+    if (status & STATUS_SACK_PERM) {
+        len += 1;
+    }
+    return len;
+}
+
+void _option_build_syn(uint8_t *opt_ptr, uint16_t status)
+{
+    network_uint32_t mss_option = byteorder_htonl(_option_build_mss(GNRC_TCP_MSS));
+    memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+    opt_ptr += sizeof(mss_option);
+
+    /* Window scale option, aligned by a leading NOP */
+    if (status & STATUS_WND_SCALE) {
+        opt_ptr[0] = TCP_OPTION_KIND_NOP;
+        opt_ptr[1] = TCP_OPTION_KIND_WS;
+        opt_ptr[2] = TCP_OPTION_LENGTH_WS;
+        opt_ptr[3] = _option_get_rcv_wnd_scale();
+        opt_ptr += 4;
+    }
+    /* SACK permitted option, aligned by two leading NOPs */
+    if (status & STATUS_SACK_PERM) {
+        opt_ptr[0] = TCP_OPTION_KIND_NOP;
+        opt_ptr[1] = TCP_OPTION_KIND_NOP;
+        opt_ptr[2] = TCP_OPTION_KIND_SACK_PERM;
+        opt_ptr[3] = TCP_OPTION_LENGTH_SACK_PERM;
+    }
+}
+
+void _option_build_sack(uint8_t *opt_ptr, const uint32_t (*blocks)[2], uint8_t num)
+{
+    /* SACK option, aligned by two leading NOPs */
+    opt_ptr[0] = TCP_OPTION_KIND_NOP;
+    opt_ptr[1] = TCP_OPTION_KIND_NOP;
+    opt_ptr[2] = TCP_OPTION_KIND_SACK;
+    opt_ptr[3] = TCP_OPTION_LENGTH_MIN + num * TCP_OPTION_LENGTH_SACK_BLOCK;
+    opt_ptr += 4;
+
+    for (uint8_t i = 0; i < num; i++) {
+        network_uint32_t edge;
+
+        edge = byteorder_htonl(blocks[i][0]);
+        memcpy(opt_ptr, &edge, sizeof(edge));
+        edge = byteorder_htonl(blocks[i][1]);
+        memcpy(opt_ptr + sizeof(edge), &edge, sizeof(edge));
+        opt_ptr += TCP_OPTION_LENGTH_SACK_BLOCK;
+    }
+}
+
+int _option_parse(option_values_t *opts, tcp_hdr_t *hdr)
+{
+    opts->present = 0;
+    opts->sack_num = 0;
+
     /* Extract offset value. Return if no options are set */
     uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
     if (offset <= TCP_HDR_OFFSET_MIN) {
@@ -57,9 +141,58 @@ int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                     DEBUG("gnrc_tcp_option.c : _option_parse() : invalid MSS Option length.\n");
                     return -1;
                 }
-                tcb->mss = (option->value[0] << 8) | option->value[1];
+                opts->mss = (option->value[0] << 8) | option->value[1];
+                opts->present |= OPTION_MSS;
                 DEBUG("gnrc_tcp_option.c : _option_parse() : MSS option found. MSS=%"PRIu16"\n",
-                      tcb->mss);
+                      opts->mss);
+                break;
+
+            case TCP_OPTION_KIND_WS:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_WS) {
+
+                    DEBUG("gnrc_tcp_option.c : _option_parse() : invalid WS Option length.\n");
+                    return -1;
+                }
+                /* Shift counts above the maximum are treated as the maximum (RFC 7323) */
+                opts->wnd_scale = (option->value[0] < TCP_OPTION_WS_MAX) ?
+                                  option->value[0] : TCP_OPTION_WS_MAX;
+                opts->present |= OPTION_WS;
+                DEBUG("gnrc_tcp_option.c : _option_parse() : WS option found. WS=%"PRIu8"\n",
+                      opts->wnd_scale);
+                break;
+
+            case TCP_OPTION_KIND_SACK_PERM:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_SACK_PERM) {
+
+                    DEBUG("gnrc_tcp_option.c : _option_parse() : invalid SACK permitted Option.\n");
+                    return -1;
+                }
+                opts->present |= OPTION_SACK_PERM;
+                DEBUG("gnrc_tcp_option.c : _option_parse() : SACK permitted option found.\n");
+                break;
+
+            case TCP_OPTION_KIND_SACK:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    (option->length - TCP_OPTION_LENGTH_MIN) % TCP_OPTION_LENGTH_SACK_BLOCK) {
+
+                    DEBUG("gnrc_tcp_option.c : _option_parse() : invalid SACK Option length.\n");
+                    return -1;
+                }
+                /* Blocks beyond OPTION_SACK_BLOCKS_MAX are ignored */
+                for (uint8_t i = TCP_OPTION_LENGTH_MIN; i < option->length &&
+                     opts->sack_num < OPTION_SACK_BLOCKS_MAX; i += TCP_OPTION_LENGTH_SACK_BLOCK) {
+                    network_uint32_t edge;
+
+                    memcpy(&edge, opt_ptr + i, sizeof(edge));
+                    opts->sack[opts->sack_num][0] = byteorder_ntohl(edge);
+                    memcpy(&edge, opt_ptr + i + sizeof(edge), sizeof(edge));
+                    opts->sack[opts->sack_num][1] = byteorder_ntohl(edge);
+                    opts->sack_num++;
+                }
+                DEBUG("gnrc_tcp_option.c : _option_parse() : SACK option found. Blocks=%"PRIu8"\n",
+                      opts->sack_num);
                 break;
 
             default:
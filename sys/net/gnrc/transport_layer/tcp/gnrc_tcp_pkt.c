@@ -25,6 +25,8 @@
 #include "internal/common.h"
 #include "internal/option.h"
 #include "internal/pkt.h"
+#include "internal/rcvbuf.h"
+#include "internal/synq.h"
 
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
@@ -33,6 +35,11 @@
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
+/* pkt_sacked holds one bit per packet in the retransmit queue */
+#if (GNRC_TCP_RETRANSMIT_QUEUE_SIZE < 1) || (GNRC_TCP_RETRANSMIT_QUEUE_SIZE > 32)
+#error "GNRC_TCP_RETRANSMIT_QUEUE_SIZE must be between 1 and 32"
+#endif
+
 /**
  * @brief Calculates the maximum of two unsigned numbers.
  *
@@ -46,6 +53,206 @@ static inline uint32_t _max(const uint32_t x, const uint32_t y)
   return (x > y) ? x : y;
 }
 
+/**
+ * @brief Calculates the minimum of two unsigned numbers.
+ *
+ * @param[in] x   First comparrison value.
+ * @param[in] y   Second comparrison value.
+ *
+ * @returns   X if x is smaller than y, if not y is returned.
+ */
+static inline uint32_t _min(const uint32_t x, const uint32_t y)
+{
+  return (x < y) ? x : y;
+}
+
+/**
+ * @brief Extracts the sequence number of a packet.
+ *
+ * @param[in] pkt   Packet to extract the sequence number from.
+ *
+ * @returns   The sequence number of @p pkt.
+ */
+static uint32_t _pkt_get_seq_num(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *snp = NULL;
+
+    LL_SEARCH_SCALAR(pkt, snp, type, GNRC_NETTYPE_TCP);
+    return byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+}
+
+#if GNRC_TCP_RCV_OOO_QUEUE_SIZE > 0
+/**
+ * @brief Gets the range of contiguous segments held back behind a gap.
+ *
+ * @param[in]  tcb     TCB holding the segments.
+ * @param[in]  i       Index of the first segment of the range in tcb->pkt_ooo.
+ * @param[out] left    First sequence number of the range.
+ * @param[out] right   Sequence number following the range.
+ *
+ * @returns   Index of the first segment behind the range.
+ */
+static uint8_t _pkt_get_ooo_range(const gnrc_tcp_tcb_t *tcb, uint8_t i, uint32_t *left,
+                                  uint32_t *right)
+{
+    *left = _pkt_get_seq_num(tcb->pkt_ooo[i]);
+    *right = *left;
+
+    while (i < tcb->pkt_ooo_num) {
+        uint32_t seq = _pkt_get_seq_num(tcb->pkt_ooo[i]);
+        uint32_t end = seq + _pkt_get_pay_len(tcb->pkt_ooo[i]);
+
+        if (LSS_32_BIT(*right, seq)) {
+            break;
+        }
+        if (LSS_32_BIT(*right, end)) {
+            *right = end;
+        }
+        i++;
+    }
+    return i;
+}
+
+/**
+ * @brief Collects SACK blocks reporting the segments held back behind a gap.
+ *
+ * @param[in]  tcb      TCB holding the segments.
+ * @param[out] blocks   SACK blocks: left and right edge.
+ *
+ * @returns   Number of SACK blocks, at most OPTION_SACK_BLOCKS_MAX.
+ */
+static uint8_t _pkt_get_sack_blocks(const gnrc_tcp_tcb_t *tcb,
+                                    uint32_t (*blocks)[2])
+{
+    uint32_t left, right;
+    uint8_t num = 0;
+
+    /* The first block reports the segment received last (RFC 2018) */
+    for (uint8_t i = 0; i < tcb->pkt_ooo_num; ) {
+        i = _pkt_get_ooo_range(tcb, i, &left, &right);
+        if (LEQ_32_BIT(left, tcb->ooo_last) && LSS_32_BIT(tcb->ooo_last, right)) {
+            blocks[0][0] = left;
+            blocks[0][1] = right;
+            num = 1;
+            break;
+        }
+    }
+    /* The other blocks follow in ascending order */
+    for (uint8_t i = 0; i < tcb->pkt_ooo_num && num < OPTION_SACK_BLOCKS_MAX; ) {
+        i = _pkt_get_ooo_range(tcb, i, &left, &right);
+        if (num == 0 || left != blocks[0][0]) {
+            blocks[num][0] = left;
+            blocks[num][1] = right;
+            num++;
+        }
+    }
+    return num;
+}
+#endif
+
+/**
+ * @brief Starts the retransmission timer with the current RTO.
+ *
+ * @param[in,out] tcb       TCB holding the timer and the RTO state.
+ * @param[in]     backoff   Double the RTO, because the timer expired (Timer Backoff).
+ */
+static void _setup_retransmit_timer(gnrc_tcp_tcb_t *tcb, const bool backoff)
+{
+    /* RTO adjustment */
+    if (!backoff) {
+        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
+        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+            tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
+        }
+        else {
+            tcb->rto = tcb->srtt + _max(GNRC_TCP_RTO_GRANULARITY,  GNRC_TCP_RTO_K * tcb->rtt_var);
+        }
+    }
+    else {
+        /* If this is a retransmission: Double the rto (Timer Backoff) */
+        tcb->rto *= 2;
+
+        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
+        /* New measurements must be taken the next time something is sent. */
+        if (tcb->retries >= 5) {
+            tcb->srtt = RTO_UNINITIALIZED;
+            tcb->rtt_var = RTO_UNINITIALIZED;
+        }
+        tcb->retries += 1;
+    }
+
+    /* Perform boundary checks on current RTO before usage */
+    if (tcb->rto < (int32_t) GNRC_TCP_RTO_LOWER_BOUND) {
+        tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
+    }
+    else if (tcb->rto > (int32_t) GNRC_TCP_RTO_UPPER_BOUND) {
+        tcb->rto = GNRC_TCP_RTO_UPPER_BOUND;
+    }
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    tcb->msg_tout.type = MSG_TYPE_RETRANSMISSION;
+    tcb->msg_tout.content.ptr = (void *) tcb;
+    xtimer_set_msg(&tcb->tim_tout, tcb->rto, &tcb->msg_tout, gnrc_tcp_pid);
+}
+
+/**
+ * @brief Adds the network layer headers of a reply to an incoming packet.
+ *
+ * @param[in,out] out_pkt   TCP header of the reply on entry, head of the reply on return.
+ *                          Is released and set to NULL if allocation fails.
+ * @param[in]     in_pkt    Incoming packet to reply to.
+ *
+ * @returns   Zero on success.
+ *            -ENOMEM if pktbuf is full.
+ */
+static int _pkt_build_nw_from_pkt(gnrc_pktsnip_t **out_pkt, gnrc_pktsnip_t *in_pkt)
+{
+#ifdef MODULE_GNRC_IPV6
+    gnrc_pktsnip_t *ip6_snp;
+    LL_SEARCH_SCALAR(in_pkt, ip6_snp, type, GNRC_NETTYPE_IPV6);
+    ipv6_hdr_t *ip6_hdr = (ipv6_hdr_t *)ip6_snp->data;
+
+    /* Build new network layer header */
+    ip6_snp = gnrc_ipv6_hdr_build(*out_pkt, &(ip6_hdr->dst), &(ip6_hdr->src));
+    if (ip6_snp == NULL) {
+        DEBUG("gnrc_tcp_pkt.c : _pkt_build_nw_from_pkt() :\
+               Can't alloc buffer for IPv6 Header.\n");
+        gnrc_pktbuf_release(*out_pkt);
+        *(out_pkt) = NULL;
+        return -ENOMEM;
+    }
+    *out_pkt = ip6_snp;
+
+    /* Add netif header in case the receiver addr sent from a link local address */
+    if (ipv6_addr_is_link_local(&ip6_hdr->src)) {
+
+        /* Search for netif header in received packet */
+        gnrc_pktsnip_t *net_snp;
+        LL_SEARCH_SCALAR(in_pkt, net_snp, type, GNRC_NETTYPE_NETIF);
+        gnrc_netif_hdr_t *net_hdr = (gnrc_netif_hdr_t *)net_snp->data;
+
+        /* Allocate new header and set interface id */
+        net_snp = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+        if (net_snp == NULL) {
+            DEBUG("gnrc_tcp_pkt.c : _pkt_build_nw_from_pkt() :\
+                   Can't alloc buffer for netif Header.\n");
+            gnrc_pktbuf_release(ip6_snp);
+            *(out_pkt) = NULL;
+            return -ENOMEM;
+        }
+        else {
+            ((gnrc_netif_hdr_t *)net_snp->data)->if_pid = net_hdr->if_pid;
+            LL_PREPEND(ip6_snp, net_snp);
+            *(out_pkt) = net_snp;
+        }
+    }
+#else
+    (void) in_pkt;
+    DEBUG("gnrc_tcp_pkt.c : _pkt_build_nw_from_pkt() : Network Layer Module Missing\n");
+#endif
+    return 0;
+}
+
 int _pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt, gnrc_pktsnip_t *in_pkt)
 {
     tcp_hdr_t tcp_hdr_out;
@@ -54,11 +261,6 @@ int _pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt, gnrc_pktsnip_t *in_pkt)
     gnrc_pktsnip_t *tcp_snp;
     LL_SEARCH_SCALAR(in_pkt, tcp_snp, type, GNRC_NETTYPE_TCP);
     tcp_hdr_t *tcp_hdr_in = (tcp_hdr_t *)tcp_snp->data;
-#ifdef MODULE_GNRC_IPV6
-    gnrc_pktsnip_t *ip6_snp;
-    LL_SEARCH_SCALAR(in_pkt, ip6_snp, type, GNRC_NETTYPE_IPV6);
-    ipv6_hdr_t *ip6_hdr = (ipv6_hdr_t *)ip6_snp->data;
-#endif
 
     /* Setup header information */
     tcp_hdr_out.src_port = tcp_hdr_in->dst_port;
@@ -99,10 +301,42 @@ int _pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt, gnrc_pktsnip_t *in_pkt)
     *out_pkt = tcp_snp;
 
     /* Build new network layer header */
+    return _pkt_build_nw_from_pkt(out_pkt, in_pkt);
+}
+
+int _pkt_build_syn_ack_from_synq(gnrc_pktsnip_t **out_pkt, const synq_entry_t *entry)
+{
+    uint8_t offset = TCP_HDR_OFFSET_MIN + _option_get_syn_len(entry->status);
+    tcp_hdr_t *tcp_hdr_out;
+
+    /* Allocate new TCP header with room for the options */
+    gnrc_pktsnip_t *tcp_snp = gnrc_pktbuf_add(NULL, NULL, offset * 4, GNRC_NETTYPE_TCP);
+    if (tcp_snp == NULL) {
+        DEBUG("gnrc_tcp_pkt.c : _pkt_build_syn_ack_from_synq() :\
+               Can't alloc buffer for TCP Header\n.");
+        *(out_pkt) = NULL;
+        return -ENOMEM;
+    }
+    *out_pkt = tcp_snp;
+
+    /* Setup header information: seq_no = iss, ack_no = irs + 1 */
+    tcp_hdr_out = (tcp_hdr_t *)tcp_snp->data;
+    tcp_hdr_out->src_port = byteorder_htons(entry->queue->local_port);
+    tcp_hdr_out->dst_port = byteorder_htons(entry->peer_port);
+    tcp_hdr_out->seq_num = byteorder_htonl(entry->iss);
+    tcp_hdr_out->ack_num = byteorder_htonl(entry->irs + 1);
+    tcp_hdr_out->off_ctl = byteorder_htons(_option_build_offset_control(offset, MSK_SYN_ACK));
+    tcp_hdr_out->window = byteorder_htons(_min(GNRC_TCP_DEFAULT_WINDOW, UINT16_MAX));
+    tcp_hdr_out->checksum = byteorder_htons(0);
+    tcp_hdr_out->urgent_ptr = byteorder_htons(0);
+    _option_build_syn((uint8_t *)(tcp_hdr_out + 1), entry->status);
+
+    /* Build network layer header */
 #ifdef MODULE_GNRC_IPV6
-    ip6_snp = gnrc_ipv6_hdr_build(tcp_snp, &(ip6_hdr->dst), &(ip6_hdr->src));
+    gnrc_pktsnip_t *ip6_snp = gnrc_ipv6_hdr_build(tcp_snp, (ipv6_addr_t *)entry->local_addr,
+                                                  (ipv6_addr_t *)entry->peer_addr);
     if (ip6_snp == NULL) {
-        DEBUG("gnrc_tcp_pkt.c : _pkt_build_reset_from_pkt() :\
+        DEBUG("gnrc_tcp_pkt.c : _pkt_build_syn_ack_from_synq() :\
                Can't alloc buffer for IPv6 Header.\n");
         gnrc_pktbuf_release(tcp_snp);
         *(out_pkt) = NULL;
@@ -110,31 +344,22 @@ int _pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt, gnrc_pktsnip_t *in_pkt)
     }
     *out_pkt = ip6_snp;
 
-    /* Add netif header in case the receiver addr sent from a link local address */
-    if (ipv6_addr_is_link_local(&ip6_hdr->src)) {
-
-        /* Search for netif header in received packet */
-        gnrc_pktsnip_t *net_snp;
-        LL_SEARCH_SCALAR(in_pkt, net_snp, type, GNRC_NETTYPE_NETIF);
-        gnrc_netif_hdr_t *net_hdr = (gnrc_netif_hdr_t *)net_snp->data;
-
-        /* Allocate new header and set interface id */
-        net_snp = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    /* Prepend network interface header if the peer is link local */
+    if (entry->ll_iface > 0) {
+        gnrc_pktsnip_t *net_snp = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
         if (net_snp == NULL) {
-            DEBUG("gnrc_tcp_pkt.c : _pkt_build_reset_from_pkt() :\
+            DEBUG("gnrc_tcp_pkt.c : _pkt_build_syn_ack_from_synq() :\
                    Can't alloc buffer for netif Header.\n");
             gnrc_pktbuf_release(ip6_snp);
             *(out_pkt) = NULL;
             return -ENOMEM;
         }
-        else {
-            ((gnrc_netif_hdr_t *)net_snp->data)->if_pid = net_hdr->if_pid;
-            LL_PREPEND(ip6_snp, net_snp);
-            *(out_pkt) = net_snp;
-        }
+        ((gnrc_netif_hdr_t *)net_snp->data)->if_pid = (kernel_pid_t)entry->ll_iface;
+        LL_PREPEND(ip6_snp, net_snp);
+        *(out_pkt) = net_snp;
     }
 #else
-    DEBUG("gnrc_tcp_pkt.c : _pkt_build_reset_from_pkt() : Network Layer Module Missing\n");
+    DEBUG("gnrc_tcp_pkt.c : _pkt_build_syn_ack_from_synq() : Network Layer Module Missing\n");
 #endif
     return 0;
 }
@@ -164,14 +389,33 @@ int _pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt, uint16_t *seq_con,
     tcp_hdr.checksum = byteorder_htons(0);
     tcp_hdr.seq_num = byteorder_htonl(seq_num);
     tcp_hdr.ack_num = byteorder_htonl(ack_num);
-    tcp_hdr.window = byteorder_htons(tcb->rcv_wnd);
     tcp_hdr.urgent_ptr = byteorder_htons(0);
 
+    /* The window of a SYN is never scaled (RFC 7323) */
+    if (ctl & MSK_SYN) {
+        tcp_hdr.window = byteorder_htons(_min(tcb->rcv_wnd, UINT16_MAX));
+    }
+    else {
+        tcp_hdr.window = byteorder_htons(_min(tcb->rcv_wnd >> tcb->rcv_wnd_scale, UINT16_MAX));
+    }
+
     /* Calculate option field size. */
-    /* Add MSS option if SYN is sent */
+    /* Add MSS, window scale and SACK permitted option if SYN is sent */
     if (ctl & MSK_SYN) {
-        offset += 1;
+        offset += _option_get_syn_len(tcb->status);
+    }
+#if GNRC_TCP_RCV_OOO_QUEUE_SIZE > 0
+    /* Add SACK option if segments behind a gap are held back */
+    uint32_t sack[OPTION_SACK_BLOCKS_MAX][2];
+    uint8_t sack_num = 0;
+
+    if ((ctl & MSK_SYN_ACK) == MSK_ACK && (tcb->status & STATUS_SACK_PERM)) {
+        sack_num = _pkt_get_sack_blocks(tcb, sack);
+        if (sack_num > 0) {
+            offset += _option_get_sack_len(sack_num);
+        }
     }
+#endif
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(_option_build_offset_control(offset, ctl));
 
@@ -199,11 +443,16 @@ int _pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt, uint16_t *seq_con,
             /* Init options field with 'End Of List' - option (0) */
             memset(opt_ptr, TCP_OPTION_KIND_EOL, opt_left);
 
-            /* If SYN flag is set: Add MSS option */
+            /* If SYN flag is set: Add MSS, window scale and SACK permitted option */
             if (ctl & MSK_SYN) {
-                network_uint32_t mss_option = byteorder_htonl(_option_build_mss(GNRC_TCP_MSS));
-                memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                _option_build_syn(opt_ptr, tcb->status);
             }
+#if GNRC_TCP_RCV_OOO_QUEUE_SIZE > 0
+            /* If segments are held back: Add SACK option */
+            if (sack_num > 0) {
+                _option_build_sack(opt_ptr, (const uint32_t (*)[2])sack, sack_num);
+            }
+#endif
             /* Increase opt_ptr and decrease opt_left, if other options are added */
             /* NOTE: Add additional options here */
         }
@@ -269,12 +518,18 @@ int _pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt, const uint16_t seq_c
 
     /* If this is no retransmission, advance sequence number and measure time */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = xtimer_now().ticks32;
+
+        /* Measure the round trip time of one segment at a time */
+        if (seq_con > 0 && !(tcb->status & STATUS_RTT_MEASURE)) {
+            tcb->status |= STATUS_RTT_MEASURE;
+            tcb->rtt_start = xtimer_now().ticks32;
+            tcb->rtt_seq = tcb->snd_nxt;
+        }
     }
+    /* Retransmissions make the running measurement ambiguous (Karns Algorithm) */
     else {
-        tcb->retries += 1;
+        tcb->status &= ~STATUS_RTT_MEASURE;
     }
 
     /* Pass packet down the network stack */
@@ -361,9 +616,15 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
+    /* Only the oldest packet in the retransmit queue is retransmitted on timeout */
+    if (retransmit && (tcb->pkt_retransmit_num == 0 || tcb->pkt_retransmit[0] != pkt)) {
         DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : Nothing to do\n");
+        return -EINVAL;
+    }
+
+    /* Check if retransmit queue is full */
+    if (!retransmit && tcb->pkt_retransmit_num >= GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
+        DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : Retransmit queue is full\n");
         return -ENOMEM;
     }
 
@@ -378,75 +639,57 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
     }
 
     /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
-    gnrc_pktbuf_hold(pkt, 1);
-
-    /* RTO adjustment */
     if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(GNRC_TCP_RTO_GRANULARITY,  GNRC_TCP_RTO_K * tcb->rtt_var);
-        }
-    }
-    else {
-        /* If this is a retransmission: Double the rto (Timer Backoff) */
-        tcb->rto *= 2;
-
-        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
-        /* New measurements must be taken the next time something is sent. */
-        if (tcb->retries >= 5) {
-            tcb->srtt = RTO_UNINITIALIZED;
-            tcb->rtt_var = RTO_UNINITIALIZED;
-        }
+        tcb->pkt_retransmit[tcb->pkt_retransmit_num++] = pkt;
     }
+    gnrc_pktbuf_hold(pkt, 1);
 
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) GNRC_TCP_RTO_LOWER_BOUND) {
-        tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
-    }
-    else if (tcb->rto > (int32_t) GNRC_TCP_RTO_UPPER_BOUND) {
-        tcb->rto = GNRC_TCP_RTO_UPPER_BOUND;
+    /* The timer is already running, if older packets wait for acknowledgment */
+    if (!retransmit && tcb->pkt_retransmit_num > 1) {
+        return 0;
     }
-
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    tcb->msg_tout.type = MSG_TYPE_RETRANSMISSION;
-    tcb->msg_tout.content.ptr = (void *) tcb;
-    xtimer_set_msg(&tcb->tim_tout, tcb->rto, &tcb->msg_tout, gnrc_tcp_pid);
+    _setup_retransmit_timer(tcb, retransmit);
     return 0;
 }
 
 int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    uint8_t acked = 0;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->pkt_retransmit_num == 0) {
         DEBUG("gnrc_tcp_pkt.c : _pkt_acknowledge() : There is no packet to ack\n");
         return -ENODATA;
     }
 
-    LL_SEARCH_SCALAR(tcb->pkt_retransmit, snp, type, GNRC_NETTYPE_TCP);
-    hdr = (tcp_hdr_t *) snp->data;
-
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _pkt_get_seg_len(tcb->pkt_retransmit) - 1;
+    /* Release all packets that are acknowledged entirely, the oldest packet comes first */
+    while (acked < tcb->pkt_retransmit_num) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[acked];
+        uint32_t seg = _pkt_get_seq_num(pkt) + _pkt_get_seg_len(pkt) - 1;
 
-    /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        xtimer_remove(&(tcb->tim_tout));
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
+        gnrc_pktbuf_release(pkt);
+        acked++;
+    }
+    if (acked == 0) {
+        return 0;
+    }
+    tcb->pkt_retransmit_num -= acked;
+    memmove(tcb->pkt_retransmit, tcb->pkt_retransmit + acked,
+            tcb->pkt_retransmit_num * sizeof(tcb->pkt_retransmit[0]));
+    tcb->pkt_sacked = (acked < 32) ? (tcb->pkt_sacked >> acked) : 0;
+    tcb->retries = 0;
 
-        /* Measure round trip time */
+    /* Measure round trip time, if the measured segment was acknowledged */
+    if ((tcb->status & STATUS_RTT_MEASURE) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
         int32_t rtt = xtimer_now().ticks32 - tcb->rtt_start;
 
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
+        tcb->status &= ~STATUS_RTT_MEASURE;
+
+        /* Use time only if there was no timer overflow */
+        if (rtt > 0) {
             /* If this is the first sample taken */
             if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
                 tcb->srtt = rtt;
@@ -461,7 +704,166 @@ int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
             }
         }
     }
+
+    /* Restart timer for the oldest packet left, stop it if everything was acknowledged */
+    xtimer_remove(&(tcb->tim_tout));
+    if (tcb->pkt_retransmit_num > 0) {
+        _setup_retransmit_timer(tcb, false);
+    }
+    return 0;
+}
+
+int _pkt_mark_sacked(gnrc_tcp_tcb_t *tcb, const option_values_t *opts)
+{
+    int num = 0;
+
+    for (uint8_t i = 0; i < tcb->pkt_retransmit_num; i++) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[i];
+        uint32_t seq = _pkt_get_seq_num(pkt);
+        uint32_t end = seq + _pkt_get_seg_len(pkt);
+
+        /* Mark packet if a SACK block covers it entirely */
+        for (uint8_t j = 0; j < opts->sack_num; j++) {
+            if (LEQ_32_BIT(opts->sack[j][0], seq) && LEQ_32_BIT(end, opts->sack[j][1])) {
+                if (!(tcb->pkt_sacked & (1UL << i))) {
+                    tcb->pkt_sacked |= (1UL << i);
+                    num++;
+                }
+                break;
+            }
+        }
+    }
+    return num;
+}
+
+int _pkt_retransmit_lost(gnrc_tcp_tcb_t *tcb)
+{
+    uint8_t lost = 1;
+    int num = 0;
+
+    /* The oldest packet is lost, with SACK so is every gap below the newest SACKed packet */
+    for (uint8_t i = tcb->pkt_retransmit_num; i > 1; i--) {
+        if (tcb->pkt_sacked & (1UL << (i - 1))) {
+            lost = i - 1;
+            break;
+        }
+    }
+    for (uint8_t i = 0; i < lost && i < tcb->pkt_retransmit_num; i++) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[i];
+        uint32_t seq = _pkt_get_seq_num(pkt);
+
+        /* Skip SACKed packets and packets retransmitted during this recovery */
+        if ((tcb->pkt_sacked & (1UL << i)) || LSS_32_BIT(seq, tcb->rxt_nxt)) {
+            continue;
+        }
+        tcb->rxt_nxt = seq + _pkt_get_seg_len(pkt);
+        gnrc_pktbuf_hold(pkt, 1);
+        _pkt_send(tcb, pkt, 0, true);
+        num++;
+    }
+    return num;
+}
+
+int _pkt_ooo_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt)
+{
+#if GNRC_TCP_RCV_OOO_QUEUE_SIZE > 0
+    uint32_t seq = _pkt_get_seq_num(pkt);
+    uint8_t pos = 0;
+
+    /* Keep segments sorted by sequence number, ignore duplicates */
+    while (pos < tcb->pkt_ooo_num) {
+        uint32_t other = _pkt_get_seq_num(tcb->pkt_ooo[pos]);
+
+        if (other == seq) {
+            return -EALREADY;
+        }
+        if (LSS_32_BIT(seq, other)) {
+            break;
+        }
+        pos++;
+    }
+
+    /* If the queue is full: Segments closer to the gap are preferred */
+    if (tcb->pkt_ooo_num >= GNRC_TCP_RCV_OOO_QUEUE_SIZE) {
+        if (pos >= tcb->pkt_ooo_num) {
+            DEBUG("gnrc_tcp_pkt.c : _pkt_ooo_add() : Out-of-order queue is full\n");
+            return -ENOMEM;
+        }
+        gnrc_pktbuf_release(tcb->pkt_ooo[--(tcb->pkt_ooo_num)]);
+    }
+    memmove(tcb->pkt_ooo + pos + 1, tcb->pkt_ooo + pos,
+            (tcb->pkt_ooo_num - pos) * sizeof(tcb->pkt_ooo[0]));
+    tcb->pkt_ooo[pos] = pkt;
+    tcb->pkt_ooo_num++;
+    tcb->ooo_last = seq;
+    gnrc_pktbuf_hold(pkt, 1);
     return 0;
+#else
+    (void) tcb;
+    (void) pkt;
+    return -ENOMEM;
+#endif
+}
+
+void _pkt_add_payload(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *snp = NULL;
+    uint32_t skip = tcb->rcv_nxt - _pkt_get_seq_num(pkt);
+
+    LL_SEARCH_SCALAR(pkt, snp, type, GNRC_NETTYPE_UNDEF);
+    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+        if (skip < snp->size) {
+            size_t len = snp->size - skip;
+            size_t added = _rcvbuf_add(tcb, (uint8_t *) snp->data + skip, len);
+
+            tcb->rcv_nxt += added;
+            /* Receive buffer is full: the peer retransmits the rest */
+            if (added < len) {
+                break;
+            }
+            skip = 0;
+        }
+        else {
+            skip -= snp->size;
+        }
+        snp = snp->next;
+    }
+}
+
+void _pkt_ooo_drain(gnrc_tcp_tcb_t *tcb)
+{
+#if GNRC_TCP_RCV_OOO_QUEUE_SIZE > 0
+    uint8_t done = 0;
+
+    while (done < tcb->pkt_ooo_num) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_ooo[done];
+
+        /* Stop at the next gap */
+        if (LSS_32_BIT(tcb->rcv_nxt, _pkt_get_seq_num(pkt))) {
+            break;
+        }
+        /* Copy payload not received yet into the receive buffer */
+        _pkt_add_payload(tcb, pkt);
+        gnrc_pktbuf_release(pkt);
+        done++;
+    }
+    tcb->pkt_ooo_num -= done;
+    memmove(tcb->pkt_ooo, tcb->pkt_ooo + done, tcb->pkt_ooo_num * sizeof(tcb->pkt_ooo[0]));
+#else
+    (void) tcb;
+#endif
+}
+
+void _pkt_ooo_clear(gnrc_tcp_tcb_t *tcb)
+{
+#if GNRC_TCP_RCV_OOO_QUEUE_SIZE > 0
+    for (uint8_t i = 0; i < tcb->pkt_ooo_num; i++) {
+        gnrc_pktbuf_release(tcb->pkt_ooo[i]);
+    }
+    tcb->pkt_ooo_num = 0;
+#else
+    (void) tcb;
+#endif
 }
 
 uint16_t _pkt_calc_csum(const gnrc_pktsnip_t *hdr, const gnrc_pktsnip_t *pseudo_hdr,
@@ -16,11 +16,16 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 #include <errno.h>
+#include <string.h>
 #include "internal/rcvbuf.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
+#if GNRC_TCP_RCV_BUF_POOL_PAGES > UINT16_MAX
+#error "GNRC_TCP_RCV_BUF_POOL_PAGES must not exceed UINT16_MAX"
+#endif
+
 /**
  * @brief Internal struct holding receive buffers.
  */
@@ -33,69 +38,182 @@ void _rcvbuf_init(void)
 {
     DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_init() : entry\n");
     mutex_init(&(_static_buf.lock));
-    for (size_t i = 0; i < GNRC_TCP_RCV_BUFFERS; ++i) {
-        _static_buf.entries[i].used = 0;
+    _static_buf.used = 0;
+    for (uint16_t i = 0; i < GNRC_TCP_RCV_BUF_POOL_PAGES; ++i) {
+        _static_buf.next[i] = i + 1;
     }
+    _static_buf.free_head = 0;
+    _static_buf.free_num = GNRC_TCP_RCV_BUF_POOL_PAGES;
 }
 
 /**
- * @brief Allocate receive buffer.
+ * @brief Take a page from the pool.
+ *
+ * @param[out] page   Index of the page taken.
  *
- * @returns   Not NULL if a receive buffer was allocated.
- *            NULL if allocation failed.
+ * @returns   Zero on success.
+ *            -ENOMEM if the pool has no pages left.
  */
-static void* _rcvbuf_alloc(void)
+static int _page_alloc(uint16_t *page)
 {
-    void *result = NULL;
-    DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_alloc() : Entry\n");
+    int res = -ENOMEM;
+
     mutex_lock(&(_static_buf.lock));
-    for (size_t i = 0; i < GNRC_TCP_RCV_BUFFERS; ++i) {
-        if (_static_buf.entries[i].used == 0) {
-            _static_buf.entries[i].used = 1;
-            result = (void *)(_static_buf.entries[i].buffer);
-            break;
-        }
+    if (_static_buf.free_num > 0) {
+        *page = _static_buf.free_head;
+        _static_buf.free_head = _static_buf.next[*page];
+        _static_buf.free_num--;
+        res = 0;
     }
     mutex_unlock(&(_static_buf.lock));
-    return result;
+    return res;
 }
 
 /**
- * @brief Release allocated receive buffer.
+ * @brief Return a page to the pool.
  *
- * @param[in] buf   Pointer to buffer that should be released.
+ * @param[in] page   Index of the page.
  */
-static void _rcvbuf_free(void * const buf)
+static void _page_free(uint16_t page)
 {
-    DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_free() : Entry\n");
     mutex_lock(&(_static_buf.lock));
-    for (size_t i = 0; i < GNRC_TCP_RCV_BUFFERS; ++i) {
-        if ((_static_buf.entries[i].used == 1) && (buf == _static_buf.entries[i].buffer)) {
-            _static_buf.entries[i].used = 0;
-        }
-    }
+    _static_buf.next[page] = _static_buf.free_head;
+    _static_buf.free_head = page;
+    _static_buf.free_num++;
     mutex_unlock(&(_static_buf.lock));
 }
 
 int _rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb)
 {
-    if (tcb->rcv_buf_raw == NULL) {
-        tcb->rcv_buf_raw = _rcvbuf_alloc();
-        if (tcb->rcv_buf_raw == NULL) {
-            DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_get_buffer() : Can't allocate rcv_buf_raw\n");
-            return -ENOMEM;
+    int res = 0;
+
+    if (tcb->rcv_buf.used == 0) {
+        mutex_lock(&(_static_buf.lock));
+        if (_static_buf.used < GNRC_TCP_RCV_BUFFERS) {
+            _static_buf.used++;
+            memset(&tcb->rcv_buf, 0, sizeof(tcb->rcv_buf));
+            tcb->rcv_buf.used = 1;
         }
         else {
-            ringbuffer_init(&tcb->rcv_buf, (char *) tcb->rcv_buf_raw, GNRC_TCP_RCV_BUF_SIZE);
+            DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_get_buffer() : Can't allocate rcv_buf\n");
+            res = -ENOMEM;
         }
+        mutex_unlock(&(_static_buf.lock));
     }
-    return 0;
+    return res;
 }
 
 void _rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
 {
-    if (tcb->rcv_buf_raw != NULL) {
-        _rcvbuf_free(tcb->rcv_buf_raw);
-        tcb->rcv_buf_raw = NULL;
+    gnrc_tcp_rcvbuf_t *rb = &tcb->rcv_buf;
+
+    if (rb->used == 1) {
+        while (rb->pages > 0) {
+            uint16_t page = rb->head;
+
+            rb->head = _static_buf.next[page];
+            rb->pages--;
+            _page_free(page);
+        }
+        mutex_lock(&(_static_buf.lock));
+        _static_buf.used--;
+        mutex_unlock(&(_static_buf.lock));
+        memset(rb, 0, sizeof(*rb));
+    }
+}
+
+size_t _rcvbuf_add(gnrc_tcp_tcb_t *tcb, const void *data, size_t len)
+{
+    gnrc_tcp_rcvbuf_t *rb = &tcb->rcv_buf;
+    const uint8_t *src = data;
+    size_t added = 0;
+
+    if (len > GNRC_TCP_RCV_BUF_SIZE - rb->avail) {
+        len = GNRC_TCP_RCV_BUF_SIZE - rb->avail;
+    }
+    while (added < len) {
+        /* Pages before the last one are full, the first one starts at start */
+        size_t off = (rb->start + rb->avail) % GNRC_TCP_RCV_BUF_PAGE_SIZE;
+
+        /* Append a page if the last one is full */
+        if (rb->pages == 0 || off == 0) {
+            uint16_t page;
+
+            if (rb->pages >= RCVBUF_PAGES_MAX || _page_alloc(&page) < 0) {
+                DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_add() : No page left\n");
+                break;
+            }
+            if (rb->pages == 0) {
+                rb->head = page;
+                rb->start = 0;
+            }
+            else {
+                _static_buf.next[rb->tail] = page;
+            }
+            rb->tail = page;
+            rb->pages++;
+        }
+
+        size_t chunk = GNRC_TCP_RCV_BUF_PAGE_SIZE - off;
+        if (chunk > len - added) {
+            chunk = len - added;
+        }
+        memcpy(&_static_buf.pages[rb->tail][off], src + added, chunk);
+        added += chunk;
+        rb->avail += chunk;
+    }
+    return added;
+}
+
+size_t _rcvbuf_get(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
+{
+    gnrc_tcp_rcvbuf_t *rb = &tcb->rcv_buf;
+    uint8_t *dst = buf;
+    size_t rcvd = 0;
+
+    while (rcvd < len && rb->avail > 0) {
+        size_t chunk = GNRC_TCP_RCV_BUF_PAGE_SIZE - rb->start;
+        if (chunk > rb->avail) {
+            chunk = rb->avail;
+        }
+        if (chunk > len - rcvd) {
+            chunk = len - rcvd;
+        }
+        memcpy(dst + rcvd, &_static_buf.pages[rb->head][rb->start], chunk);
+        rcvd += chunk;
+        rb->start += chunk;
+        rb->avail -= chunk;
+
+        /* Return the first page, if all of its data was read */
+        if (rb->start == GNRC_TCP_RCV_BUF_PAGE_SIZE || rb->avail == 0) {
+            uint16_t page = rb->head;
+
+            rb->head = _static_buf.next[page];
+            rb->start = 0;
+            rb->pages--;
+            _page_free(page);
+        }
+    }
+    return rcvd;
+}
+
+uint32_t _rcvbuf_get_free(const gnrc_tcp_tcb_t *tcb)
+{
+    const gnrc_tcp_rcvbuf_t *rb = &tcb->rcv_buf;
+    uint32_t pages = RCVBUF_PAGES_MAX - rb->pages;
+
+    /* Overcommitted pools may not have the pages left a buffer is allowed to take */
+    mutex_lock(&(_static_buf.lock));
+    if (pages > _static_buf.free_num) {
+        pages = _static_buf.free_num;
+    }
+    mutex_unlock(&(_static_buf.lock));
+
+    /* Space left in the last page plus pages left to take */
+    uint32_t free = (uint32_t) rb->pages * GNRC_TCP_RCV_BUF_PAGE_SIZE - rb->start - rb->avail;
+    free += pages * GNRC_TCP_RCV_BUF_PAGE_SIZE;
+    if (free > GNRC_TCP_RCV_BUF_SIZE - rb->avail) {
+        free = GNRC_TCP_RCV_BUF_SIZE - rb->avail;
     }
+    return free;
 }
@@ -0,0 +1,355 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/synq.h
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <utlist.h>
+#include "random.h"
+#include "xtimer.h"
+#include "net/af.h"
+#include "net/gnrc.h"
+#include "net/gnrc/tcp.h"
+#include "internal/common.h"
+#include "internal/fsm.h"
+#include "internal/option.h"
+#include "internal/pkt.h"
+#include "internal/synq.h"
+
+#ifdef MODULE_GNRC_IPV6
+#include "net/gnrc/ipv6.h"
+#endif
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+/**
+ * @brief Half-open connections of all listening queues.
+ */
+static synq_entry_t _synq[GNRC_TCP_SYN_QUEUE_SIZE];
+
+/**
+ * @brief Timer driving SYN+ACK retransmissions and expiry of the SYN queue.
+ */
+static xtimer_t _synq_timer;
+
+/**
+ * @brief Message sent to the event loop by _synq_timer.
+ */
+static msg_t _synq_timer_msg = { .type = MSG_TYPE_SYNQ_TIMEOUT };
+
+/**
+ * @brief True while _synq_timer is set.
+ */
+static bool _synq_timer_set;
+
+/**
+ * @brief Sets the SYN queue timer, if it is not set already.
+ */
+static void _synq_timer_start(void)
+{
+    if (!_synq_timer_set) {
+        _synq_timer_set = true;
+        xtimer_set_msg(&_synq_timer, GNRC_TCP_RTO_LOWER_BOUND, &_synq_timer_msg, gnrc_tcp_pid);
+    }
+}
+
+/**
+ * @brief Sends the SYN+ACK of a SYN queue entry.
+ *
+ * @param[in] entry   SYN queue entry.
+ */
+static void _synq_send_syn_ack(const synq_entry_t *entry)
+{
+    gnrc_pktsnip_t *out_pkt = NULL;
+
+    /* Send SYN+ACK: seq_no = iss, ack_no = irs + 1 */
+    if (_pkt_build_syn_ack_from_synq(&out_pkt, entry) == 0) {
+        if (gnrc_netapi_send(gnrc_tcp_pid, out_pkt) < 1) {
+            DEBUG("gnrc_tcp_synq.c : _synq_send_syn_ack() : unable to send SYN+ACK\n");
+            gnrc_pktbuf_release(out_pkt);
+        }
+    }
+}
+
+#ifdef MODULE_GNRC_IPV6
+/**
+ * @brief Searches the SYN queue entry of a connection.
+ *
+ * @param[in] queue        Listening queue.
+ * @param[in] ip6_hdr      IPv6 header of the incoming packet.
+ * @param[in] peer_port    Peer port number.
+ *
+ * @returns   Pointer to the entry, NULL if there is none.
+ */
+static synq_entry_t *_synq_find(const gnrc_tcp_tcb_queue_t *queue, const ipv6_hdr_t *ip6_hdr,
+                                uint16_t peer_port)
+{
+    for (unsigned i = 0; i < GNRC_TCP_SYN_QUEUE_SIZE; i++) {
+        synq_entry_t *entry = &_synq[i];
+
+        if (entry->queue == queue && entry->peer_port == peer_port &&
+            ipv6_addr_equal((ipv6_addr_t *)entry->peer_addr, &ip6_hdr->src) &&
+            ipv6_addr_equal((ipv6_addr_t *)entry->local_addr, &ip6_hdr->dst)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Gets an unused SYN queue entry, replacing the oldest one if it expired.
+ *
+ * @returns   Pointer to the entry, NULL if all entries are in use.
+ */
+static synq_entry_t *_synq_alloc(void)
+{
+    uint32_t now = xtimer_now_usec();
+    synq_entry_t *oldest = &_synq[0];
+
+    for (unsigned i = 0; i < GNRC_TCP_SYN_QUEUE_SIZE; i++) {
+        if (_synq[i].queue == NULL) {
+            return &_synq[i];
+        }
+        if ((now - _synq[i].since) > (now - oldest->since)) {
+            oldest = &_synq[i];
+        }
+    }
+    if ((now - oldest->since) < GNRC_TCP_SYN_QUEUE_TIMEOUT) {
+        DEBUG("gnrc_tcp_synq.c : _synq_alloc() : SYN queue full\n");
+        return NULL;
+    }
+    DEBUG("gnrc_tcp_synq.c : _synq_alloc() : SYN queue full, replacing oldest entry\n");
+    return oldest;
+}
+
+/**
+ * @brief Checks if a TCB handles the connection of an incoming packet already.
+ *
+ * @param[in] ip6_hdr     IPv6 header of the incoming packet.
+ * @param[in] tcp_hdr     TCP header of the incoming packet.
+ *
+ * @returns   True if a TCB handles the connection.
+ */
+static bool _is_handled(const ipv6_hdr_t *ip6_hdr, const tcp_hdr_t *tcp_hdr)
+{
+    uint16_t src = byteorder_ntohs(tcp_hdr->src_port);
+    uint16_t dst = byteorder_ntohs(tcp_hdr->dst_port);
+    gnrc_tcp_tcb_t *iter;
+
+    mutex_lock(&_list_tcb_lock);
+    LL_FOREACH(_list_tcb_head, iter) {
+        if (iter->local_port == dst && iter->peer_port == src &&
+            iter->address_family == AF_INET6 &&
+            ipv6_addr_equal((ipv6_addr_t *)iter->local_addr, &ip6_hdr->dst) &&
+            ipv6_addr_equal((ipv6_addr_t *)iter->peer_addr, &ip6_hdr->src)) {
+            break;
+        }
+    }
+    mutex_unlock(&_list_tcb_lock);
+    return (iter != NULL);
+}
+
+/**
+ * @brief Gets a TCB of a listening queue, that is neither connected nor accepted.
+ *
+ * @param[in] queue   Listening queue.
+ *
+ * @returns   Pointer to the TCB, NULL if all TCBs are in use.
+ */
+static gnrc_tcp_tcb_t *_get_free_tcb(gnrc_tcp_tcb_queue_t *queue)
+{
+    for (size_t i = 0; i < queue->tcbs_len; i++) {
+        gnrc_tcp_tcb_t *tcb = &queue->tcbs[i];
+
+        if (tcb->state == FSM_STATE_CLOSED && !(tcb->status & STATUS_ACCEPTED)) {
+            return tcb;
+        }
+    }
+    return NULL;
+}
+#endif
+
+int _synq_rcvd_pkt(gnrc_tcp_tcb_queue_t *queue, gnrc_pktsnip_t *in_pkt)
+{
+#ifdef MODULE_GNRC_IPV6
+    gnrc_pktsnip_t *snp = NULL;      /* Temporary packet snip */
+    synq_entry_t *entry = NULL;      /* SYN queue entry of this connection */
+    gnrc_tcp_tcb_t *tcb = NULL;      /* TCB assigned on handshake completion */
+
+    /* Search for TCP and IPv6 header */
+    LL_SEARCH_SCALAR(in_pkt, snp, type, GNRC_NETTYPE_TCP);
+    tcp_hdr_t *tcp_hdr = (tcp_hdr_t *) snp->data;
+    LL_SEARCH_SCALAR(in_pkt, snp, type, GNRC_NETTYPE_IPV6);
+    ipv6_hdr_t *ip6_hdr = (ipv6_hdr_t *) snp->data;
+
+    /* Extract header values */
+    uint16_t ctl = byteorder_ntohs(tcp_hdr->off_ctl);
+    uint16_t src = byteorder_ntohs(tcp_hdr->src_port);
+    uint32_t seg_seq = byteorder_ntohl(tcp_hdr->seq_num);
+    uint32_t seg_ack = byteorder_ntohl(tcp_hdr->ack_num);
+
+    entry = _synq_find(queue, ip6_hdr, src);
+
+    /* 1) Check RST: if RST is set, forget the half-open connection */
+    if (ctl & MSK_RST) {
+        if (entry != NULL) {
+            entry->queue = NULL;
+        }
+        return 0;
+    }
+
+    /* 2) Check SYN: answer connection requests with SYN+ACK from the SYN queue */
+    if ((ctl & MSK_SYN_ACK) == MSK_SYN) {
+        option_values_t opts;
+
+        /* Drop packet if options are malformed */
+        if (_option_parse(&opts, tcp_hdr) < 0) {
+            return 0;
+        }
+
+        /* New connection request, a retransmitted SYN reuses its entry */
+        if (entry == NULL || entry->irs != seg_seq) {
+            if (_is_handled(ip6_hdr, tcp_hdr)) {
+                DEBUG("gnrc_tcp_synq.c : _synq_rcvd_pkt() : Connection already handled\n");
+                return 0;
+            }
+            /* Drop SYN if the SYN queue is full, the peer retransmits it */
+            if (entry == NULL && (entry = _synq_alloc()) == NULL) {
+                return 0;
+            }
+            entry->queue = queue;
+            memcpy(entry->local_addr, &ip6_hdr->dst, sizeof(ipv6_addr_t));
+            memcpy(entry->peer_addr, &ip6_hdr->src, sizeof(ipv6_addr_t));
+            entry->ll_iface = 0;
+
+            /* In case peer_addr is link local: Store interface Id in entry */
+            if (ipv6_addr_is_link_local(&ip6_hdr->src)) {
+                LL_SEARCH_SCALAR(in_pkt, snp, type, GNRC_NETTYPE_NETIF);
+                if (snp == NULL) {
+                    DEBUG("gnrc_tcp_synq.c : _synq_rcvd_pkt() :\
+                           incoming packet had no netif header\n");
+                    entry->queue = NULL;
+                    return 0;
+                }
+                entry->ll_iface = ((gnrc_netif_hdr_t *)snp->data)->if_pid;
+            }
+            entry->peer_port = src;
+            entry->irs = seg_seq;
+            entry->iss = random_uint32();
+            entry->since = xtimer_now_usec();
+        }
+        entry->snd_wnd = byteorder_ntohs(tcp_hdr->window);
+        entry->mss = (opts.present & OPTION_MSS) ? opts.mss : 0;
+        entry->status = _option_select(&opts);
+        entry->snd_wnd_scale = (entry->status & STATUS_WND_SCALE) ? opts.wnd_scale : 0;
+
+        _synq_send_syn_ack(entry);
+        _synq_timer_start();
+        return 0;
+    }
+
+    /* 3) Check ACK: Anything but the acknowledgement of our SYN+ACK is reset */
+    if (entry == NULL || (ctl & MSK_SYN) || !(ctl & MSK_ACK) || seg_ack != entry->iss + 1) {
+        return -ENOTCONN;
+    }
+
+    /* 4) Handshake completed: Assign a TCB if the listening queue has one left.
+     *    Otherwise keep the entry. The peer acknowledges the retransmitted
+     *    SYN+ACK or sends data, either completes the handshake later on. */
+    tcb = _get_free_tcb(queue);
+    if (tcb == NULL) {
+        DEBUG("gnrc_tcp_synq.c : _synq_rcvd_pkt() : No TCB left in listening queue\n");
+        return 0;
+    }
+    gnrc_tcp_tcb_init(tcb);
+    memcpy(tcb->local_addr, entry->local_addr, sizeof(tcb->local_addr));
+    memcpy(tcb->peer_addr, entry->peer_addr, sizeof(tcb->peer_addr));
+    tcb->ll_iface = entry->ll_iface;
+    tcb->local_port = queue->local_port;
+    tcb->peer_port = entry->peer_port;
+    tcb->irs = entry->irs;
+    tcb->rcv_nxt = entry->irs + 1;
+    tcb->iss = entry->iss;
+    tcb->snd_una = entry->iss;
+    tcb->snd_nxt = entry->iss + 1;
+    tcb->snd_wnd = entry->snd_wnd;
+    tcb->mss = entry->mss;
+    tcb->status |= entry->status;
+    tcb->snd_wnd_scale = entry->snd_wnd_scale;
+    tcb->rcv_wnd_scale = (entry->status & STATUS_WND_SCALE) ? _option_get_rcv_wnd_scale() : 0;
+
+    /* T: CLOSED -> SYN_RCVD -> ESTABLISHED, fails if there is no receive buffer left */
+    if (_fsm(tcb, FSM_EVENT_RCVD_HANDSHAKE, in_pkt, NULL, 0) < 0) {
+        DEBUG("gnrc_tcp_synq.c : _synq_rcvd_pkt() : No receive buffer left\n");
+        return 0;
+    }
+    entry->queue = NULL;
+
+    /* Notify thread waiting in gnrc_tcp_accept() */
+    msg_t msg;
+    msg.type = MSG_TYPE_NOTIFY_USER;
+    mbox_try_put(&(queue->mbox), &msg);
+#ifdef SOCK_HAS_ASYNC
+    if (queue->async_cb != NULL) {
+        queue->async_cb(queue, GNRC_TCP_EVENT_CONN_RECV, queue->async_cb_arg);
+    }
+#endif
+    return 0;
+#else
+    (void) queue;
+    (void) in_pkt;
+    DEBUG("gnrc_tcp_synq.c : _synq_rcvd_pkt() : Network Layer Module Missing\n");
+    return -ENOTCONN;
+#endif
+}
+
+void _synq_timeout(void)
+{
+    uint32_t now = xtimer_now_usec();
+    bool pending = false;
+
+    mutex_lock(&_list_queue_lock);
+    _synq_timer_set = false;
+    for (unsigned i = 0; i < GNRC_TCP_SYN_QUEUE_SIZE; i++) {
+        synq_entry_t *entry = &_synq[i];
+
+        if (entry->queue == NULL) {
+            continue;
+        }
+        if ((now - entry->since) >= GNRC_TCP_SYN_QUEUE_TIMEOUT) {
+            DEBUG("gnrc_tcp_synq.c : _synq_timeout() : Half-open connection expired\n");
+            entry->queue = NULL;
+            continue;
+        }
+        _synq_send_syn_ack(entry);
+        pending = true;
+    }
+    if (pending) {
+        _synq_timer_start();
+    }
+    mutex_unlock(&_list_queue_lock);
+}
+
+void _synq_flush(const gnrc_tcp_tcb_queue_t *queue)
+{
+    for (unsigned i = 0; i < GNRC_TCP_SYN_QUEUE_SIZE; i++) {
+        if (_synq[i].queue == queue) {
+            _synq[i].queue = NULL;
+        }
+    }
+}
@@ -47,13 +47,18 @@ extern "C" {
 #define STATUS_ALLOW_ANY_ADDR (1 << 1)
 #define STATUS_NOTIFY_USER    (1 << 2)
 #define STATUS_WAIT_FOR_MSG   (1 << 3)
+#define STATUS_ACCEPTED       (1 << 4)
+#define STATUS_WND_SCALE      (1 << 5)
+#define STATUS_SACK_PERM      (1 << 6)
+#define STATUS_RECOVERY       (1 << 7)
+#define STATUS_RTT_MEASURE    (1 << 8)
 /** @} */
 
 /**
  * @brief Defines for "eventloop" thread settings.
  * @{
  */
-#define TCP_EVENTLOOP_MSG_QUEUE_SIZE (8U)
+#define TCP_EVENTLOOP_MSG_QUEUE_SIZE (GNRC_TCP_MSG_QUEUE_SIZE)
 #define TCP_EVENTLOOP_PRIO           (THREAD_PRIORITY_MAIN - 2U)
 #define TCP_EVENTLOOP_STACK_SIZE     (THREAD_STACKSIZE_DEFAULT)
 /** @} */
@@ -87,6 +92,7 @@ extern "C" {
 #define MSG_TYPE_RETRANSMISSION     (GNRC_NETAPI_MSG_TYPE_ACK + 104)
 #define MSG_TYPE_TIMEWAIT           (GNRC_NETAPI_MSG_TYPE_ACK + 105)
 #define MSG_TYPE_NOTIFY_USER        (GNRC_NETAPI_MSG_TYPE_ACK + 106)
+#define MSG_TYPE_SYNQ_TIMEOUT       (GNRC_NETAPI_MSG_TYPE_ACK + 107)
 /** @} */
 
 /**
@@ -102,7 +108,7 @@ extern "C" {
 #define LSS_32_BIT(x, y) (((int32_t) (x)) - ((int32_t) (y)) <  0)
 #define LEQ_32_BIT(x, y) (((int32_t) (x)) - ((int32_t) (y)) <= 0)
 #define GRT_32_BIT(x, y) (!LEQ_32_BIT(x, y))
-#define GEQ_32_BIT(x, y) (!LSS_32_BOT(x, y))
+#define GEQ_32_BIT(x, y) (!LSS_32_BIT(x, y))
 /** @} */
 
 /**
@@ -130,6 +136,16 @@ extern gnrc_tcp_tcb_t *_list_tcb_head;
  */
 extern mutex_t _list_tcb_lock;
 
+/**
+ * @brief Head of linked listening queue list.
+ */
+extern gnrc_tcp_tcb_queue_t *_list_queue_head;
+
+/**
+ * @brief Mutex to protect listening queue list and the SYN queue.
+ */
+extern mutex_t _list_queue_lock;
+
 #ifdef __cplusplus
 }
 #endif
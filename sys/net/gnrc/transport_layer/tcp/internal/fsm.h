@@ -59,7 +59,8 @@ typedef enum {
     FSM_EVENT_TIMEOUT_RETRANSMIT, /* Timeout: retransmit */
     FSM_EVENT_TIMEOUT_CONNECTION, /* Timeout: connection */
     FSM_EVENT_SEND_PROBE,         /* Send zero window probe */
-    FSM_EVENT_CLEAR_RETRANSMIT    /* Clear retransmission mechanism */
+    FSM_EVENT_CLEAR_RETRANSMIT,   /* Clear retransmission mechanism */
+    FSM_EVENT_RCVD_HANDSHAKE      /* Handshake completed on a listening queue */
 } fsm_event_t;
 
 /**
@@ -29,6 +29,46 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Maximum number of SACK blocks extracted from a TCP header.
+ */
+#define OPTION_SACK_BLOCKS_MAX (4U)
+
+/**
+ * @brief Flags of options found in a TCP header.
+ * @{
+ */
+#define OPTION_MSS        (1 << 0)
+#define OPTION_WS         (1 << 1)
+#define OPTION_SACK_PERM  (1 << 2)
+/** @} */
+
+/**
+ * @brief Option values extracted from a TCP header.
+ */
+typedef struct {
+    uint8_t present;     /**< Flags of options found, see OPTION_MSS et al. */
+    uint8_t wnd_scale;   /**< Window scale shift count, if OPTION_WS is present */
+    uint16_t mss;        /**< MSS, if OPTION_MSS is present */
+    uint8_t sack_num;    /**< Number of SACK blocks in sack */
+    uint32_t sack[OPTION_SACK_BLOCKS_MAX][2];   /**< SACK blocks: left and right edge */
+} option_values_t;
+
+/**
+ * @brief Calculates the shift count for windows announced to the peer.
+ *
+ * @returns   Smallest shift count that allows announcing GNRC_TCP_RCV_BUF_SIZE.
+ */
+static inline uint8_t _option_get_rcv_wnd_scale(void)
+{
+    uint8_t shift = 0;
+
+    while (shift < TCP_OPTION_WS_MAX && (GNRC_TCP_RCV_BUF_SIZE >> shift) > UINT16_MAX) {
+        shift++;
+    }
+    return shift;
+}
+
 /**
  * @brief Helper function to build the MSS option.
  *
@@ -56,16 +96,63 @@ static inline uint16_t _option_build_offset_control(uint16_t nopts, uint16_t ctl
     return (nopts << 12) | ctl;
 }
 
+/**
+ * @brief Selects the options negotiated on connection setup.
+ *
+ * @param[in] opts   Options of the peers SYN. NULL to select the options offered in our SYN.
+ *
+ * @returns   STATUS_WND_SCALE and STATUS_SACK_PERM, if the option is used.
+ */
+uint16_t _option_select(const option_values_t *opts);
+
+/**
+ * @brief Calculates the size of the options sent with a SYN.
+ *
+ * @param[in] status   Status flags selecting the options, see _option_select().
+ *
+ * @returns   Size of the options in 32-bit words.
+ */
+uint8_t _option_get_syn_len(uint16_t status);
+
+/**
+ * @brief Writes the options sent with a SYN: MSS, window scale and SACK permitted.
+ *
+ * @param[out] opt_ptr   Option field, _option_get_syn_len() words in size.
+ * @param[in]  status    Status flags selecting the options, see _option_select().
+ */
+void _option_build_syn(uint8_t *opt_ptr, uint16_t status);
+
+/**
+ * @brief Calculates the size of a SACK option.
+ *
+ * @param[in] num   Number of SACK blocks, at most OPTION_SACK_BLOCKS_MAX.
+ *
+ * @returns   Size of the option in 32-bit words.
+ */
+static inline uint8_t _option_get_sack_len(uint8_t num)
+{
+    return 1 + 2 * num;
+}
+
+/**
+ * @brief Writes a SACK option.
+ *
+ * @param[out] opt_ptr   Option field, _option_get_sack_len() words in size.
+ * @param[in]  blocks    SACK blocks: left and right edge.
+ * @param[in]  num       Number of SACK blocks, at most OPTION_SACK_BLOCKS_MAX.
+ */
+void _option_build_sack(uint8_t *opt_ptr, const uint32_t (*blocks)[2], uint8_t num);
+
 /**
  * @brief Parses options of a given TCP header.
  *
- * @param[in,out] tcb   TCB holding the connection information.
- * @param[in]     hdr   TCP header to be parsed.
+ * @param[out] opts   Options found in @p hdr.
+ * @param[in]  hdr    TCP header to be parsed.
  *
  * @returns   Zero on success.
  *            Negative value on error.
  */
-int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
+int _option_parse(option_values_t *opts, tcp_hdr_t *hdr);
 
 #ifdef __cplusplus
 }
@@ -23,6 +23,8 @@
 #include <stdint.h>
 #include "net/gnrc.h"
 #include "net/gnrc/tcp/tcb.h"
+#include "option.h"
+#include "synq.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +44,21 @@ extern "C" {
  */
 int _pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt, gnrc_pktsnip_t *in_pkt);
 
+/**
+ * @brief Build a SYN+ACK packet for a SYN queue entry.
+ *
+ * @note This function is used for connection requests on a listening queue,
+ *       that are not assigned to a TCB yet. It sends the first SYN+ACK as
+ *       well as its retransmissions.
+ *
+ * @param[out] out_pkt    Outgoing SYN+ACK packet
+ * @param[in]  entry      SYN queue entry of the connection
+ *
+ * @returns   Zero on success
+ *            -ENOMEM if pktbuf is full.
+ */
+int _pkt_build_syn_ack_from_synq(gnrc_pktsnip_t **out_pkt, const synq_entry_t *entry);
+
 /**
  * @brief Build and allocate a TCB packet, TCB stores pointer to new packet.
  *
@@ -110,16 +127,17 @@ uint32_t _pkt_get_pay_len(gnrc_pktsnip_t *pkt);
  *
  * @param[in,out] tcb          TCB holding the connection information.
  * @param[in]     pkt          Packet to add to the retransmission mechanism.
- * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit.
+ * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit
+ *                             of the oldest packet in the retransmission queue.
  *
  * @returns   Zero on success.
  *            -ENOMEM if the retransmission queue is full.
- *            -EINVAL if pkt is null.
+ *            -EINVAL if pkt is null or not the oldest packet on retransmit.
  */
 int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
@@ -129,6 +147,69 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
  */
 int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+/**
+ * @brief Marks packets in the retransmission queue the peer received out of order.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[in]     opts   Options of the incoming packet, holding the SACK blocks.
+ *
+ * @returns   Number of packets SACKed for the first time.
+ */
+int _pkt_mark_sacked(gnrc_tcp_tcb_t *tcb, const option_values_t *opts);
+
+/**
+ * @brief Retransmits the packets considered lost during loss recovery.
+ *
+ * @note These are the oldest packet and, if the peer sent SACK blocks, every packet
+ *       not SACKed below the newest SACKed one. Packets are retransmitted once per
+ *       recovery, tracked by rxt_nxt of @p tcb.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Number of retransmitted packets.
+ */
+int _pkt_retransmit_lost(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Copies the payload of a segment, that was not received yet, into the receive buffer.
+ *
+ * @note The segment must not start behind rcv_nxt. Payload that does not fit into
+ *       the receive buffer is dropped and retransmitted by the peer.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     pkt   Segment to copy the payload from.
+ */
+void _pkt_add_payload(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief Holds back a segment received behind a gap in the sequence space.
+ *
+ * @note The segment is referenced by @p tcb until it is passed to the receive
+ *       buffer by _pkt_ooo_drain() or released by _pkt_ooo_clear().
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     pkt   Segment to hold back.
+ *
+ * @returns   Zero on success.
+ *            -EALREADY if the segment is held back already.
+ *            -ENOMEM if no more segments can be held back.
+ */
+int _pkt_ooo_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief Passes segments held back, that follow rcv_nxt now, to the receive buffer.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _pkt_ooo_drain(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Releases all segments held back.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _pkt_ooo_clear(gnrc_tcp_tcb_t *tcb);
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
@@ -14,12 +14,15 @@
  * @file
  * @brief       Functions for allocating and freeing the receive buffer.
  *
+ * Receive buffers are chains of pages from a pool shared by all connections.
+ *
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 
 #ifndef RCVBUF_H
 #define RCVBUF_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "mutex.h"
 #include "net/gnrc/tcp/config.h"
@@ -30,19 +33,21 @@ extern "C" {
 #endif
 
 /**
- * @brief Receive buffer entry.
+ * @brief Maximum number of pages a receive buffer consists of.
  */
-typedef struct rcvbuf_entry {
-    uint8_t used;                          /**< Flag: Is buffer in use? */
-    uint8_t buffer[GNRC_TCP_RCV_BUF_SIZE]; /**< Receive buffer storage */
-} rcvbuf_entry_t;
+#define RCVBUF_PAGES_MAX ((GNRC_TCP_RCV_BUF_SIZE + GNRC_TCP_RCV_BUF_PAGE_SIZE - 1) / \
+                          GNRC_TCP_RCV_BUF_PAGE_SIZE)
 
 /**
- * @brief   Struct holding receive buffers.
+ * @brief   Struct holding the receive buffer pool.
  */
 typedef struct rcvbuf {
     mutex_t lock;                                 /**< Lock for allocation synchronization */
-    rcvbuf_entry_t entries[GNRC_TCP_RCV_BUFFERS]; /**< Maintained receive buffers */
+    unsigned used;                                /**< Number of assigned receive buffers */
+    uint16_t free_head;                           /**< Index of the first unused page */
+    uint16_t free_num;                            /**< Number of unused pages */
+    uint16_t next[GNRC_TCP_RCV_BUF_POOL_PAGES];   /**< Index of the following page */
+    uint8_t pages[GNRC_TCP_RCV_BUF_POOL_PAGES][GNRC_TCP_RCV_BUF_PAGE_SIZE]; /**< Page storage */
 } rcvbuf_t;
 
 /**
@@ -51,12 +56,14 @@ typedef struct rcvbuf {
 void _rcvbuf_init(void);
 
 /**
- * @brief Allocate receive buffer and assign it to TCB.
+ * @brief Assign receive buffer to TCB.
+ *
+ * The receive buffer holds no pages until data is added.
  *
  * @param[in,out] tcb   TCB that acquires receive buffer.
  *
  * @returns   Zero  on success.
- *            -ENOMEM if all receive buffers are currently used.
+ *            -ENOMEM if GNRC_TCP_RCV_BUFFERS receive buffers are currently used.
  */
 int _rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
 
@@ -67,6 +74,40 @@ int _rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
  */
 void _rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Append data to the receive buffer of a TCB.
+ *
+ * @param[in,out] tcb    TCB holding the receive buffer.
+ * @param[in]     data   Data to append.
+ * @param[in]     len    Length of @p data.
+ *
+ * @returns   Number of bytes appended. Less than @p len if the receive buffer
+ *            is full or the pool ran out of pages.
+ */
+size_t _rcvbuf_add(gnrc_tcp_tcb_t *tcb, const void *data, size_t len);
+
+/**
+ * @brief Read data from the receive buffer of a TCB.
+ *
+ * Pages are returned to the pool as soon as all of their data was read.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ * @param[out]    buf   Buffer to read data into.
+ * @param[in]     len   Size of @p buf.
+ *
+ * @returns   Number of bytes read.
+ */
+size_t _rcvbuf_get(gnrc_tcp_tcb_t *tcb, void *buf, size_t len);
+
+/**
+ * @brief Get the number of bytes that can be appended to the receive buffer of a TCB.
+ *
+ * @param[in] tcb   TCB holding the receive buffer.
+ *
+ * @returns   Number of bytes the receive buffer and the pages left in the pool can hold.
+ */
+uint32_t _rcvbuf_get_free(const gnrc_tcp_tcb_t *tcb);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       SYN queue for half-open connections of listening queues.
+ *
+ * Connection requests on a listening queue are answered from a SYN queue entry.
+ * A TCB of the listening queue is only assigned to the connection, when the
+ * peer acknowledges the SYN+ACK.
+ */
+
+#ifndef SYNQ_H
+#define SYNQ_H
+
+#include <stdint.h>
+#include "net/gnrc.h"
+#include "net/gnrc/tcp/config.h"
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief SYN queue entry, holding a half-open connection.
+ */
+typedef struct {
+    gnrc_tcp_tcb_queue_t *queue;              /**< Listening queue, NULL if unused */
+#ifdef MODULE_GNRC_IPV6
+    uint8_t local_addr[sizeof(ipv6_addr_t)];  /**< Local IP address */
+    uint8_t peer_addr[sizeof(ipv6_addr_t)];   /**< Peer IP address */
+    int8_t  ll_iface;                         /**< Link layer interface id to use. */
+#endif
+    uint16_t peer_port;    /**< Peer connections port number */
+    uint16_t snd_wnd;      /**< Send window announced in the SYN */
+    uint16_t mss;          /**< The peers MSS */
+    uint16_t status;       /**< Options negotiated, see _option_select() */
+    uint8_t snd_wnd_scale; /**< Shift count of windows announced by the peer */
+    uint32_t irs;          /**< Initial received sequence number */
+    uint32_t iss;          /**< Initial send sequence number */
+    uint32_t since;        /**< Time the first SYN was received, in microseconds */
+} synq_entry_t;
+
+/**
+ * @brief Handles a packet for a listening queue, no TCB was found for.
+ *
+ * @note Must be called from a context where the listening queue list is locked.
+ *
+ * @param[in] queue    Listening queue the packet is addressed to.
+ * @param[in] in_pkt   Incoming packet.
+ *
+ * @returns   Zero if @p in_pkt was handled.
+ *            -ENOTCONN if @p in_pkt belongs to no connection and should be reset.
+ */
+int _synq_rcvd_pkt(gnrc_tcp_tcb_queue_t *queue, gnrc_pktsnip_t *in_pkt);
+
+/**
+ * @brief Retransmits the SYN+ACK of all half-open connections and drops expired ones.
+ *
+ * @note Called from the event loop on MSG_TYPE_SYNQ_TIMEOUT.
+ */
+void _synq_timeout(void);
+
+/**
+ * @brief Drops all half-open connections of a listening queue.
+ *
+ * @note Must be called from a context where the listening queue list is locked.
+ *
+ * @param[in] queue   Listening queue.
+ */
+void _synq_flush(const gnrc_tcp_tcb_queue_t *queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SYNQ_H */
+/** @} */
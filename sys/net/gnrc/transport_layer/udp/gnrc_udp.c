@@ -220,6 +220,20 @@ static void _send(gnrc_pktsnip_t *pkt)
     }
 }
 
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+static gnrc_netapi_direct_t _direct;
+
+static void _direct_handler(uint16_t type, gnrc_pktsnip_t *pkt)
+{
+    if (type == GNRC_NETAPI_MSG_TYPE_RCV) {
+        _receive(pkt);
+    }
+    else {
+        _send(pkt);
+    }
+}
+#endif
+
 static void *_event_loop(void *arg)
 {
     (void)arg;
@@ -234,10 +248,16 @@ static void *_event_loop(void *arg)
     msg_init_queue(msg_queue, GNRC_UDP_MSG_QUEUE_SIZE);
     /* register UPD at netreg */
     gnrc_netreg_register(GNRC_NETTYPE_UDP, &netreg);
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+    gnrc_netapi_direct_register(&_direct, _direct_handler);
+#endif
 
     /* dispatch NETAPI messages */
     while (1) {
         msg_receive(&msg);
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+        gnrc_netapi_direct_lock(&_direct);
+#endif
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV\n");
@@ -255,6 +275,9 @@ static void *_event_loop(void *arg)
                 DEBUG("udp: received unidentified message\n");
                 break;
         }
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+        gnrc_netapi_direct_unlock(&_direct);
+#endif
     }
 
     /* never reached */
@@ -33,6 +33,42 @@ static inline bool match(const l2filter_t *filter,
             (memcmp(filter->addr, addr, addr_len) == 0));
 }
 
+/* gets the slot an address is placed at if it is not taken */
+static unsigned _home(const void *addr, size_t addr_len)
+{
+    const uint8_t *bytes = addr;
+    uint32_t hash = addr_len;
+
+    for (unsigned i = 0; i < addr_len; i++) {
+        hash = (hash * 31) + bytes[i];
+    }
+    return hash % L2FILTER_LISTSIZE;
+}
+
+static inline unsigned _next(unsigned i)
+{
+    return (i + 1 < L2FILTER_LISTSIZE) ? i + 1 : 0;
+}
+
+/* entries are placed at the first free slot from their home slot on and
+ * there are no free slots between an entry and its home slot, so a lookup
+ * ends at the first free slot */
+static int _find(const l2filter_t *list, const void *addr, size_t addr_len)
+{
+    unsigned i = _home(addr, addr_len);
+
+    for (unsigned n = 0; n < L2FILTER_LISTSIZE; n++) {
+        if (list[i].addr_len == 0) {
+            break;
+        }
+        if (match(&list[i], addr, addr_len)) {
+            return i;
+        }
+        i = _next(i);
+    }
+    return -1;
+}
+
 void l2filter_init(l2filter_t *list)
 {
     assert(list);
@@ -47,14 +83,16 @@ int l2filter_add(l2filter_t *list, const void *addr, size_t addr_len)
     assert(list && addr && (addr_len <= L2FILTER_ADDR_MAXLEN));
 
     int res = -ENOMEM;
+    unsigned i = _home(addr, addr_len);
 
-    for (unsigned i = 0; i < L2FILTER_LISTSIZE; i++) {
+    for (unsigned n = 0; n < L2FILTER_LISTSIZE; n++) {
         if (list[i].addr_len == 0) {
             list[i].addr_len = addr_len;
             memcpy(list[i].addr, addr, addr_len);
             res = 0;
             break;
         }
+        i = _next(i);
     }
 
     return res;
@@ -64,17 +102,29 @@ int l2filter_rm(l2filter_t *list, const void *addr, size_t addr_len)
 {
     assert(list && addr && (addr_len <= L2FILTER_ADDR_MAXLEN));
 
-    int res = -ENOENT;
+    int i = _find(list, addr, addr_len);
 
-    for (unsigned i = 0; i < L2FILTER_LISTSIZE; i++) {
-        if (match(&list[i], addr, addr_len)) {
-            list[i].addr_len = 0;
-            res = 0;
-            break;
+    if (i < 0) {
+        return -ENOENT;
+    }
+
+    /* move following entries back into the gap, unless their home slot lies
+     * behind it, so that no entry is cut off from its home slot */
+    unsigned gap = i;
+    unsigned j = _next(gap);
+    for (unsigned n = 1; (n < L2FILTER_LISTSIZE) && (list[j].addr_len != 0);
+         n++, j = _next(j)) {
+        unsigned home = _home(list[j].addr, list[j].addr_len);
+        bool stays = (gap <= j) ? ((gap < home) && (home <= j))
+                                : ((gap < home) || (home <= j));
+        if (!stays) {
+            list[gap] = list[j];
+            gap = j;
         }
     }
+    list[gap].addr_len = 0;
 
-    return res;
+    return 0;
 }
 
 bool l2filter_pass(const l2filter_t *list, const void *addr, size_t addr_len)
@@ -82,25 +132,13 @@ bool l2filter_pass(const l2filter_t *list, const void *addr, size_t addr_len)
     assert(list && addr && (addr_len <= L2FILTER_ADDR_MAXLEN));
 
 #ifdef MODULE_L2FILTER_WHITELIST
-    bool res = false;
-    for (unsigned i = 0; i < L2FILTER_LISTSIZE; i++) {
-        if (match(&list[i], addr, addr_len)) {
-            DEBUG("[l2filter] whitelist: address match -> packet passes\n");
-            res = true;
-            break;
-        }
-    }
-    DEBUG("[l2filter] whitelist: no match -> packet dropped\n");
+    bool res = (_find(list, addr, addr_len) >= 0);
+    DEBUG("[l2filter] whitelist: %s -> packet %s\n",
+          res ? "address match" : "no match", res ? "passes" : "dropped");
 #else
-    bool res = true;
-    for (unsigned i = 0; i < L2FILTER_LISTSIZE; i++) {
-        if (match(&list[i], addr, addr_len)) {
-            DEBUG("[l2filter] blacklist: address match -> packet dropped\n");
-            res = false;
-            break;
-        }
-    }
-    DEBUG("[l2fitler] blacklist: no match -> packet passes\n");
+    bool res = (_find(list, addr, addr_len) < 0);
+    DEBUG("[l2filter] blacklist: %s -> packet %s\n",
+          res ? "no match" : "address match", res ? "passes" : "dropped");
 #endif
 
     return res;
@@ -65,9 +65,193 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
     *target = xtimer_now_usec64() + (ms * US_PER_MS);
 }
 
+/**
+ * @brief returns the number of leading bits of the destination of @p entry
+ *        that are significant for matching, i.e. its key length in the index
+ *
+ * @param[in] entry     the entry, with global set
+ *
+ * @return 0 for a default route (all zero destination)
+ *         the prefix length for a prefix shorter than the destination
+ *         the destination length in bits otherwise
+ */
+static uint8_t fib_idx_len(fib_entry_t *entry)
+{
+    size_t len = entry->global->address_size << 3;
+    size_t i = 0;
+
+    while ((i < entry->global->address_size) && (entry->global->address[i] == 0)) {
+        i++;
+    }
+    if (i == entry->global->address_size) {
+        return 0;
+    }
+    if (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK) {
+        size_t prefix_len = (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK)
+                            >> FIB_FLAG_NET_PREFIX_SHIFT;
+
+        if (prefix_len < len) {
+            return prefix_len;
+        }
+    }
+    return len;
+}
+
+/**
+ * @brief returns the index bucket for the first @p len bits of an address
+ *
+ * @param[in] table     the FIB table
+ * @param[in] addr      the address
+ * @param[in] addr_size the address size
+ * @param[in] len       the number of leading bits of @p addr to consider
+ *
+ * @return the entry of @p table holding the head of the bucket
+ */
+static fib_entry_t *fib_idx_bucket(fib_table_t *table, const uint8_t *addr,
+                                   size_t addr_size, uint8_t len)
+{
+    /* FNV-1a over the significant bits */
+    uint32_t hash = 2166136261U ^ (addr_size << 8) ^ len;
+    size_t bytes = len >> 3;
+
+    for (size_t i = 0; i < bytes; ++i) {
+        hash = (hash ^ addr[i]) * 16777619U;
+    }
+    if (len & 0x7) {
+        hash = (hash ^ (addr[bytes] & (0xff << (8 - (len & 0x7))))) * 16777619U;
+    }
+
+    return &(table->data.entries[hash % table->size]);
+}
+
+/**
+ * @brief checks if the first @p len bits of an address match the destination
+ *        of an indexed entry with key length @p len
+ */
+static bool fib_idx_match(fib_entry_t *entry, const uint8_t *addr,
+                          size_t addr_size, uint8_t len)
+{
+    size_t bytes = len >> 3;
+
+    if ((entry->idx_len != len) || (entry->global->address_size != addr_size) ||
+        (memcmp(entry->global->address, addr, bytes) != 0)) {
+        return false;
+    }
+    if (len & 0x7) {
+        uint8_t mask = 0xff << (8 - (len & 0x7));
+
+        return ((entry->global->address[bytes] ^ addr[bytes]) & mask) == 0;
+    }
+    return true;
+}
+
+/**
+ * @brief adds a newly created entry to the index
+ */
+static void fib_idx_add(fib_table_t *table, fib_entry_t *entry)
+{
+    fib_entry_t *bucket;
+
+    entry->idx_len = fib_idx_len(entry);
+    bucket = fib_idx_bucket(table, entry->global->address,
+                            entry->global->address_size, entry->idx_len);
+    entry->idx_next = bucket->idx_head;
+    bucket->idx_head = entry;
+    bf_set(table->idx_lens, entry->idx_len);
+}
+
+/**
+ * @brief removes an entry from the index
+ */
+static void fib_idx_rem(fib_table_t *table, fib_entry_t *entry)
+{
+    fib_entry_t **ptr = &(fib_idx_bucket(table, entry->global->address,
+                                         entry->global->address_size,
+                                         entry->idx_len)->idx_head);
+
+    while (*ptr != NULL) {
+        if (*ptr == entry) {
+            *ptr = entry->idx_next;
+            break;
+        }
+        ptr = &((*ptr)->idx_next);
+    }
+    entry->idx_next = NULL;
+
+    /* keep the key length only if another entry still uses it */
+    for (size_t i = 0; i < table->size; ++i) {
+        if ((&table->data.entries[i] != entry) &&
+            (table->data.entries[i].global != NULL) &&
+            (table->data.entries[i].idx_len == entry->idx_len)) {
+            return;
+        }
+    }
+    bf_unset(table->idx_lens, entry->idx_len);
+}
+
+/**
+ * @brief inserts an entry into the expiry list ordered by lifetime
+ */
+static void fib_exp_add(fib_table_t *table, fib_entry_t *entry)
+{
+    fib_entry_t **ptr = &(table->expiry);
+
+    if (entry->lifetime == FIB_LIFETIME_NO_EXPIRE) {
+        return;
+    }
+    while ((*ptr != NULL) && ((*ptr)->lifetime <= entry->lifetime)) {
+        ptr = &((*ptr)->exp_next);
+    }
+    entry->exp_next = *ptr;
+    *ptr = entry;
+}
+
+/**
+ * @brief removes an entry from the expiry list
+ */
+static void fib_exp_rem(fib_table_t *table, fib_entry_t *entry)
+{
+    fib_entry_t **ptr = &(table->expiry);
+
+    while (*ptr != NULL) {
+        if (*ptr == entry) {
+            *ptr = entry->exp_next;
+            break;
+        }
+        ptr = &((*ptr)->exp_next);
+    }
+    entry->exp_next = NULL;
+}
+
+static int fib_remove(fib_table_t *table, fib_entry_t *entry);
+
+/**
+ * @brief removes all entries whose lifetime expired
+ *
+ * The expiry list is ordered, so only its head needs to be checked and the
+ * current time is only read if there is an expiring entry at all.
+ *
+ * @param[in] table     the FIB table
+ */
+static void fib_expire(fib_table_t *table)
+{
+    if (table->expiry != NULL) {
+        uint64_t now = xtimer_now_usec64();
+
+        while ((table->expiry != NULL) && (table->expiry->lifetime < now)) {
+            fib_remove(table, table->expiry);
+        }
+    }
+}
+
 /**
  * @brief returns pointer to the entry for the given destination address
  *
+ * The entries are indexed by the leading bits of their destination that are
+ * significant for matching. For each key length in use, starting with the
+ * longest, only the index bucket for @p dst is searched, so the lookup does not
+ * depend on the number of entries.
+ *
  * @param[in] table                the FIB table to search in
  * @param[in] dst                  the destination address
  * @param[in] dst_size             the destination address size
@@ -81,13 +265,8 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
  */
 static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
                           fib_entry_t **entry_arr, size_t *entry_arr_size) {
-    uint64_t now = xtimer_now_usec64();
-
     size_t count = 0;
-    size_t prefix_size = 0;
-    size_t match_size = dst_size << 3;
     int ret = -EHOSTUNREACH;
-    bool is_all_zeros_addr = true;
 
 #if ENABLE_DEBUG
     DEBUG("[fib_find_entry] dst =");
@@ -97,80 +276,37 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     DEBUG("\n");
 #endif
 
-    for (size_t i = 0; i < dst_size; ++i) {
-        if (dst[i] != 0) {
-            is_all_zeros_addr = false;
-            break;
-        }
-    }
-
-    for (size_t i = 0; i < table->size; ++i) {
-
-        /* autoinvalidate if the entry lifetime is not set to not expire */
-        if (table->data.entries[i].lifetime != FIB_LIFETIME_NO_EXPIRE) {
+    fib_expire(table);
 
-            /* check if the lifetime expired */
-            if (table->data.entries[i].lifetime < now) {
-                /* remove this entry if its lifetime expired */
-                table->data.entries[i].lifetime = 0;
-                table->data.entries[i].global_flags = 0;
-                table->data.entries[i].next_hop_flags = 0;
-                table->data.entries[i].iface_id = KERNEL_PID_UNDEF;
-
-                if (table->data.entries[i].global != NULL) {
-                    universal_address_rem(table->data.entries[i].global);
-                    table->data.entries[i].global = NULL;
-                }
+    if ((table->size == 0) || (dst_size > UNIVERSAL_ADDRESS_SIZE)) {
+        *entry_arr_size = 0;
+        return ret;
+    }
 
-                if (table->data.entries[i].next_hop != NULL) {
-                    universal_address_rem(table->data.entries[i].next_hop);
-                    table->data.entries[i].next_hop = NULL;
-                }
-            }
+    for (int len = dst_size << 3; len >= 0; --len) {
+        if (!bf_isset(table->idx_lens, len)) {
+            continue;
         }
 
-        if ((prefix_size < (dst_size<<3)) && (table->data.entries[i].global != NULL)) {
+        fib_entry_t *entry = fib_idx_bucket(table, dst, dst_size, len)->idx_head;
 
-            int ret_comp = universal_address_compare(table->data.entries[i].global, dst, &match_size);
+        for (; entry != NULL; entry = entry->idx_next) {
+            if (!fib_idx_match(entry, dst, dst_size, len)) {
+                continue;
+            }
             /* If we found an exact match */
-            if ((ret_comp == UNIVERSAL_ADDRESS_EQUAL)
-                || (is_all_zeros_addr && (ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS))) {
-                entry_arr[0] = &(table->data.entries[i]);
+            if (memcmp(entry->global->address, dst, dst_size) == 0) {
+                entry_arr[0] = entry;
                 *entry_arr_size = 1;
                 /* we will not find a better one so we return */
                 return 1;
             }
-            else {
-                /* we try to find the most fitting prefix */
-                if (ret_comp == UNIVERSAL_ADDRESS_MATCHING_PREFIX) {
-                    if (table->data.entries[i].global_flags & FIB_FLAG_NET_PREFIX_MASK) {
-                        /* we shift the most upper flag byte back to get the number of prefix bits */
-                        size_t global_prefix_len = (table->data.entries[i].global_flags
-                                                    & FIB_FLAG_NET_PREFIX_MASK) >> FIB_FLAG_NET_PREFIX_SHIFT;
-
-                        if ((match_size >= global_prefix_len) &&
-                            ((prefix_size == 0) || (match_size > prefix_size))) {
-                            entry_arr[0] = &(table->data.entries[i]);
-                            /* we could find a better one so we move on */
-                            ret = 0;
-
-                            prefix_size = match_size;
-                            count = 1;
-                        }
-                    }
-                 }
-                 else if (ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS) {
-                    /* we found the default gateway entry, e.g. ::/0 for IPv6
-                     * and we keep it only if there is no better one
-                     */
-                    if (prefix_size == 0) {
-                        entry_arr[0] = &(table->data.entries[i]);
-                        /* we could find a better one so we move on */
-                        ret = 0;
-                        count = 1;
-                    }
-                }
-                match_size = dst_size<<3;
+            /* the first prefix found is the longest one, but an exact match
+             * with a shorter key may still follow */
+            if (count == 0) {
+                entry_arr[0] = entry;
+                ret = 0;
+                count = 1;
             }
         }
     }
@@ -192,6 +328,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
 /**
  * @brief updates the next hop the lifetime and the interface id for a given entry
  *
+ * @param[in] table          the FIB table containing the entry
  * @param[in] entry          the entry to be updated
  * @param[in] next_hop       the next hop address to be updated
  * @param[in] next_hop_size  the next hop address size
@@ -201,7 +338,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
  * @return 0 if the entry has been updated
  *         -ENOMEM if the entry cannot be updated due to insufficient RAM
  */
-static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
+static int fib_upd_entry(fib_table_t *table, fib_entry_t *entry, uint8_t *next_hop,
                          size_t next_hop_size, uint32_t next_hop_flags,
                          uint32_t lifetime)
 {
@@ -215,12 +352,14 @@ static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
     entry->next_hop = container;
     entry->next_hop_flags = next_hop_flags;
 
+    fib_exp_rem(table, entry);
     if (lifetime != (uint32_t)FIB_LIFETIME_NO_EXPIRE) {
         fib_lifetime_to_absolute(lifetime, &entry->lifetime);
     }
     else {
         entry->lifetime = FIB_LIFETIME_NO_EXPIRE;
     }
+    fib_exp_add(table, entry);
 
     return 0;
 }
@@ -268,8 +407,18 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                     table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
                 }
 
+                fib_idx_add(table, &table->data.entries[i]);
+                fib_exp_add(table, &table->data.entries[i]);
                 return 0;
             }
+
+            if (table->data.entries[i].global != NULL) {
+                /* do not leak the destination if the next hop failed */
+                universal_address_rem(table->data.entries[i].global);
+                table->data.entries[i].global = NULL;
+                table->data.entries[i].global_flags = 0;
+            }
+            return -ENOMEM;
         }
     }
 
@@ -279,13 +428,16 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
 /**
  * @brief removes the given entry
  *
+ * @param[in] table the FIB table containing the entry
  * @param[in] entry the entry to be removed
  *
  * @return 0 on success
  */
-static int fib_remove(fib_entry_t *entry)
+static int fib_remove(fib_table_t *table, fib_entry_t *entry)
 {
     if (entry->global != NULL) {
+        fib_idx_rem(table, entry);
+        fib_exp_rem(table, entry);
         universal_address_rem(entry->global);
     }
 
@@ -403,7 +555,7 @@ int fib_add_entry(fib_table_t *table,
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
     }
     else {
         ret = fib_create_entry(table, iface_id, dst, dst_size, dst_flags,
@@ -433,7 +585,7 @@ int fib_update_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     if (fib_find_entry(table, dst, dst_size, &(entry[0]), &count) == 1) {
         DEBUG("[fib_update_entry] found entry: %p\n", (void *)(entry[0]));
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -457,7 +609,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        fib_remove(entry[0]);
+        fib_remove(table, entry[0]);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -477,7 +629,7 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     for (size_t i = 0; i < table->size; ++i) {
         if ((interface == KERNEL_PID_UNDEF) ||
             (interface == table->data.entries[i].iface_id)) {
-            fib_remove(&table->data.entries[i]);
+            fib_remove(table, &table->data.entries[i]);
         }
     }
 
@@ -547,6 +699,8 @@ int fib_get_destination_set(fib_table_t *table, uint8_t *prefix,
     int ret = -EHOSTUNREACH;
     size_t found_entries = 0;
 
+    fib_expire(table);
+
     for (size_t i = 0; i < table->size; ++i) {
         if ((table->data.entries[i].global != NULL) &&
             (universal_address_compare_prefix(table->data.entries[i].global, prefix, prefix_size<<3) >= UNIVERSAL_ADDRESS_EQUAL)) {
@@ -596,6 +750,8 @@ void fib_init(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+        table->expiry = NULL;
+        memset(table->idx_lens, 0, sizeof(table->idx_lens));
     }
     universal_address_init();
     mutex_unlock(&(table->mtx_access));
@@ -621,6 +777,8 @@ void fib_deinit(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+        table->expiry = NULL;
+        memset(table->idx_lens, 0, sizeof(table->idx_lens));
     }
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
@@ -0,0 +1,376 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   epoll implementation on top of vfs_poll()
+ *
+ * Each watched file descriptor registers a waiter with its driver. The
+ * waiter puts the file descriptor into the ready list of its epoll instance,
+ * so epoll_wait() only queries the file descriptors in that list. File
+ * descriptors still ready after reporting are put back into the list, which
+ * makes readiness level-triggered.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdbool.h>
+#include <sys/epoll.h>
+
+#include "clist.h"
+#include "irq.h"
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "sched.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "timex.h"
+#include "vfs.h"
+#include "xtimer.h"
+
+typedef struct {
+    clist_node_t ready;         /**< file descriptors to query */
+    thread_t *waiter;           /**< thread waiting in epoll_wait() */
+    int fd;                     /**< file descriptor of the instance */
+    bool used;                  /**< instance is in use */
+} _epoll_t;
+
+typedef struct {
+    vfs_poll_waiter_t super;    /**< waiter registered with the file */
+    clist_node_t ready_node;    /**< node in the ready list of ep */
+    _epoll_t *ep;               /**< epoll instance, NULL if unused */
+    struct epoll_event event;   /**< events to report and user data */
+    int fd;                     /**< watched file descriptor */
+    bool ready;                 /**< item is in the ready list */
+} _epoll_item_t;
+
+/* protects everything but the ready lists, which waiters change with
+ * interrupts disabled */
+static mutex_t _lock = MUTEX_INIT;
+static _epoll_t _instances[CONFIG_POSIX_EPOLL_INSTANCES];
+static _epoll_item_t _items[CONFIG_POSIX_EPOLL_ITEMS];
+
+static int _epoll_close(vfs_file_t *filp);
+
+static const vfs_file_ops_t _epoll_ops = {
+    .close = _epoll_close,
+};
+
+static _epoll_t *_get_instance(int epfd)
+{
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_INSTANCES; i++) {
+        if (_instances[i].used && (_instances[i].fd == epfd)) {
+            return &_instances[i];
+        }
+    }
+    return NULL;
+}
+
+static _epoll_item_t *_get_item(const _epoll_t *ep, int fd)
+{
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_ITEMS; i++) {
+        if ((_items[i].ep == ep) && (_items[i].fd == fd)) {
+            return &_items[i];
+        }
+    }
+    return NULL;
+}
+
+/* must be called with interrupts disabled */
+static void _set_ready(_epoll_item_t *item)
+{
+    if (!item->ready) {
+        item->ready = true;
+        clist_rpush(&item->ep->ready, &item->ready_node);
+    }
+}
+
+static void _notify(vfs_poll_waiter_t *waiter)
+{
+    _epoll_item_t *item = container_of(waiter, _epoll_item_t, super);
+    unsigned state = irq_disable();
+
+    _set_ready(item);
+    if (item->ep->waiter != NULL) {
+        thread_flags_set(item->ep->waiter, POSIX_POLL_THREAD_FLAG);
+    }
+    irq_restore(state);
+}
+
+static void _free_item(_epoll_item_t *item)
+{
+    /* fails for a file descriptor that was closed before */
+    vfs_poll(item->fd, NULL);
+
+    unsigned state = irq_disable();
+
+    if (item->ready) {
+        clist_remove(&item->ep->ready, &item->ready_node);
+    }
+    item->ready = false;
+    item->ep = NULL;
+    irq_restore(state);
+}
+
+static int _epoll_close(vfs_file_t *filp)
+{
+    _epoll_t *ep = filp->private_data.ptr;
+
+    mutex_lock(&_lock);
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_ITEMS; i++) {
+        if (_items[i].ep == ep) {
+            _free_item(&_items[i]);
+        }
+    }
+    ep->used = false;
+    mutex_unlock(&_lock);
+    return 0;
+}
+
+int epoll_create1(int flags)
+{
+    _epoll_t *ep = NULL;
+    int fd;
+
+    if (flags != 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    mutex_lock(&_lock);
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_INSTANCES; i++) {
+        if (!_instances[i].used) {
+            ep = &_instances[i];
+            break;
+        }
+    }
+    if (ep == NULL) {
+        mutex_unlock(&_lock);
+        errno = ENFILE;
+        return -1;
+    }
+    fd = vfs_bind(VFS_ANY_FD, O_RDWR, &_epoll_ops, ep);
+    if (fd < 0) {
+        mutex_unlock(&_lock);
+        errno = -fd;
+        return -1;
+    }
+    ep->ready.next = NULL;
+    ep->waiter = NULL;
+    ep->fd = fd;
+    ep->used = true;
+    mutex_unlock(&_lock);
+    return fd;
+}
+
+int epoll_create(int size)
+{
+    if (size <= 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    return epoll_create1(0);
+}
+
+static int _ctl_add(_epoll_t *ep, int fd, const struct epoll_event *event)
+{
+    _epoll_item_t *item = NULL;
+    int res;
+
+    if (_get_item(ep, fd) != NULL) {
+        return -EEXIST;
+    }
+    for (unsigned i = 0; i < CONFIG_POSIX_EPOLL_ITEMS; i++) {
+        if (_items[i].ep == NULL) {
+            item = &_items[i];
+            break;
+        }
+    }
+    if (item == NULL) {
+        return -ENOSPC;
+    }
+    item->super.cb = _notify;
+    item->ep = ep;
+    item->event = *event;
+    item->fd = fd;
+    item->ready = false;
+    res = vfs_poll(fd, &item->super);
+    if ((res < 0) && (res != -ENOTSUP)) {
+        item->ep = NULL;
+        return res;
+    }
+    /* query the file descriptor with the next epoll_wait() */
+    _notify(&item->super);
+    return 0;
+}
+
+int epoll_ctl(int epfd, int op, int fd, struct epoll_event *event)
+{
+    _epoll_t *ep;
+    _epoll_item_t *item;
+    int res = 0;
+
+    if ((op != EPOLL_CTL_DEL) && (event == NULL)) {
+        errno = EFAULT;
+        return -1;
+    }
+    mutex_lock(&_lock);
+    ep = _get_instance(epfd);
+    if (ep == NULL) {
+        res = -EBADF;
+    }
+    else if (fd == epfd) {
+        res = -EINVAL;
+    }
+    else if (op == EPOLL_CTL_ADD) {
+        res = _ctl_add(ep, fd, event);
+    }
+    else if ((item = _get_item(ep, fd)) == NULL) {
+        res = -ENOENT;
+    }
+    else if (op == EPOLL_CTL_MOD) {
+        item->event = *event;
+        _notify(&item->super);
+    }
+    else if (op == EPOLL_CTL_DEL) {
+        _free_item(item);
+    }
+    else {
+        res = -EINVAL;
+    }
+    mutex_unlock(&_lock);
+    if (res < 0) {
+        errno = -res;
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief   Queries the file descriptors in the ready list of @p ep
+ *
+ * @return  number of entries filled in @p events
+ */
+static int _collect(_epoll_t *ep, struct epoll_event *events, int maxevents)
+{
+    unsigned state = irq_disable();
+    /* file descriptors put back into the list are queried next time */
+    size_t num = clist_count(&ep->ready);
+    int n = 0;
+
+    irq_restore(state);
+    while (num--) {
+        _epoll_item_t *item;
+        uint32_t revents;
+        int res;
+
+        state = irq_disable();
+        item = container_of(clist_lpop(&ep->ready), _epoll_item_t, ready_node);
+        item->ready = false;
+        irq_restore(state);
+
+        res = vfs_poll(item->fd, &item->super);
+        if (res == -ENOTSUP) {
+            /* reading or writing the file never blocks */
+            res = POLLIN | POLLOUT;
+        }
+        else if (res < 0) {
+            /* file descriptor was closed without removing it, the item is
+             * not in the ready list anymore and can be freed right away */
+            item->ep = NULL;
+            continue;
+        }
+        /* EPOLLONESHOT items are disabled by clearing their events */
+        if ((item->event.events & ~EPOLLONESHOT) == 0) {
+            continue;
+        }
+        revents = res & (item->event.events | EPOLLERR | EPOLLHUP);
+        if (revents == 0) {
+            continue;
+        }
+        if (n < maxevents) {
+            events[n].events = revents;
+            events[n].data = item->event.data;
+            n++;
+            if (item->event.events & EPOLLONESHOT) {
+                item->event.events = EPOLLONESHOT;
+                continue;
+            }
+        }
+        /* still ready, query it again */
+        state = irq_disable();
+        _set_ready(item);
+        irq_restore(state);
+    }
+    return n;
+}
+
+int epoll_wait(int epfd, struct epoll_event *events, int maxevents,
+               int timeout)
+{
+    xtimer_t timer = { .callback = NULL };
+    _epoll_t *ep;
+    int n;
+
+    if ((events == NULL) || (maxevents <= 0)) {
+        errno = EINVAL;
+        return -1;
+    }
+    mutex_lock(&_lock);
+    ep = _get_instance(epfd);
+    if (ep == NULL) {
+        mutex_unlock(&_lock);
+        errno = EBADF;
+        return -1;
+    }
+    thread_flags_clear(POSIX_POLL_THREAD_FLAG | THREAD_FLAG_TIMEOUT);
+    if (timeout > 0) {
+        xtimer_set_timeout_flag64(&timer, (uint64_t)timeout * US_PER_MS);
+    }
+    while (((n = _collect(ep, events, maxevents)) == 0) && (timeout != 0)) {
+        unsigned state = irq_disable();
+
+        if (ep->ready.next != NULL) {
+            /* a file descriptor got ready while collecting */
+            irq_restore(state);
+            continue;
+        }
+        ep->waiter = (thread_t *)sched_active_thread;
+        irq_restore(state);
+
+        mutex_unlock(&_lock);
+        thread_flags_t flags = thread_flags_wait_any(POSIX_POLL_THREAD_FLAG |
+                                                     THREAD_FLAG_TIMEOUT);
+        mutex_lock(&_lock);
+
+        state = irq_disable();
+        ep->waiter = NULL;
+        irq_restore(state);
+        if (flags & THREAD_FLAG_TIMEOUT) {
+            /* collect a last time */
+            timeout = 0;
+        }
+        if (!ep->used) {
+            /* instance was closed while waiting */
+            n = -EBADF;
+            break;
+        }
+    }
+    mutex_unlock(&_lock);
+    xtimer_remove(&timer);
+    thread_flags_clear(POSIX_POLL_THREAD_FLAG | THREAD_FLAG_TIMEOUT);
+    if (n < 0) {
+        errno = -n;
+        return -1;
+    }
+    return n;
+}
+
+/** @} */
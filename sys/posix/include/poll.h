@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    posix_select POSIX poll() and select()
+ * @ingroup     posix
+ * @brief       Waiting for readiness of file descriptors
+ *
+ * The readiness of a file descriptor is queried with @ref vfs_poll(). Files
+ * with a driver not providing vfs_file_ops::poll are always ready for
+ * reading and writing. @ref posix_sockets report their readiness with
+ * @ref net_sock_async, so the module pulls in the asynchronous extension of
+ * the network stack in use.
+ *
+ * `select()` uses `fd_set` and the `FD_*()` macros of the C library, see
+ * `<sys/select.h>`. A file descriptor can only be watched by one thread at a
+ * time. The waiting thread is woken up with @ref POSIX_POLL_THREAD_FLAG, which
+ * must not be used otherwise by the thread.
+ *
+ * @{
+ * @file
+ * @brief   Input/output multiplexing
+ * @see     <a href="http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/poll.h.html">
+ *              The Open Group Base Specifications Issue 7, <poll.h>
+ *          </a>
+ */
+
+#ifndef POLL_H
+#define POLL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name Events of a file descriptor
+ * @{
+ */
+#define POLLIN      (0x001)     /**< Data other than high-priority data may be read */
+#define POLLPRI     (0x002)     /**< High-priority data may be read */
+#define POLLOUT     (0x004)     /**< Normal data may be written */
+#define POLLERR     (0x008)     /**< An error has occurred (revents only) */
+#define POLLHUP     (0x010)     /**< Device has been disconnected (revents only) */
+#define POLLNVAL    (0x020)     /**< Invalid fd member (revents only) */
+#define POLLRDNORM  (0x040)     /**< Normal data may be read */
+#define POLLRDBAND  (0x080)     /**< Priority data may be read */
+#define POLLWRNORM  (0x100)     /**< Equivalent to POLLOUT */
+#define POLLWRBAND  (0x200)     /**< Priority data may be written */
+/** @} */
+
+/**
+ * @brief   Thread flag waking up a thread waiting in poll(), select() or
+ *          epoll_wait()
+ */
+#define POSIX_POLL_THREAD_FLAG  (1u << 13)
+
+/**
+ * @brief   Type used for the number of file descriptors
+ */
+typedef unsigned int nfds_t;
+
+/**
+ * @brief   File descriptor to poll
+ */
+struct pollfd {
+    int fd;             /**< The following descriptor being polled */
+    short events;       /**< The input event flags */
+    short revents;      /**< The output event flags */
+};
+
+/**
+ * @brief   Waits until one of the file descriptors is ready
+ *
+ * @see <a href="http://pubs.opengroup.org/onlinepubs/9699919799/functions/poll.html">
+ *          The Open Group Base Specifications Issue 7, poll()
+ *      </a>
+ *
+ * @param[in,out] fds       File descriptors to poll. Entries with a negative
+ *                          fd member are ignored.
+ * @param[in]     nfds      Number of entries in @p fds.
+ * @param[in]     timeout   Time to wait in milliseconds, -1 to wait until a
+ *                          file descriptor is ready, 0 to return immediately.
+ *
+ * @return  Number of entries in @p fds with a non-zero revents member.
+ * @return  0 if @p timeout expired.
+ * @return  -1 on error, errno is set to indicate the error.
+ */
+int poll(struct pollfd *fds, nfds_t nfds, int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POLL_H */
+/** @} */
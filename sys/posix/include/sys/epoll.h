@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    posix_epoll Linux-style epoll
+ * @ingroup     posix
+ * @brief       Scalable waiting for readiness of file descriptors
+ *
+ * Unlike poll(), an epoll instance keeps its file descriptors registered.
+ * A file descriptor is only queried again when its driver reported that its
+ * readiness may have changed, so epoll_wait() does not depend on the number
+ * of file descriptors watched.
+ *
+ * Readiness is level-triggered and queried with @ref vfs_poll(), see
+ * @ref posix_select for the file descriptors supported. A file descriptor
+ * can only be watched by one epoll instance or poll() call at a time and
+ * must be removed from its epoll instance before it is closed.
+ *
+ * @{
+ * @file
+ * @brief   epoll API
+ * @see     man 7 epoll
+ */
+
+#ifndef SYS_EPOLL_H
+#define SYS_EPOLL_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of epoll instances
+ */
+#ifndef CONFIG_POSIX_EPOLL_INSTANCES
+#define CONFIG_POSIX_EPOLL_INSTANCES    (1U)
+#endif
+
+/**
+ * @brief   Maximum number of file descriptors watched by all epoll instances
+ */
+#ifndef CONFIG_POSIX_EPOLL_ITEMS
+#define CONFIG_POSIX_EPOLL_ITEMS        (8U)
+#endif
+
+/**
+ * @name Events of a file descriptor
+ * @{
+ */
+#define EPOLLIN         (0x001)     /**< Data may be read */
+#define EPOLLPRI        (0x002)     /**< High-priority data may be read */
+#define EPOLLOUT        (0x004)     /**< Data may be written */
+#define EPOLLERR        (0x008)     /**< An error has occurred, always reported */
+#define EPOLLHUP        (0x010)     /**< Peer closed the connection, always reported */
+#define EPOLLONESHOT    (1U << 30)  /**< Disable the file descriptor after reporting an event */
+/** @} */
+
+/**
+ * @name Operations of epoll_ctl()
+ * @{
+ */
+#define EPOLL_CTL_ADD   (1)     /**< Add a file descriptor */
+#define EPOLL_CTL_DEL   (2)     /**< Remove a file descriptor */
+#define EPOLL_CTL_MOD   (3)     /**< Change the events of a file descriptor */
+/** @} */
+
+/**
+ * @brief   User data of a watched file descriptor
+ */
+typedef union epoll_data {
+    void *ptr;          /**< pointer */
+    int fd;             /**< file descriptor */
+    uint32_t u32;       /**< 32-bit value */
+    uint64_t u64;       /**< 64-bit value */
+} epoll_data_t;
+
+/**
+ * @brief   Events and user data of a file descriptor
+ */
+struct epoll_event {
+    uint32_t events;    /**< Events, see EPOLLIN etc. */
+    epoll_data_t data;  /**< User data */
+};
+
+/**
+ * @brief   Creates an epoll instance
+ *
+ * @param[in] size  Ignored, but must be greater than zero.
+ *
+ * @return  File descriptor of the epoll instance.
+ * @return  -1 on error, errno is set to indicate the error.
+ */
+int epoll_create(int size);
+
+/**
+ * @brief   Creates an epoll instance
+ *
+ * @param[in] flags Must be 0.
+ *
+ * @return  File descriptor of the epoll instance.
+ * @return  -1 on error, errno is set to indicate the error.
+ */
+int epoll_create1(int flags);
+
+/**
+ * @brief   Adds, changes or removes a file descriptor of an epoll instance
+ *
+ * @param[in] epfd  File descriptor of the epoll instance.
+ * @param[in] op    EPOLL_CTL_ADD, EPOLL_CTL_MOD or EPOLL_CTL_DEL.
+ * @param[in] fd    File descriptor to watch.
+ * @param[in] event Events to wait for and user data to report. Ignored for
+ *                  EPOLL_CTL_DEL.
+ *
+ * @return  0 on success.
+ * @return  -1 on error, errno is set to indicate the error.
+ */
+int epoll_ctl(int epfd, int op, int fd, struct epoll_event *event);
+
+/**
+ * @brief   Waits until a file descriptor of an epoll instance is ready
+ *
+ * @param[in]  epfd      File descriptor of the epoll instance.
+ * @param[out] events    Ready file descriptors.
+ * @param[in]  maxevents Number of entries in @p events.
+ * @param[in]  timeout   Time to wait in milliseconds, -1 to wait until a
+ *                       file descriptor is ready, 0 to return immediately.
+ *
+ * @return  Number of entries filled in @p events.
+ * @return  0 if @p timeout expired.
+ * @return  -1 on error, errno is set to indicate the error.
+ */
+int epoll_wait(int epfd, struct epoll_event *events, int maxevents,
+               int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SYS_EPOLL_H */
+/** @} */
@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   poll() and select() implementation on top of vfs_poll()
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/select.h>
+
+#include "sched.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "timex.h"
+#include "vfs.h"
+#include "xtimer.h"
+
+#define _NO_TIMEOUT     (UINT64_MAX)
+
+/**
+ * @brief   Waiter waking up the thread waiting for readiness
+ */
+typedef struct {
+    vfs_poll_waiter_t super;    /**< waiter registered with the files */
+    thread_t *thread;           /**< waiting thread */
+} _waiter_t;
+
+/**
+ * @brief   Queries the readiness of a set of files
+ *
+ * @param[in] ctx       poll() or select() arguments
+ * @param[in] waiter    waiter to register with the files, NULL to unregister
+ *
+ * @return  number of file descriptors ready
+ * @return  -errno on error
+ */
+typedef int (*_query_t)(void *ctx, vfs_poll_waiter_t *waiter);
+
+static void _wake_up(vfs_poll_waiter_t *waiter)
+{
+    thread_flags_set(((_waiter_t *)waiter)->thread, POSIX_POLL_THREAD_FLAG);
+}
+
+static short _query_fd(int fd, short events, vfs_poll_waiter_t *waiter)
+{
+    int res = vfs_poll(fd, waiter);
+
+    if (res == -ENOTSUP) {
+        /* reading or writing the file never blocks */
+        res = POLLIN | POLLOUT;
+    }
+    else if (res == -EBADF) {
+        return POLLNVAL;
+    }
+    else if (res < 0) {
+        return POLLERR;
+    }
+    if (res & POLLIN) {
+        res |= POLLRDNORM;
+    }
+    if (res & POLLOUT) {
+        res |= POLLWRNORM;
+    }
+    return res & (events | POLLERR | POLLHUP);
+}
+
+/**
+ * @brief   Queries the files until one is ready or @p timeout expired
+ */
+static int _wait(_query_t query, void *ctx, uint64_t timeout)
+{
+    _waiter_t waiter = { .super = { .cb = _wake_up },
+                         .thread = (thread_t *)sched_active_thread };
+    xtimer_t timer = { .callback = NULL };
+    int res;
+
+    thread_flags_clear(POSIX_POLL_THREAD_FLAG | THREAD_FLAG_TIMEOUT);
+    if ((timeout != _NO_TIMEOUT) && (timeout > 0)) {
+        xtimer_set_timeout_flag64(&timer, timeout);
+    }
+    while (((res = query(ctx, &waiter.super)) == 0) && (timeout > 0)) {
+        thread_flags_t flags = thread_flags_wait_any(POSIX_POLL_THREAD_FLAG |
+                                                     THREAD_FLAG_TIMEOUT);
+
+        if (flags & THREAD_FLAG_TIMEOUT) {
+            /* query a last time */
+            timeout = 0;
+        }
+    }
+    query(ctx, NULL);
+    xtimer_remove(&timer);
+    thread_flags_clear(POSIX_POLL_THREAD_FLAG | THREAD_FLAG_TIMEOUT);
+    return res;
+}
+
+typedef struct {
+    struct pollfd *fds;
+    nfds_t nfds;
+} _poll_ctx_t;
+
+static int _poll_query(void *arg, vfs_poll_waiter_t *waiter)
+{
+    _poll_ctx_t *ctx = arg;
+    int ready = 0;
+
+    for (nfds_t i = 0; i < ctx->nfds; i++) {
+        struct pollfd *pfd = &ctx->fds[i];
+
+        if (pfd->fd < 0) {
+            pfd->revents = 0;
+            continue;
+        }
+        pfd->revents = _query_fd(pfd->fd, pfd->events, waiter);
+        if (pfd->revents != 0) {
+            ready++;
+        }
+    }
+    return ready;
+}
+
+int poll(struct pollfd *fds, nfds_t nfds, int timeout)
+{
+    _poll_ctx_t ctx = { .fds = fds, .nfds = nfds };
+
+    if ((fds == NULL) && (nfds > 0)) {
+        errno = EFAULT;
+        return -1;
+    }
+    return _wait(_poll_query, &ctx,
+                 (timeout < 0) ? _NO_TIMEOUT : (uint64_t)timeout * US_PER_MS);
+}
+
+typedef struct {
+    int nfds;
+    fd_set *readfds;
+    fd_set *writefds;
+    fd_set *errorfds;
+    fd_set readfds_in;
+    fd_set writefds_in;
+} _select_ctx_t;
+
+static int _select_query(void *arg, vfs_poll_waiter_t *waiter)
+{
+    _select_ctx_t *ctx = arg;
+    int ready = 0;
+
+    for (int fd = 0; fd < ctx->nfds; fd++) {
+        short events = 0;
+        short revents;
+
+        if (FD_ISSET(fd, &ctx->readfds_in)) {
+            events |= POLLIN;
+        }
+        if (FD_ISSET(fd, &ctx->writefds_in)) {
+            events |= POLLOUT;
+        }
+        if (events == 0) {
+            continue;
+        }
+        revents = _query_fd(fd, events, waiter);
+        if (waiter == NULL) {
+            /* only unregistering */
+            continue;
+        }
+        if (revents & POLLNVAL) {
+            return -EBADF;
+        }
+        /* reading does not block on errors and closed connections */
+        if ((events & POLLIN) && (revents & (POLLIN | POLLERR | POLLHUP))) {
+            FD_SET(fd, ctx->readfds);
+            ready++;
+        }
+        if ((events & POLLOUT) && (revents & (POLLOUT | POLLERR))) {
+            FD_SET(fd, ctx->writefds);
+            ready++;
+        }
+    }
+    return ready;
+}
+
+int select(int nfds, fd_set *restrict readfds, fd_set *restrict writefds,
+           fd_set *restrict errorfds, struct timeval *restrict timeout)
+{
+    _select_ctx_t ctx = { .nfds = nfds };
+    fd_set empty;
+    uint64_t timeout_us = _NO_TIMEOUT;
+    int res;
+
+    if ((nfds < 0) || (nfds > FD_SETSIZE)) {
+        errno = EINVAL;
+        return -1;
+    }
+    if (timeout != NULL) {
+        if ((timeout->tv_sec < 0) || (timeout->tv_usec < 0)) {
+            errno = EINVAL;
+            return -1;
+        }
+        timeout_us = ((uint64_t)timeout->tv_sec * US_PER_SEC) +
+                     timeout->tv_usec;
+    }
+    FD_ZERO(&empty);
+    ctx.readfds = (readfds != NULL) ? readfds : &empty;
+    ctx.writefds = (writefds != NULL) ? writefds : &empty;
+    ctx.errorfds = (errorfds != NULL) ? errorfds : &empty;
+    ctx.readfds_in = *ctx.readfds;
+    ctx.writefds_in = *ctx.writefds;
+    /* exceptional conditions are not supported, nothing to wait for */
+    FD_ZERO(ctx.errorfds);
+    FD_ZERO(ctx.readfds);
+    FD_ZERO(ctx.writefds);
+    res = _wait(_select_query, &ctx, timeout_us);
+    if (res < 0) {
+        errno = -res;
+        return -1;
+    }
+    return res;
+}
+
+/** @} */
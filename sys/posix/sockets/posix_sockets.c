@@ -24,6 +24,7 @@
 #include <string.h>
 
 #include "bitfield.h"
+#include "irq.h"
 #include "mutex.h"
 #include "net/ipv4/addr.h"
 #include "net/ipv6/addr.h"
@@ -37,6 +38,11 @@
 #include "net/sock/udp.h"
 #include "net/sock/tcp.h"
 
+#ifdef SOCK_HAS_ASYNC
+#include <poll.h>
+#include "net/sock/async.h"
+#endif
+
 /* enough to create sockets both with socket() and accept() */
 #define _ACTUAL_SOCKET_POOL_SIZE   (SOCKET_POOL_SIZE + \
                                     (SOCKET_POOL_SIZE * SOCKET_TCP_QUEUE_SIZE))
@@ -80,6 +86,14 @@ typedef struct {
     unsigned queue_array_len;
 #endif
     sock_tcp_ep_t local;        /* to store bind before connect/listen */
+    bool nonblock;              /* O_NONBLOCK was set with fcntl() */
+#ifdef SOCK_HAS_ASYNC
+    /* readiness state, only accessed with interrupts disabled */
+    vfs_poll_waiter_t *waiter;  /* waiter registered with socket_poll() */
+    uint16_t pending;           /* datagrams or connections not yet received,
+                                 * non-zero if a TCP connection got data */
+    bool hup;                   /* TCP connection was closed by the peer */
+#endif
 } socket_t;
 
 static socket_t _socket_pool[_ACTUAL_SOCKET_POOL_SIZE];
@@ -100,6 +114,8 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
 static ssize_t socket_sendto(socket_t *s, const void *buffer, size_t length,
                              int flags, const struct sockaddr *address,
                              socklen_t address_len);
+static int _bind_connect(socket_t *s, const struct sockaddr *address,
+                         socklen_t address_len);
 
 static socket_t *_get_free_socket(void)
 {
@@ -138,6 +154,106 @@ static int _get_sock_idx(socket_sock_t *sock)
     return sock - &_sock_pool[0];
 }
 
+#ifdef SOCK_HAS_ASYNC
+static void _socket_event(socket_t *s, sock_async_flags_t flags)
+{
+    unsigned state = irq_disable();
+
+    if (flags & (SOCK_ASYNC_MSG_RECV | SOCK_ASYNC_CONN_RECV)) {
+#ifdef MODULE_SOCK_TCP
+        /* TCP streams don't have message boundaries */
+        if ((s->type == SOCK_STREAM) && (s->queue_array == NULL)) {
+            s->pending = 1;
+        }
+        else
+#endif
+        {
+            s->pending++;
+        }
+    }
+    if (flags & SOCK_ASYNC_CONN_FIN) {
+        s->hup = true;
+    }
+    if (s->waiter != NULL) {
+        s->waiter->cb(s->waiter);
+    }
+    irq_restore(state);
+}
+
+#ifdef MODULE_SOCK_IP
+static void _ip_cb(sock_ip_t *sock, sock_async_flags_t flags, void *arg)
+{
+    (void)sock;
+    _socket_event(arg, flags);
+}
+#endif
+
+#ifdef MODULE_SOCK_TCP
+static void _tcp_cb(sock_tcp_t *sock, sock_async_flags_t flags, void *arg)
+{
+    (void)sock;
+    _socket_event(arg, flags);
+}
+
+static void _tcp_queue_cb(sock_tcp_queue_t *queue, sock_async_flags_t flags,
+                          void *arg)
+{
+    (void)queue;
+    _socket_event(arg, flags);
+}
+#endif
+
+#ifdef MODULE_SOCK_UDP
+static void _udp_cb(sock_udp_t *sock, sock_async_flags_t flags, void *arg)
+{
+    (void)sock;
+    _socket_event(arg, flags);
+}
+#endif
+
+/**
+ * @brief   Marks a datagram or connection as received, if @p res says the
+ *          sock handed it out or dropped it
+ */
+static void _socket_consumed(socket_t *s, int res)
+{
+    if ((res < 0) && (res != -ENOBUFS) && (res != -EPROTO)) {
+        return;
+    }
+
+    unsigned state = irq_disable();
+
+    if (s->pending > 0) {
+        s->pending--;
+    }
+    irq_restore(state);
+}
+
+/**
+ * @brief   Sets or clears the data received flag of a TCP connection
+ */
+static void _socket_set_pending(socket_t *s, uint16_t pending)
+{
+    unsigned state = irq_disable();
+
+    s->pending = pending;
+    irq_restore(state);
+}
+#endif  /* SOCK_HAS_ASYNC */
+
+/**
+ * @brief   Initializes the state of a socket not holding a sock yet
+ */
+static void _socket_init_state(socket_t *s)
+{
+    s->nonblock = false;
+#ifdef SOCK_HAS_ASYNC
+    s->waiter = NULL;
+    s->pending = 0;
+    s->hup = false;
+#endif
+}
+
 static inline int _choose_ipproto(int type, int protocol)
 {
     switch (type) {
@@ -253,26 +369,39 @@ static int socket_close(vfs_file_t *filp)
     int res = 0;
 
     assert((s->domain == AF_INET) || (s->domain == AF_INET6));
-    mutex_lock(&_socket_pool_mutex);
     if (s->sock != NULL) {
         int idx = _get_sock_idx(s->sock);
+        /* closing a TCP connection blocks until the peer closed it too, so
+         * the pool is only locked to free the sock afterwards */
         switch (s->type) {
 #ifdef MODULE_SOCK_UDP
             case SOCK_DGRAM:
+#ifdef SOCK_HAS_ASYNC
+                sock_udp_set_cb(&s->sock->udp, NULL, NULL);
+#endif
                 sock_udp_close(&s->sock->udp);
                 break;
 #endif
 #ifdef MODULE_SOCK_IP
             case SOCK_RAW:
+#ifdef SOCK_HAS_ASYNC
+                sock_ip_set_cb(&s->sock->raw, NULL, NULL);
+#endif
                 sock_ip_close(&s->sock->raw);
                 break;
 #endif
 #ifdef MODULE_SOCK_TCP
             case SOCK_STREAM:
                 if (s->queue_array == NULL) {
+#ifdef SOCK_HAS_ASYNC
+                    sock_tcp_set_cb(&s->sock->tcp.sock, NULL, NULL);
+#endif
                     sock_tcp_disconnect(&s->sock->tcp.sock);
                 }
                 else {
+#ifdef SOCK_HAS_ASYNC
+                    sock_tcp_queue_set_cb(&s->sock->tcp.queue, NULL, NULL);
+#endif
                     sock_tcp_stop_listen(&s->sock->tcp.queue);
                 }
                 break;
@@ -283,15 +412,43 @@ static int socket_close(vfs_file_t *filp)
                 break;
         }
         if (idx >= 0) {
+            mutex_lock(&_socket_pool_mutex);
             bf_unset(_sock_pool_used, idx);
+            mutex_unlock(&_socket_pool_mutex);
         }
     }
-    mutex_unlock(&_socket_pool_mutex);
+    /* socket() reuses the socket as soon as its domain is unset */
+    mutex_lock(&_socket_pool_mutex);
     s->sock = NULL;
     s->domain = AF_UNSPEC;
+#ifdef SOCK_HAS_ASYNC
+    unsigned state = irq_disable();
+    if (s->waiter != NULL) {
+        /* the waiter finds the file closed when it queries it next */
+        s->waiter->cb(s->waiter);
+        s->waiter = NULL;
+    }
+    irq_restore(state);
+#endif
+    mutex_unlock(&_socket_pool_mutex);
     return res;
 }
 
+static int socket_fcntl(vfs_file_t *filp, int cmd, int arg)
+{
+    socket_t *s = filp->private_data.ptr;
+
+    switch (cmd) {
+        case F_SETFL:
+            /* only O_NONBLOCK can be changed on sockets */
+            filp->flags = (filp->flags & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+            s->nonblock = (arg & O_NONBLOCK);
+            return 0;
+        default:
+            return -EINVAL;
+    }
+}
+
 static inline int socket_fstat(vfs_file_t *filp, struct stat *buf)
 {
     (void)filp;
@@ -309,6 +466,56 @@ static inline off_t socket_lseek(vfs_file_t *filp, off_t off, int whence)
     return -ESPIPE; /* see http://pubs.opengroup.org/onlinepubs/9699919799/functions/lseek.html */
 }
 
+#ifdef SOCK_HAS_ASYNC
+static int socket_poll(vfs_file_t *filp, vfs_poll_waiter_t *waiter)
+{
+    socket_t *s = filp->private_data.ptr;
+    int events = 0;
+
+    if (s->domain == AF_UNSPEC) {
+        /* a notified waiter may query the socket while it is closed */
+        return -EBADF;
+    }
+    if ((s->sock == NULL) && s->bound && (s->type != SOCK_STREAM) &&
+        (waiter != NULL)) {
+        /* bind implicitly, to receive datagrams the caller waits for */
+        int res = _bind_connect(s, NULL, 0);
+
+        if (res < 0) {
+            return -errno;
+        }
+    }
+
+    unsigned state = irq_disable();
+
+    s->waiter = waiter;
+    if (s->pending > 0) {
+        events |= POLLIN;
+    }
+    if (s->hup) {
+        /* reading returns 0 at the end of the stream */
+        events |= POLLIN | POLLHUP;
+    }
+#ifdef MODULE_SOCK_TCP
+    if (s->type == SOCK_STREAM) {
+        if (s->sock == NULL) {
+            events |= POLLHUP;
+        }
+        else if (s->queue_array == NULL) {
+            events |= POLLOUT;
+        }
+    }
+    else
+#endif
+    {
+        /* datagram sockets are bound implicitly on sending */
+        events |= POLLOUT;
+    }
+    irq_restore(state);
+    return events;
+}
+#endif
+
 static inline ssize_t socket_read(vfs_file_t *filp, void *buf, size_t n)
 {
     return socket_recvfrom(filp->private_data.ptr, buf, n, 0, NULL, NULL);
@@ -321,9 +528,12 @@ static inline ssize_t socket_write(vfs_file_t *filp, const void *buf, size_t n)
 
 static const vfs_file_ops_t socket_ops = {
     .close = socket_close,
-    .fcntl = NULL,          /* TODO: provide when needed */
+    .fcntl = socket_fcntl,
     .fstat = socket_fstat,
     .lseek = socket_lseek,
+#ifdef SOCK_HAS_ASYNC
+    .poll = socket_poll,
+#endif
     .read = socket_read,
     .write = socket_write,
 };
@@ -364,6 +574,7 @@ int socket(int domain, int type, int protocol)
             }
             s->bound = false;
             s->sock = NULL;
+            _socket_init_state(s);
 #ifdef POSIX_SETSOCKOPT
             s->recv_timeout = SOCK_NO_TIMEOUT;
 #endif
@@ -409,9 +620,9 @@ int accept(int socket, struct sockaddr *restrict address,
     }
 
 #ifdef POSIX_SETSOCKOPT
-    const uint32_t recv_timeout = s->recv_timeout;
+    const uint32_t recv_timeout = (s->nonblock) ? 0 : s->recv_timeout;
 #else
-    const uint32_t recv_timeout = SOCK_NO_TIMEOUT;
+    const uint32_t recv_timeout = (s->nonblock) ? 0 : SOCK_NO_TIMEOUT;
 #endif
 
     switch (s->type) {
@@ -430,6 +641,9 @@ int accept(int socket, struct sockaddr *restrict address,
                 break;
             }
             else {
+#ifdef SOCK_HAS_ASYNC
+                _socket_consumed(s, res);
+#endif
                 if ((address != NULL) && (address_len != NULL)) {
                     sock_tcp_ep_t ep;
                     struct sockaddr_storage sa;
@@ -463,6 +677,10 @@ int accept(int socket, struct sockaddr *restrict address,
                 new_s->queue_array_len = 0;
                 new_s->sock = (socket_sock_t *)sock;
                 memset(&s->local, 0, sizeof(sock_tcp_ep_t));
+                _socket_init_state(new_s);
+#ifdef SOCK_HAS_ASYNC
+                sock_tcp_set_cb(sock, _tcp_cb, new_s);
+#endif
             }
             break;
         default:
@@ -595,6 +813,27 @@ static int _bind_connect(socket_t *s, const struct sockaddr *address,
         return -1;
     }
     s->sock = sock;
+#ifdef SOCK_HAS_ASYNC
+    switch (s->type) {
+#ifdef MODULE_SOCK_IP
+        case SOCK_RAW:
+            sock_ip_set_cb(&sock->raw, _ip_cb, s);
+            break;
+#endif
+#ifdef MODULE_SOCK_TCP
+        case SOCK_STREAM:
+            sock_tcp_set_cb(&sock->tcp.sock, _tcp_cb, s);
+            break;
+#endif
+#ifdef MODULE_SOCK_UDP
+        case SOCK_DGRAM:
+            sock_udp_set_cb(&sock->udp, _udp_cb, s);
+            break;
+#endif
+        default:
+            break;
+    }
+#endif
     return 0;
 }
 
@@ -794,6 +1033,9 @@ int listen(int socket, int backlog)
     }
     if (res == 0) {
         s->sock = sock;
+#ifdef SOCK_HAS_ASYNC
+        sock_tcp_queue_set_cb(&sock->tcp.queue, _tcp_queue_cb, s);
+#endif
     }
     else {
         errno = -res;
@@ -836,9 +1078,9 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
     }
 
 #ifdef POSIX_SETSOCKOPT
-    const uint32_t recv_timeout = s->recv_timeout;
+    const uint32_t recv_timeout = (s->nonblock) ? 0 : s->recv_timeout;
 #else
-    const uint32_t recv_timeout = SOCK_NO_TIMEOUT;
+    const uint32_t recv_timeout = (s->nonblock) ? 0 : SOCK_NO_TIMEOUT;
 #endif
 
     switch (s->type) {
@@ -846,18 +1088,34 @@ static ssize_t socket_recvfrom(socket_t *s, void *restrict buffer,
         case SOCK_RAW:
             res = sock_ip_recv(&s->sock->raw, buffer, length, recv_timeout,
                                (sock_ip_ep_t *)&ep);
+#ifdef SOCK_HAS_ASYNC
+            _socket_consumed(s, res);
+#endif
             break;
 #endif
 #ifdef MODULE_SOCK_TCP
         case SOCK_STREAM:
+#ifdef SOCK_HAS_ASYNC
+            /* data received while reading sets the flag again */
+            _socket_set_pending(s, 0);
+#endif
             res = sock_tcp_read(&s->sock->tcp.sock, buffer, length,
                                 recv_timeout);
+#ifdef SOCK_HAS_ASYNC
+            if ((res > 0) && ((size_t)res == length)) {
+                /* more data may be left in the receive buffer */
+                _socket_set_pending(s, 1);
+            }
+#endif
             break;
 #endif
 #ifdef MODULE_SOCK_UDP
         case SOCK_DGRAM:
             res = sock_udp_recv(&s->sock->udp, buffer, length, recv_timeout,
                                 &ep);
+#ifdef SOCK_HAS_ASYNC
+            _socket_consumed(s, res);
+#endif
             break;
 #endif
         default:
@@ -94,6 +94,8 @@ static const char *_netstats_module_to_str(uint8_t module)
             return "Layer 2";
         case NETSTATS_IPV6:
             return "IPv6";
+        case NETSTATS_EXT:
+            return "extended";
         case NETSTATS_ALL:
             return "all";
         default:
@@ -133,6 +135,81 @@ static int _netif_stats(netif_t *iface, unsigned module, bool reset)
 }
 #endif /* MODULE_NETSTATS */
 
+#ifdef MODULE_NETSTATS_EXT
+static const char *_netstats_drop_to_str(unsigned reason)
+{
+    switch (reason) {
+        case NETSTATS_DROP_PKTBUF:
+            return "pktbuf";
+        case NETSTATS_DROP_QUEUE:
+            return "queue";
+        case NETSTATS_DROP_FILTER:
+            return "filter";
+        case NETSTATS_DROP_NO_RECEIVER:
+            return "no receiver";
+        case NETSTATS_DROP_INVALID:
+            return "invalid";
+        default:
+            return "unknown";
+    }
+}
+
+static void _print_u64(const char *label, uint64_t val)
+{
+    char str[21];
+
+    str[fmt_u64_dec(str, val)] = '\0';
+    printf("%s%s", label, str);
+}
+
+static int _netif_stats_ext(netif_t *iface, bool reset)
+{
+    netstats_ext_t *stats;
+    int res = netif_get_opt(iface, NETOPT_STATS, NETSTATS_EXT, &stats,
+                            sizeof(&stats));
+
+    if (res < 0) {
+        puts("           Protocol or device doesn't provide statistics.");
+        return res;
+    }
+    if (reset) {
+        memset(stats, 0, sizeof(netstats_ext_t));
+        printf("Reset statistics for module %s!\n",
+               _netstats_module_to_str(NETSTATS_EXT));
+        return 0;
+    }
+    printf("          Statistics for %s\n",
+           _netstats_module_to_str(NETSTATS_EXT));
+    _print_u64("            RX packets ", stats->rx_count);
+    _print_u64("  bytes ", stats->rx_bytes);
+    _print_u64("\n            TX packets ", stats->tx_count);
+    _print_u64("  bytes ", stats->tx_bytes);
+    _print_u64("  errors ", stats->tx_failed);
+    printf("\n            Dropped");
+    for (unsigned i = 0; i < NETSTATS_DROP_NUMOF; i++) {
+        printf("%s %s ", (i == 0) ? "" : ",", _netstats_drop_to_str(i));
+        _print_u64("", stats->drops[i]);
+    }
+    printf("\n            Queue high-water marks: interface %u  sock %u\n",
+           (unsigned)stats->netif_queue_max, (unsigned)stats->sock_queue_max);
+    puts("            RX to sock latency:");
+    for (unsigned i = 0; i < CONFIG_NETSTATS_EXT_LATENCY_BUCKETS; i++) {
+        if (stats->latency[i] == 0) {
+            continue;
+        }
+        if (i == (CONFIG_NETSTATS_EXT_LATENCY_BUCKETS - 1)) {
+            printf("              >= %10" PRIu32 " us: %" PRIu32 "\n",
+                   (uint32_t)1 << (i - 1), stats->latency[i]);
+        }
+        else {
+            printf("              <  %10" PRIu32 " us: %" PRIu32 "\n",
+                   (uint32_t)1 << i, stats->latency[i]);
+        }
+    }
+    return 0;
+}
+#endif /* MODULE_NETSTATS_EXT */
+
 static void _link_usage(char *cmd_name)
 {
     printf("usage: %s <if_id> [up|down]\n", cmd_name);
@@ -207,7 +284,7 @@ static void _del_usage(char *cmd_name)
 #ifdef MODULE_NETSTATS
 static void _stats_usage(char *cmd_name)
 {
-    printf("usage: %s <if_id> stats [l2|ipv6] [reset]\n", cmd_name);
+    printf("usage: %s <if_id> stats [l2|ipv6|ext] [reset]\n", cmd_name);
     puts("       reset can be only used if the module is specified.");
 }
 #endif
@@ -659,12 +736,17 @@ static void _netif_list(netif_t *iface)
     }
 #endif
 
-#ifdef MODULE_NETSTATS_L2
+#if defined(MODULE_NETSTATS_L2) || defined(MODULE_NETSTATS_EXT)
     puts("");
+#endif
+#ifdef MODULE_NETSTATS_L2
     _netif_stats(iface, NETSTATS_LAYER2, false);
 #endif
 #ifdef MODULE_NETSTATS_IPV6
     _netif_stats(iface, NETSTATS_IPV6, false);
+#endif
+#ifdef MODULE_NETSTATS_EXT
+    _netif_stats_ext(iface, false);
 #endif
     puts("");
 }
@@ -1496,6 +1578,9 @@ int _gnrc_netif_config(int argc, char **argv)
             else if (strcmp(argv[3], "ipv6") == 0) {
                 module = NETSTATS_IPV6;
             }
+            else if (strcmp(argv[3], "ext") == 0) {
+                module = NETSTATS_EXT;
+            }
             else {
                 printf("Module %s doesn't exist or does not provide statistics.\n", argv[3]);
 
@@ -1512,6 +1597,11 @@ int _gnrc_netif_config(int argc, char **argv)
             if (module & NETSTATS_IPV6) {
                 _netif_stats(iface, NETSTATS_IPV6, reset);
             }
+#ifdef MODULE_NETSTATS_EXT
+            if (module & NETSTATS_EXT) {
+                _netif_stats_ext(iface, reset);
+            }
+#endif
 
             return 1;
         }
@@ -23,6 +23,7 @@
  */
 
 #include <inttypes.h>
+#include <string.h>
 #include <nanocbor/nanocbor.h>
 
 #include "kernel_defines.h"
@@ -264,10 +265,16 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
 
     int res = -1;
 
+    manifest->state &= ~SUIT_MANIFEST_HAVE_DIGEST;
+
     if (0) {}
 #ifdef MODULE_SUIT_TRANSPORT_COAP
     else if (strncmp(manifest->urlbuf, "coap://", 7) == 0) {
-        res = suit_coap_get_blockwise_url(manifest->urlbuf, COAP_BLOCKSIZE_64,
+        /* suit_flashwrite_helper() hashes the image while fetching it */
+        sha256_init(&manifest->image_sha256);
+        manifest->state |= SUIT_MANIFEST_HAVE_DIGEST;
+        res = suit_coap_get_blockwise_url(manifest->urlbuf,
+                                          CONFIG_SUIT_COAP_BLOCKSIZE,
                                           suit_flashwrite_helper,
                                           manifest);
     }
@@ -283,6 +290,7 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
     }
 
     if (res) {
+        manifest->state &= ~SUIT_MANIFEST_HAVE_DIGEST;
         LOG_INFO("image download failed\n)");
         return res;
     }
@@ -314,6 +322,20 @@ static int _dtv_verify_image_match(suit_manifest_t *manifest, int key,
      * riotboot_flashwrite_verify_sha256() is only interested in the 32b digest,
      * so shift the pointer accordingly.
      */
+    if (manifest->state & SUIT_MANIFEST_HAVE_DIGEST) {
+        /* the image was hashed while it was fetched and every flash page was
+         * verified after writing it, so there is no need to read the slot */
+        uint8_t image_digest[SHA256_DIGEST_LENGTH];
+
+        manifest->state &= ~SUIT_MANIFEST_HAVE_DIGEST;
+        sha256_final(&manifest->image_sha256, image_digest);
+        if ((manifest->writer->offset != manifest->components[0].size) ||
+            memcmp(digest + 4, image_digest, SHA256_DIGEST_LENGTH)) {
+            return SUIT_ERR_COND;
+        }
+        return SUIT_OK;
+    }
+
     res = riotboot_flashwrite_verify_sha256(digest + 4,
                                             manifest->components[0].size,
                                             target_slot);
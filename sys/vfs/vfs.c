@@ -192,6 +192,21 @@ int vfs_fstat(int fd, struct stat *buf)
     return filp->f_op->fstat(filp, buf);
 }
 
+int vfs_poll(int fd, vfs_poll_waiter_t *waiter)
+{
+    DEBUG_NOT_STDOUT(fd, "vfs_poll: %d, %p\n", fd, (void *)waiter);
+    int res = _fd_is_valid(fd);
+    if (res < 0) {
+        return res;
+    }
+    vfs_file_t *filp = &_vfs_open_files[fd];
+    if (filp->f_op->poll == NULL) {
+        /* driver does not implement poll() */
+        return -ENOTSUP;
+    }
+    return filp->f_op->poll(filp, waiter);
+}
+
 int vfs_fstatvfs(int fd, struct statvfs *buf)
 {
     DEBUG("vfs_fstatvfs: %d, %p\n", fd, (void *)buf);
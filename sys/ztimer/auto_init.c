@@ -160,6 +160,10 @@ void ztimer_init(void)
             CONFIG_ZTIMER_USEC_ADJUST);
     ZTIMER_USEC->adjust = CONFIG_ZTIMER_USEC_ADJUST;
 #  endif
+#  if MODULE_ZTIMER_HEAP && CONFIG_ZTIMER_USEC_HEAP
+    LOG_DEBUG("ztimer_init(): ZTIMER_USEC keeping timers in a heap\n");
+    ZTIMER_USEC->use_heap = true;
+#  endif
 #endif
 
 #ifdef ZTIMER_RTT_INIT
@@ -180,5 +184,9 @@ void ztimer_init(void)
             CONFIG_ZTIMER_MSEC_ADJUST);
     ZTIMER_MSEC->adjust = CONFIG_ZTIMER_MSEC_ADJUST;
 #  endif
+#  if MODULE_ZTIMER_HEAP && CONFIG_ZTIMER_MSEC_HEAP
+    LOG_DEBUG("ztimer_init(): ZTIMER_MSEC keeping timers in a heap\n");
+    ZTIMER_MSEC->use_heap = true;
+#  endif
 #endif
 }
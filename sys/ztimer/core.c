@@ -43,8 +43,69 @@ static inline uint32_t _min_u32(uint32_t a, uint32_t b) {
 }
 #endif
 
+#ifdef MODULE_ZTIMER_HEAP
+static void _heap_insert(ztimer_clock_t *clock, ztimer_base_t *entry);
+static void _heap_remove(ztimer_clock_t *clock, ztimer_base_t *entry);
+static void _heap_expire(ztimer_clock_t *clock, uint32_t diff);
+
+static inline bool _uses_heap(const ztimer_clock_t *clock)
+{
+    return clock->use_heap;
+}
+
+/* Only the root has no prev pointer, every other entry is referenced by its
+ * parent's child or its previous sibling's next pointer. Checking this keeps a
+ * timer with stale pointers (e.g. one on the stack) from being taken for a
+ * heap entry. */
+static inline bool _in_heap(const ztimer_clock_t *clock, const ztimer_base_t *entry)
+{
+    if (!_uses_heap(clock)) {
+        return false;
+    }
+    if (entry == clock->heap) {
+        return true;
+    }
+    return entry->prev && ((entry->prev->child == entry) ||
+                           (entry->prev->next == entry));
+}
+#else
+static inline bool _uses_heap(const ztimer_clock_t *clock)
+{
+    (void)clock;
+    return false;
+}
+#endif
+
+/* returns the timer to trigger next */
+static inline ztimer_base_t *_first(const ztimer_clock_t *clock)
+{
+#ifdef MODULE_ZTIMER_HEAP
+    if (!clock->list.next) {
+        return clock->heap;
+    }
+#endif
+    return clock->list.next;
+}
+
+/* returns the ticks from the list's base time to the next target */
+static inline uint32_t _first_offset(const ztimer_clock_t *clock)
+{
+#ifdef MODULE_ZTIMER_HEAP
+    if (!clock->list.next) {
+        return clock->heap->offset - clock->list.offset;
+    }
+#endif
+    return clock->list.next->offset;
+}
+
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
+#ifdef MODULE_ZTIMER_HEAP
+    if (_uses_heap(clock)) {
+        return (_in_heap(clock, &t->base) || t->base.next ||
+                &t->base == clock->last);
+    }
+#endif
     if (!clock->list.next) {
         return 0;
     } else {
@@ -52,13 +113,24 @@ static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
     }
 }
 
+static void _remove_entry(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+#ifdef MODULE_ZTIMER_HEAP
+    if (_in_heap(clock, entry)) {
+        _heap_remove(clock, entry);
+        return;
+    }
+#endif
+    _del_entry_from_list(clock, entry);
+}
+
 void ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
 {
     unsigned state = irq_disable();
 
     if (_is_set(clock, timer)) {
         ztimer_update_head_offset(clock);
-        _del_entry_from_list(clock, &timer->base);
+        _remove_entry(clock, &timer->base);
 
         _ztimer_update(clock);
     }
@@ -75,7 +147,7 @@ void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
 
     ztimer_update_head_offset(clock);
     if (_is_set(clock, timer)) {
-        _del_entry_from_list(clock, &timer->base);
+        _remove_entry(clock, &timer->base);
     }
 
     /* optionally subtract a configurable adjustment value */
@@ -86,8 +158,16 @@ void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     }
 
     timer->base.offset = val;
-    _add_entry_to_list(clock, &timer->base);
-    if (clock->list.next == &timer->base) {
+#ifdef MODULE_ZTIMER_HEAP
+    if (_uses_heap(clock) && val) {
+        _heap_insert(clock, &timer->base);
+    }
+    else
+#endif
+    {
+        _add_entry_to_list(clock, &timer->base);
+    }
+    if (_first(clock) == &timer->base) {
 #ifdef MODULE_ZTIMER_EXTEND
         if (clock->max_value < UINT32_MAX) {
             val = _min_u32(val, clock->max_value >> 1);
@@ -117,6 +197,10 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
     }
 
     /* Insert into list */
+#ifdef MODULE_ZTIMER_HEAP
+    /* the heap pointers must not hold stale values while on the list */
+    entry->prev = entry->child = NULL;
+#endif
     entry->next = list->next;
     entry->offset -= delta_sum;
     if (entry->next) {
@@ -162,6 +246,16 @@ void ztimer_update_head_offset(ztimer_clock_t *clock)
     uint32_t now = ztimer_now(clock);
     uint32_t diff = now - old_base;
 
+#ifdef MODULE_ZTIMER_HEAP
+    if (_uses_heap(clock)) {
+        /* the list only holds expired timers, so just move the newly expired
+         * ones over from the heap */
+        _heap_expire(clock, diff);
+        clock->list.offset = now;
+        return;
+    }
+#endif
+
     ztimer_base_t *entry = clock->list.next;
     DEBUG("clock %p: ztimer_update_head_offset(): diff=%" PRIu32 " old head %p\n",
         (void *)clock, diff, (void *)entry);
@@ -234,6 +328,10 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
         if (!entry->next) {
             clock->last = NULL;
         }
+        if (_uses_heap(clock)) {
+            /* _is_set() can not rely on the list being empty */
+            entry->next = NULL;
+        }
         return (ztimer_t*)entry;
     }
     else {
@@ -245,8 +343,8 @@ static void _ztimer_update(ztimer_clock_t *clock)
 {
 #ifdef MODULE_ZTIMER_EXTEND
     if (clock->max_value < UINT32_MAX) {
-        if (clock->list.next) {
-            clock->ops->set(clock, _min_u32(clock->list.next->offset, clock->max_value >> 1));
+        if (_first(clock)) {
+            clock->ops->set(clock, _min_u32(_first_offset(clock), clock->max_value >> 1));
         }
         else {
             clock->ops->set(clock, clock->max_value >> 1);
@@ -256,8 +354,8 @@ static void _ztimer_update(ztimer_clock_t *clock)
 #endif
     }
     else {
-        if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+        if (_first(clock)) {
+            clock->ops->set(clock, _first_offset(clock));
         }
         else {
             clock->ops->cancel(clock);
@@ -277,8 +375,8 @@ void ztimer_handler(ztimer_clock_t *clock)
         /* calling now triggers checkpointing */
         uint32_t now = ztimer_now(clock);
 
-        if (clock->list.next) {
-            uint32_t target = clock->list.offset + clock->list.next->offset;
+        if (_first(clock)) {
+            uint32_t target = clock->list.offset + _first_offset(clock);
             int32_t diff = (int32_t)(target - now);
             if (diff > 0) {
                 DEBUG("ztimer_handler(): %p postponing by %"PRIi32"\n", (void *)clock, diff);
@@ -300,8 +398,19 @@ void ztimer_handler(ztimer_clock_t *clock)
     }
 #endif
 
-    clock->list.offset += clock->list.next->offset;
-    clock->list.next->offset = 0;
+#ifdef MODULE_ZTIMER_HEAP
+    if (_uses_heap(clock) && !clock->list.next) {
+        uint32_t diff = _first_offset(clock);
+
+        _heap_expire(clock, diff);
+        clock->list.offset += diff;
+    }
+    else
+#endif
+    {
+        clock->list.offset += clock->list.next->offset;
+        clock->list.next->offset = 0;
+    }
 
     ztimer_t *entry = _now_next(clock);
     while (entry) {
@@ -339,4 +448,132 @@ static void _ztimer_print(const ztimer_clock_t *clock)
 
     } while ((entry = entry->next));
     puts("");
+#ifdef MODULE_ZTIMER_HEAP
+    if (clock->heap) {
+        printf("heap: 0x%08x:%" PRIu32 "\n", (unsigned)clock->heap,
+               clock->heap->offset);
+    }
+#endif
+}
+
+#ifdef MODULE_ZTIMER_HEAP
+/*
+ * Timers that are not yet expired are kept in a pairing heap, ordered by their
+ * absolute target time stored in `offset`. All targets lie within the 2^32
+ * ticks following the list's base time (clock->list.offset), so comparing
+ * them relative to the base time is safe against overflows.
+ * Siblings are chained using `next`, `prev` points to the previous sibling or,
+ * for the first child, to the parent.
+ */
+static inline bool _heap_before(const ztimer_clock_t *clock,
+                                const ztimer_base_t *a, const ztimer_base_t *b)
+{
+    return (a->offset - clock->list.offset) < (b->offset - clock->list.offset);
+}
+
+static ztimer_base_t *_heap_meld(const ztimer_clock_t *clock,
+                                 ztimer_base_t *a, ztimer_base_t *b)
+{
+    if (!a) {
+        return b;
+    }
+    if (!b) {
+        return a;
+    }
+    if (_heap_before(clock, b, a)) {
+        ztimer_base_t *tmp = a;
+        a = b;
+        b = tmp;
+    }
+    b->prev = a;
+    b->next = a->child;
+    if (a->child) {
+        a->child->prev = b;
+    }
+    a->child = b;
+    return a;
+}
+
+/* melds a list of siblings into one heap using the two-pass method */
+static ztimer_base_t *_heap_merge_pairs(const ztimer_clock_t *clock,
+                                        ztimer_base_t *first)
+{
+    ztimer_base_t *pairs = NULL;
+    ztimer_base_t *root = NULL;
+
+    /* meld pairs from left to right, collecting them in reverse order */
+    while (first) {
+        ztimer_base_t *a = first;
+        ztimer_base_t *b = a->next;
+
+        first = b ? b->next : NULL;
+        a->next = a->prev = NULL;
+        if (b) {
+            b->next = b->prev = NULL;
+        }
+        a = _heap_meld(clock, a, b);
+        a->next = pairs;
+        pairs = a;
+    }
+    /* meld the pairs from right to left */
+    while (pairs) {
+        ztimer_base_t *next = pairs->next;
+
+        pairs->next = NULL;
+        root = _heap_meld(clock, root, pairs);
+        pairs = next;
+    }
+    return root;
+}
+
+static void _heap_insert(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    /* make offset the absolute target */
+    entry->offset += clock->list.offset;
+    entry->next = entry->prev = entry->child = NULL;
+    clock->heap = _heap_meld(clock, clock->heap, entry);
+}
+
+static void _heap_remove(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_base_t *sub = _heap_merge_pairs(clock, entry->child);
+
+    if (entry == clock->heap) {
+        clock->heap = sub;
+    }
+    else {
+        if (entry->prev->child == entry) {
+            entry->prev->child = entry->next;
+        }
+        else {
+            entry->prev->next = entry->next;
+        }
+        if (entry->next) {
+            entry->next->prev = entry->prev;
+        }
+        clock->heap = _heap_meld(clock, clock->heap, sub);
+    }
+    /* reset the entry's pointers so _is_set() considers it unset */
+    entry->next = entry->prev = entry->child = NULL;
+}
+
+/* moves timers expiring within diff ticks from the base time to the list */
+static void _heap_expire(ztimer_clock_t *clock, uint32_t diff)
+{
+    while (clock->heap &&
+           ((clock->heap->offset - clock->list.offset) <= diff)) {
+        ztimer_base_t *entry = clock->heap;
+
+        /* clears the entry's heap pointers */
+        _heap_remove(clock, entry);
+        entry->offset = 0;
+        if (clock->last) {
+            clock->last->next = entry;
+        }
+        else {
+            clock->list.next = entry;
+        }
+        clock->last = entry;
+    }
 }
+#endif /* MODULE_ZTIMER_HEAP */
@@ -99,7 +99,7 @@ int ztimer_msg_receive_timeout(ztimer_clock_t *clock, msg_t *msg, uint32_t timeo
         return 1;
     }
 
-    ztimer_t t;
+    ztimer_t t = { 0 };
     msg_t m = { .type=MSG_ZTIMER, .content.ptr=&m };
 
     ztimer_set_msg(clock, &t, timeout, &m, sched_active_pid);
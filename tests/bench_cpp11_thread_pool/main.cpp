@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief Compares the latency of running a task on a new riot::thread and
+ *        on a riot::thread_pool
+ *
+ * @}
+ */
+
+#include <cstdio>
+
+#include "benchmark.h"
+#include "xtimer.h"
+
+#include "riot/thread.hpp"
+#include "riot/thread_pool.hpp"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
+#endif
+
+#ifndef BENCH_WORKERS
+#define BENCH_WORKERS       (2U)
+#endif
+
+using namespace riot;
+
+static unsigned _task(unsigned i) {
+  return i + 1;
+}
+
+int main() {
+  puts("riot::thread vs. riot::thread_pool task latency\n");
+
+  {
+    uint32_t time = xtimer_now_usec();
+    for (unsigned long i = 0; i < BENCH_RUNS; i++) {
+      thread t(_task, i);
+      t.join();
+    }
+    time = xtimer_now_usec() - time;
+    benchmark_print_time(time, BENCH_RUNS, "riot::thread");
+  }
+
+  {
+    thread_pool pool(BENCH_WORKERS);
+    uint32_t time = xtimer_now_usec();
+    for (unsigned long i = 0; i < BENCH_RUNS; i++) {
+      pool.submit(_task, i).get();
+    }
+    time = xtimer_now_usec() - time;
+    benchmark_print_time(time, BENCH_RUNS, "riot::thread_pool");
+  }
+
+  puts("[SUCCESS]");
+
+  return 0;
+}
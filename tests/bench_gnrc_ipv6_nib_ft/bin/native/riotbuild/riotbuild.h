@@ -0,0 +1,76 @@
+/* Generated file do not edit */
+#define TABLE_SIZE_MAX 512
+#define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF 512
+#define CONFIG_GNRC_IPV6_NIB_OFFL_INDEX 1
+#define CONFIG_GNRC_IPV6_NIB_OFFL_INDEX_BUCKETS 512
+#define DEVELHELP 1
+#define DEBUG_ASSERT_VERBOSE 1
+#define RIOT_APPLICATION "tests_bench_gnrc_ipv6_nib_ft"
+#define BOARD_NATIVE "native"
+#define RIOT_BOARD BOARD_NATIVE
+#define CPU_NATIVE "native"
+#define RIOT_CPU CPU_NATIVE
+#define MCU_NATIVE "native"
+#define RIOT_MCU MCU_NATIVE
+#define RIOT_VERSION "5711"
+#define MODULE_AUTO_INIT 1
+#define MODULE_AUTO_INIT_GNRC_IPV6 1
+#define MODULE_AUTO_INIT_GNRC_IPV6_NIB 1
+#define MODULE_AUTO_INIT_GNRC_PKTBUF 1
+#define MODULE_AUTO_INIT_RANDOM 1
+#define MODULE_AUTO_INIT_XTIMER 1
+#define MODULE_BOARD 1
+#define MODULE_CORE 1
+#define MODULE_CORE_INIT 1
+#define MODULE_CORE_MSG 1
+#define MODULE_CORE_PANIC 1
+#define MODULE_CPU 1
+#define MODULE_DIV 1
+#define MODULE_EVTIMER 1
+#define MODULE_FMT 1
+#define MODULE_GNRC 1
+#define MODULE_GNRC_ICMPV6 1
+#define MODULE_GNRC_IPV6 1
+#define MODULE_GNRC_IPV6_HDR 1
+#define MODULE_GNRC_IPV6_NIB 1
+#define MODULE_GNRC_IPV6_NIB_ROUTER 1
+#define MODULE_GNRC_NDP 1
+#define MODULE_GNRC_NETAPI 1
+#define MODULE_GNRC_NETIF 1
+#define MODULE_GNRC_NETIF_HDR 1
+#define MODULE_GNRC_NETREG 1
+#define MODULE_GNRC_PKT 1
+#define MODULE_GNRC_PKTBUF 1
+#define MODULE_GNRC_PKTBUF_STATIC 1
+#define MODULE_ICMPV6 1
+#define MODULE_INET_CSUM 1
+#define MODULE_IPV6_ADDR 1
+#define MODULE_IPV6_HDR 1
+#define MODULE_L2UTIL 1
+#define MODULE_LUID 1
+#define MODULE_NATIVE_DRIVERS 1
+#define MODULE_NETIF 1
+#define MODULE_PERIPH 1
+#define MODULE_PERIPH_COMMON 1
+#define MODULE_PERIPH_CPUID 1
+#define MODULE_PERIPH_GPIO 1
+#define MODULE_PERIPH_HWRNG 1
+#define MODULE_PERIPH_INIT 1
+#define MODULE_PERIPH_INIT_CPUID 1
+#define MODULE_PERIPH_INIT_GPIO 1
+#define MODULE_PERIPH_INIT_HWRNG 1
+#define MODULE_PERIPH_INIT_PM 1
+#define MODULE_PERIPH_INIT_TIMER 1
+#define MODULE_PERIPH_INIT_UART 1
+#define MODULE_PERIPH_PM 1
+#define MODULE_PERIPH_TIMER 1
+#define MODULE_PERIPH_UART 1
+#define MODULE_PRNG 1
+#define MODULE_PRNG_TINYMT32 1
+#define MODULE_RANDOM 1
+#define MODULE_STDIN 1
+#define MODULE_STDIO_NATIVE 1
+#define MODULE_SYS 1
+#define MODULE_TEST_UTILS_INTERACTIVE_SYNC 1
+#define MODULE_TINYMT32 1
+#define MODULE_XTIMER 1
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure forwarding table lookups per second against table size
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (1000000U)
+#endif
+
+#ifndef TABLE_SIZE_MAX
+#define TABLE_SIZE_MAX      (512U)
+#endif
+
+#define IFACE               (6U)
+#define DST_NUMOF           (64U)
+
+static const ipv6_addr_t _next_hop = { {
+                0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+            } };
+static const uint8_t _pfx_lens[] = { 32, 48, 56, 64, 64, 64, 96, 128 };
+static ipv6_addr_t _routes[TABLE_SIZE_MAX];
+static ipv6_addr_t _dsts[DST_NUMOF];
+static volatile unsigned _flag = 0;
+
+static void _timer_callback(void *arg)
+{
+    (void)arg;
+
+    _flag = 1;
+}
+
+static void _random_addr(ipv6_addr_t *addr)
+{
+    random_bytes(addr->u8, sizeof(addr->u8));
+    /* keep addresses global unicast */
+    addr->u8[0] = 0x20;
+    addr->u8[1] = 0x01;
+}
+
+int main(void)
+{
+    xtimer_t timer = { .callback = _timer_callback };
+    unsigned size = 0;
+
+    random_init(0x6c10ca1);
+    for (unsigned step = 8; step <= TABLE_SIZE_MAX; step *= 2) {
+        gnrc_ipv6_nib_ft_t fte;
+        uint32_t n = 0;
+
+        for (; size < step; size++) {
+            unsigned pfx_len = _pfx_lens[size % sizeof(_pfx_lens)];
+
+            _random_addr(&_routes[size]);
+            if (gnrc_ipv6_nib_ft_add(&_routes[size], pfx_len, &_next_hop,
+                                     IFACE, 0) < 0) {
+                puts("Unable to add route");
+                return 1;
+            }
+        }
+        /* look up destinations spread over all installed routes */
+        for (unsigned i = 0; i < DST_NUMOF; i++) {
+            unsigned route = random_uint32_range(0, size);
+
+            _random_addr(&_dsts[i]);
+            ipv6_addr_init_prefix(&_dsts[i], &_routes[route],
+                                  _pfx_lens[route % sizeof(_pfx_lens)]);
+        }
+        _flag = 0;
+        xtimer_set(&timer, TEST_DURATION);
+        while (!_flag) {
+            if (gnrc_ipv6_nib_ft_get(&_dsts[n % DST_NUMOF], NULL, &fte) < 0) {
+                puts("Lookup failed");
+                return 1;
+            }
+            n++;
+        }
+        printf("{ \"size\" : %u, \"lookups\" : %" PRIu32 " }\n", size, n);
+    }
+    puts("SUCCESS");
+
+    return 0;
+}
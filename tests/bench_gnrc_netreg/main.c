@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for dispatching packets with many netreg entries
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "test_utils/expect.h"
+
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef REGISTRATIONS
+#define REGISTRATIONS   (1000U)
+#endif
+
+#ifndef DISPATCHES
+#define DISPATCHES      (100000UL)
+#endif
+
+/* no protocol module is used, so register for the one type that always exists;
+ * the registry treats all types the same */
+#define BENCH_NETTYPE   (GNRC_NETTYPE_UNDEF)
+
+/* first port to register */
+#define PORT_BASE       (1024U)
+
+static gnrc_netreg_entry_t _entries[REGISTRATIONS];
+static unsigned _received;
+
+static void _cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)cmd;
+    (void)pkt;
+    (void)ctx;
+    _received++;
+}
+
+static gnrc_netreg_entry_cbd_t _cbd = { .cb = _cb };
+
+static void _print_result(const char *desc, uint32_t usec)
+{
+    printf("%25s: %8" PRIu32 " ns / dispatch\n", desc,
+           (uint32_t)(((uint64_t)usec * 1000) / DISPATCHES));
+}
+
+int main(void)
+{
+    gnrc_pktsnip_t *pkt;
+    uint32_t before, diff;
+
+    puts("netreg dispatch benchmark application.\n");
+
+    for (unsigned i = 0; i < REGISTRATIONS; i++) {
+        gnrc_netreg_entry_init_cb(&_entries[i], PORT_BASE + i, &_cbd);
+        expect(gnrc_netreg_register(BENCH_NETTYPE, &_entries[i]) == 0);
+    }
+    /* the packet is only looked at by the callback, so one suffices */
+    pkt = gnrc_pktbuf_add(NULL, NULL, 8, BENCH_NETTYPE);
+    expect(pkt != NULL);
+    random_init(0x7e91d);
+
+    before = xtimer_now_usec();
+    for (unsigned long i = 0; i < DISPATCHES; i++) {
+        uint32_t port = PORT_BASE + random_uint32_range(0, REGISTRATIONS);
+
+        gnrc_netapi_dispatch_receive(BENCH_NETTYPE, port, pkt);
+    }
+    diff = xtimer_now_usec() - before;
+    _print_result("random registered port", diff);
+    expect(_received == DISPATCHES);
+
+    before = xtimer_now_usec();
+    for (unsigned long i = 0; i < DISPATCHES; i++) {
+        gnrc_netapi_dispatch_receive(BENCH_NETTYPE, PORT_BASE - 1, pkt);
+    }
+    diff = xtimer_now_usec() - before;
+    _print_result("unregistered port", diff);
+    expect(_received == DISPATCHES);
+
+    gnrc_pktbuf_release(pkt);
+    puts("done.");
+
+    return 0;
+}
@@ -0,0 +1,51 @@
+/* Generated file do not edit */
+#define DEVELHELP 1
+#define DEBUG_ASSERT_VERBOSE 1
+#define RIOT_APPLICATION "tests_bench_gnrc_pktbuf"
+#define BOARD_NATIVE "native"
+#define RIOT_BOARD BOARD_NATIVE
+#define CPU_NATIVE "native"
+#define RIOT_CPU CPU_NATIVE
+#define MCU_NATIVE "native"
+#define RIOT_MCU MCU_NATIVE
+#define RIOT_VERSION "5711"
+#define MODULE_AUTO_INIT 1
+#define MODULE_AUTO_INIT_GNRC_PKTBUF 1
+#define MODULE_AUTO_INIT_RANDOM 1
+#define MODULE_AUTO_INIT_XTIMER 1
+#define MODULE_BOARD 1
+#define MODULE_CORE 1
+#define MODULE_CORE_INIT 1
+#define MODULE_CORE_MSG 1
+#define MODULE_CORE_PANIC 1
+#define MODULE_CPU 1
+#define MODULE_DIV 1
+#define MODULE_GNRC_PKT 1
+#define MODULE_GNRC_PKTBUF 1
+#define MODULE_GNRC_PKTBUF_STATIC 1
+#define MODULE_LUID 1
+#define MODULE_NATIVE_DRIVERS 1
+#define MODULE_PERIPH 1
+#define MODULE_PERIPH_COMMON 1
+#define MODULE_PERIPH_CPUID 1
+#define MODULE_PERIPH_GPIO 1
+#define MODULE_PERIPH_HWRNG 1
+#define MODULE_PERIPH_INIT 1
+#define MODULE_PERIPH_INIT_CPUID 1
+#define MODULE_PERIPH_INIT_GPIO 1
+#define MODULE_PERIPH_INIT_HWRNG 1
+#define MODULE_PERIPH_INIT_PM 1
+#define MODULE_PERIPH_INIT_TIMER 1
+#define MODULE_PERIPH_INIT_UART 1
+#define MODULE_PERIPH_PM 1
+#define MODULE_PERIPH_TIMER 1
+#define MODULE_PERIPH_UART 1
+#define MODULE_PRNG 1
+#define MODULE_PRNG_TINYMT32 1
+#define MODULE_RANDOM 1
+#define MODULE_STDIN 1
+#define MODULE_STDIO_NATIVE 1
+#define MODULE_SYS 1
+#define MODULE_TEST_UTILS_INTERACTIVE_SYNC 1
+#define MODULE_TINYMT32 1
+#define MODULE_XTIMER 1
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Stress test and benchmark for the packet buffer backends
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/gnrc/pktbuf.h"
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef TEST_OPS
+#define TEST_OPS            (1000000UL)
+#endif
+
+/* maximum number of packets held at the same time */
+#define SLOTS_NUMOF         (12U)
+
+#if defined(MODULE_GNRC_PKTBUF_STATIC)
+#define BACKEND             "static"
+#elif defined(MODULE_GNRC_PKTBUF_MALLOC)
+#define BACKEND             "malloc"
+#elif defined(MODULE_GNRC_PKTBUF_SLAB)
+#define BACKEND             "slab"
+#else
+#define BACKEND             "unknown"
+#endif
+
+static gnrc_pktsnip_t *_slots[SLOTS_NUMOF];
+
+/* sizes as seen in a network stack: mostly headers and small payloads, some
+ * full frames */
+static size_t _random_size(void)
+{
+    uint32_t r = random_uint32_range(0, 100);
+
+    if (r < 60) {
+        return random_uint32_range(1, 65);
+    }
+    else if (r < 90) {
+        return random_uint32_range(65, 257);
+    }
+    return random_uint32_range(257, 1281);
+}
+
+static int _op(gnrc_pktsnip_t **slot)
+{
+    gnrc_pktsnip_t *pkt = *slot;
+
+    if (pkt == NULL) {
+        *slot = gnrc_pktbuf_add(NULL, NULL, _random_size(), GNRC_NETTYPE_UNDEF);
+        return (*slot == NULL) ? -1 : 0;
+    }
+    switch (random_uint32_range(0, 4)) {
+        case 0:
+            /* parse a header, as a protocol layer does on reception */
+            if (pkt->size > 8) {
+                return (gnrc_pktbuf_mark(pkt, random_uint32_range(1, 9),
+                                         GNRC_NETTYPE_UNDEF) == NULL) ? -1 : 0;
+            }
+            return 0;
+        case 1:
+            /* prepend a header, as a protocol layer does on sending */
+            pkt = gnrc_pktbuf_add(pkt, NULL, random_uint32_range(1, 41),
+                                  GNRC_NETTYPE_UNDEF);
+            if (pkt == NULL) {
+                return -1;
+            }
+            *slot = pkt;
+            return 0;
+        case 2:
+            return (gnrc_pktbuf_realloc_data(pkt, _random_size()) != 0) ? -1 : 0;
+        default:
+            gnrc_pktbuf_release(pkt);
+            *slot = NULL;
+            return 0;
+    }
+}
+
+int main(void)
+{
+    gnrc_pktsnip_t *pkt;
+    uint32_t failed = 0;
+    uint32_t start;
+
+    random_init(0x9c7b0f);
+    start = xtimer_now_usec();
+    for (unsigned long i = 0; i < TEST_OPS; i++) {
+        if (_op(&_slots[random_uint32_range(0, SLOTS_NUMOF)]) < 0) {
+            failed++;
+        }
+    }
+    for (unsigned i = 0; i < SLOTS_NUMOF; i++) {
+        if (_slots[i] != NULL) {
+            gnrc_pktbuf_release(_slots[i]);
+        }
+    }
+    printf("{ \"backend\" : \"%s\", \"ops\" : %lu, \"failed\" : %" PRIu32
+           ", \"time\" : %" PRIu32 " }\n", BACKEND, TEST_OPS, failed,
+           xtimer_now_usec() - start);
+    /* with everything released a large packet must fit again */
+    pkt = gnrc_pktbuf_add(NULL, NULL, GNRC_PKTBUF_SIZE / 2, GNRC_NETTYPE_UNDEF);
+    if (pkt == NULL) {
+        puts("Packet buffer leaked");
+        return 1;
+    }
+    gnrc_pktbuf_release(pkt);
+    puts("SUCCESS");
+
+    return 0;
+}
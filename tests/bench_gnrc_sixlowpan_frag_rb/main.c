@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for reassembling fragments of many sources at once
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test_utils/expect.h"
+
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/frag/rb.h"
+#include "net/ipv6.h"
+#include "net/sixlowpan.h"
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef SOURCES
+#define SOURCES             (64U)
+#endif
+
+#ifndef DATAGRAMS
+#define DATAGRAMS           (200U)      /**< datagrams per source */
+#endif
+
+#ifndef LOOKUPS
+#define LOOKUPS             (100000UL)
+#endif
+
+#define DATAGRAM_SIZE       (IPV6_MIN_MTU)
+/* datagram payload of a fragment, as with an IEEE 802.15.4 frame */
+#define FRAG_PAYLOAD_SIZE   (104U)
+#define FRAGMENTS           ((DATAGRAM_SIZE + FRAG_PAYLOAD_SIZE - 1) / \
+                             FRAG_PAYLOAD_SIZE)
+#define L2ADDR_LEN          (8U)
+
+static struct {
+    gnrc_netif_hdr_t hdr;
+    uint8_t src[L2ADDR_LEN];
+    uint8_t dst[L2ADDR_LEN];
+} _netif_hdr;
+
+/* fragment currently sent by a source */
+static uint8_t _next_frag[SOURCES];
+/* datagram tag currently used by a source */
+static uint16_t _tag[SOURCES];
+static uint16_t _order[SOURCES];
+static uint8_t _frag_buf[sizeof(sixlowpan_frag_n_t) + FRAG_PAYLOAD_SIZE];
+static unsigned _received;
+
+static void _cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)cmd;
+    (void)ctx;
+    _received++;
+    gnrc_pktbuf_release(pkt);
+}
+
+static gnrc_netreg_entry_cbd_t _cbd = { .cb = _cb };
+
+static void _set_src(unsigned source)
+{
+    _netif_hdr.src[L2ADDR_LEN - 2] = source >> 8;
+    _netif_hdr.src[L2ADDR_LEN - 1] = source & 0xff;
+}
+
+/* sends the next fragment of source into the reassembly buffer */
+static void _send_fragment(unsigned source)
+{
+    unsigned frag = _next_frag[source];
+    size_t offset = frag * FRAG_PAYLOAD_SIZE;
+    size_t size = DATAGRAM_SIZE - offset;
+    sixlowpan_frag_n_t *hdr = (sixlowpan_frag_n_t *)_frag_buf;
+    gnrc_sixlowpan_frag_rb_t *rbuf;
+    gnrc_pktsnip_t *pkt;
+    uint8_t *payload;
+
+    if (size > FRAG_PAYLOAD_SIZE) {
+        size = FRAG_PAYLOAD_SIZE;
+    }
+    hdr->disp_size = byteorder_htons(DATAGRAM_SIZE);
+    hdr->tag = byteorder_htons(_tag[source]);
+    if (frag == 0) {
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+        payload = _frag_buf + sizeof(sixlowpan_frag_t);
+        /* datagram is not compressed */
+        *(payload++) = SIXLOWPAN_UNCOMP;
+    }
+    else {
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+        hdr->offset = offset / 8;
+        payload = _frag_buf + sizeof(sixlowpan_frag_n_t);
+    }
+    memset(payload, source, size);
+    pkt = gnrc_pktbuf_add(NULL, _frag_buf, (payload - _frag_buf) + size,
+                          GNRC_NETTYPE_SIXLOWPAN);
+    expect(pkt != NULL);
+    _set_src(source);
+    rbuf = gnrc_sixlowpan_frag_rb_add(&_netif_hdr.hdr, pkt, offset, 0);
+    expect(rbuf != NULL);
+    gnrc_sixlowpan_frag_rb_dispatch_when_complete(rbuf, &_netif_hdr.hdr);
+    if (++_next_frag[source] == FRAGMENTS) {
+        _next_frag[source] = 0;
+        _tag[source]++;
+    }
+}
+
+static void _print_result(const char *desc, uint32_t usec, unsigned long num,
+                          const char *unit)
+{
+    printf("%25s: %8" PRIu32 " ns / %s\n", desc,
+           (uint32_t)(((uint64_t)usec * 1000) / num), unit);
+}
+
+int main(void)
+{
+    gnrc_netreg_entry_t reg;
+    uint32_t before, diff;
+
+    puts("6LoWPAN reassembly buffer benchmark application.\n");
+
+    /* GNRC modules are not initialized automatically */
+    gnrc_pktbuf_init();
+    gnrc_netreg_entry_init_cb(&reg, GNRC_NETREG_DEMUX_CTX_ALL, &_cbd);
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &reg);
+    gnrc_netif_hdr_init(&_netif_hdr.hdr, L2ADDR_LEN, L2ADDR_LEN);
+    memset(_netif_hdr.src, 0x02, L2ADDR_LEN);
+    memset(_netif_hdr.dst, 0xfe, L2ADDR_LEN);
+    random_init(0x6a3e1);
+    for (unsigned i = 0; i < SOURCES; i++) {
+        _tag[i] = random_uint32();
+        _order[i] = i;
+    }
+
+    /* all sources send their datagrams at the same time, so fragments of
+     * different datagrams arrive interleaved in varying order */
+    before = xtimer_now_usec();
+    for (unsigned i = 0; i < (DATAGRAMS * FRAGMENTS); i++) {
+        for (unsigned j = SOURCES - 1; j > 0; j--) {
+            unsigned k = random_uint32_range(0, j + 1);
+            uint16_t tmp = _order[j];
+
+            _order[j] = _order[k];
+            _order[k] = tmp;
+        }
+        for (unsigned j = 0; j < SOURCES; j++) {
+            _send_fragment(_order[j]);
+        }
+    }
+    diff = xtimer_now_usec() - before;
+    _print_result("interleaved fragments", diff,
+                  (unsigned long)DATAGRAMS * FRAGMENTS * SOURCES, "fragment");
+    expect(_received == (DATAGRAMS * SOURCES));
+
+    /* let every source start a datagram to look up a full reassembly
+     * buffer */
+    for (unsigned i = 0; i < SOURCES; i++) {
+        _send_fragment(i);
+    }
+    before = xtimer_now_usec();
+    for (unsigned long i = 0; i < LOOKUPS; i++) {
+        unsigned source = random_uint32_range(0, SOURCES);
+
+        _set_src(source);
+        expect(gnrc_sixlowpan_frag_rb_exists(&_netif_hdr.hdr, _tag[source]));
+    }
+    diff = xtimer_now_usec() - before;
+    _print_result("datagram lookup", diff, LOOKUPS, "lookup");
+
+    puts("done.");
+
+    return 0;
+}
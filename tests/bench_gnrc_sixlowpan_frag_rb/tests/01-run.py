@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2020 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("6LoWPAN reassembly buffer benchmark application.\r\n")
+    child.expect(r"\s+interleaved fragments: \s*\d+ ns / fragment\r\n")
+    child.expect(r"\s+datagram lookup: \s*\d+ ns / lookup\r\n")
+    child.expect_exact("done.\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
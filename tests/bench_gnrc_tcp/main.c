@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC TCP bulk transfer throughput benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "net/af.h"
+#include "net/gnrc/tcp.h"
+#include "net/ipv6/addr.h"
+#include "shell.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define MAIN_QUEUE_SIZE     (8)
+#define BUF_SIZE            (4096U)
+/* gnrc_tcp_send() returns when all data was acknowledged, so pass large
+ * chunks to keep the segments of one call in flight */
+#define CHUNK_SIZE          (65536U)
+#define RECV_TIMEOUT        (10U * US_PER_SEC)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static char _server_stack[THREAD_STACKSIZE_MAIN];
+static gnrc_tcp_tcb_queue_t _queue;
+static gnrc_tcp_tcb_t _server_tcb;
+static gnrc_tcp_tcb_t _client_tcb;
+static uint8_t _server_buf[BUF_SIZE];
+static uint8_t _client_buf[CHUNK_SIZE];
+
+static void *_server_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        gnrc_tcp_tcb_t *tcb;
+        uint32_t received = 0;
+        ssize_t res;
+
+        if (gnrc_tcp_accept(&_queue, &tcb, GNRC_TCP_NO_TIMEOUT) < 0) {
+            continue;
+        }
+        while ((res = gnrc_tcp_recv(tcb, _server_buf, sizeof(_server_buf),
+                                    RECV_TIMEOUT)) > 0) {
+            received += res;
+        }
+        printf("server: received %" PRIu32 " bytes (%d)\n", received, (int)res);
+        gnrc_tcp_close(tcb);
+    }
+
+    return NULL;
+}
+
+static int _server_cmd(int argc, char **argv)
+{
+    gnrc_tcp_ep_t local;
+    int res;
+
+    if (argc < 2) {
+        printf("usage: %s <port>\n", argv[0]);
+        return 1;
+    }
+    gnrc_tcp_ep_init(&local, AF_INET6, ipv6_addr_unspecified.u8,
+                     sizeof(ipv6_addr_t), atoi(argv[1]), 0);
+    if ((res = gnrc_tcp_listen(&_queue, &_server_tcb, 1, &local)) < 0) {
+        printf("server: unable to listen (%d)\n", res);
+        return 1;
+    }
+    thread_create(_server_stack, sizeof(_server_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _server_thread, NULL, "server");
+    printf("server: listening on port %s\n", argv[1]);
+    return 0;
+}
+
+static int _client_cmd(int argc, char **argv)
+{
+    gnrc_tcp_ep_t remote;
+    uint32_t len, sent = 0, start, duration;
+    int res = 0;
+
+    if (argc < 3) {
+        printf("usage: %s <[addr]:port> <bytes>\n", argv[0]);
+        return 1;
+    }
+    if (gnrc_tcp_ep_from_str(&remote, argv[1]) < 0) {
+        printf("client: unable to parse %s\n", argv[1]);
+        return 1;
+    }
+    len = strtoul(argv[2], NULL, 10);
+
+    gnrc_tcp_tcb_init(&_client_tcb);
+    if ((res = gnrc_tcp_open_active(&_client_tcb, &remote, 0)) < 0) {
+        printf("client: unable to connect (%d)\n", res);
+        return 1;
+    }
+    start = xtimer_now_usec();
+    while (sent < len) {
+        size_t chunk = (len - sent < CHUNK_SIZE) ? len - sent : CHUNK_SIZE;
+
+        if ((res = gnrc_tcp_send(&_client_tcb, _client_buf, chunk, 0)) < 0) {
+            break;
+        }
+        sent += res;
+    }
+    duration = xtimer_now_usec() - start;
+
+    if (res < 0) {
+        printf("client: send failed after %" PRIu32 " bytes (%d)\n", sent, res);
+    }
+    else {
+        printf("client: sent %" PRIu32 " bytes in %" PRIu32 " us\n", sent, duration);
+        printf("{ \"result\" : %" PRIu32 " }\n",
+               (uint32_t)(((uint64_t)sent * US_PER_SEC) / (duration ? duration : 1)));
+    }
+    /* returns after TIME-WAIT, i.e. 2 * GNRC_TCP_MSL */
+    gnrc_tcp_close(&_client_tcb);
+    return (res < 0) ? 1 : 0;
+}
+
+static const shell_command_t _commands[] = {
+    { "server", "start a server discarding received data", _server_cmd },
+    { "client", "send data to a server and print bytes per second", _client_cmd },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    puts("GNRC TCP throughput benchmark application.");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
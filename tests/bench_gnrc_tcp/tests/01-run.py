@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2020 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+PORT = 24911
+DATA_LEN = 1048576
+
+
+def testfunc(child):
+    child.expect_exact("GNRC TCP throughput benchmark application.\r\n")
+    child.sendline("server {}".format(PORT))
+    child.expect_exact("server: listening on port {}\r\n".format(PORT))
+    child.sendline("client [::1]:{} {}".format(PORT, DATA_LEN))
+    child.expect_exact("client: sent {} bytes".format(DATA_LEN))
+    child.expect(r"{ \"result\" : \d+ }\r\n", timeout=60)
+    child.expect_exact("server: received {} bytes".format(DATA_LEN))
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
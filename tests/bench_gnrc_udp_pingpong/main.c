@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       UDP ping-pong benchmark over the IPv6 loopback address
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "test_utils/expect.h"
+
+#include "net/sock/udp.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (1000000U)
+#endif
+
+#define PONG_PORT           (61616U)
+#define PING_PORT           (61617U)
+
+static char _stack[THREAD_STACKSIZE_MAIN];
+static volatile unsigned _flag = 0;
+
+static void _timer_callback(void *arg)
+{
+    (void)arg;
+
+    _flag = 1;
+}
+
+static void *_pong_thread(void *arg)
+{
+    (void)arg;
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_ep_t remote;
+    sock_udp_t sock;
+    uint8_t buf[8];
+
+    local.port = PONG_PORT;
+    expect(sock_udp_create(&sock, &local, NULL, 0) == 0);
+    while (1) {
+        ssize_t res = sock_udp_recv(&sock, buf, sizeof(buf), SOCK_NO_TIMEOUT,
+                                    &remote);
+
+        if (res > 0) {
+            sock_udp_send(&sock, buf, res, &remote);
+        }
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = PONG_PORT };
+    sock_udp_t sock;
+    xtimer_t timer = { .callback = _timer_callback };
+    uint8_t buf[8] = { 0 };
+    uint32_t n = 0;
+
+    puts("UDP ping-pong benchmark application.\n");
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    local.port = PING_PORT;
+    expect(sock_udp_create(&sock, &local, NULL, 0) == 0);
+    /* same priority as main, so a delivered datagram does not preempt the
+     * sending thread */
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN,
+                  THREAD_CREATE_STACKTEST, _pong_thread, NULL, "pong");
+    /* let the pong thread create its sock */
+    thread_yield();
+
+    xtimer_set(&timer, TEST_DURATION);
+    while (!_flag) {
+        expect(sock_udp_send(&sock, buf, sizeof(buf), &remote) > 0);
+        expect(sock_udp_recv(&sock, buf, sizeof(buf), SOCK_NO_TIMEOUT,
+                             NULL) == sizeof(buf));
+        n++;
+    }
+
+    printf("{ \"result\" : %" PRIu32 " }\n", n);
+
+    return 0;
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Internet checksum throughput benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "net/inet_csum.h"
+#include "xtimer.h"
+
+#ifndef REPEAT
+#define REPEAT      (10000U)
+#endif
+
+static const uint16_t _sizes[] = { 8, 20, 40, 64, 128, 512, 1280 };
+
+/* one more word for the unaligned runs */
+static uint32_t _buf[(1280 / sizeof(uint32_t)) + 1];
+
+/* keeps the compiler from optimizing the calculation away */
+static volatile uint16_t _result;
+
+static void _bench(const uint8_t *buf, uint16_t len, const char *desc)
+{
+    uint32_t before, diff;
+    uint16_t sum = 0;
+
+    before = xtimer_now_usec();
+    for (unsigned i = 0; i < REPEAT; i++) {
+        sum = inet_csum_slice(sum, buf, len, 0);
+    }
+    diff = xtimer_now_usec() - before;
+    _result = sum;
+
+    printf("%4u bytes %9s: %8" PRIu32 " us, %8" PRIu32 " bytes/ms\n",
+           (unsigned)len, desc, diff,
+           (uint32_t)(((uint64_t)len * REPEAT * 1000) / (diff ? diff : 1)));
+}
+
+int main(void)
+{
+    uint8_t *buf = (uint8_t *)_buf;
+
+    puts("inet_csum benchmark application.\n");
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        buf[i] = i * 7;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+        _bench(buf, _sizes[i], "aligned");
+        _bench(buf + 1, _sizes[i], "unaligned");
+    }
+
+    puts("done.");
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for link layer address filters with many entries
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "test_utils/expect.h"
+
+#include "net/eui64.h"
+#include "net/l2filter.h"
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef ENTRIES
+#define ENTRIES             (2048U)
+#endif
+
+#ifndef FRAMES
+#define FRAMES              (100000UL)  /**< frames checked per list size */
+#endif
+
+static l2filter_t _list[L2FILTER_LISTSIZE];
+static eui64_t _addrs[ENTRIES];
+
+static void _random_addr(eui64_t *addr)
+{
+    random_bytes(addr->uint8, sizeof(addr->uint8));
+}
+
+static uint32_t _frames_per_sec(uint32_t usec)
+{
+    return (uint32_t)(((uint64_t)FRAMES * US_PER_SEC) / (usec ? usec : 1));
+}
+
+int main(void)
+{
+    unsigned entries = 0;
+
+    puts("Link layer address filter benchmark application.");
+
+    random_init(0x12a7);
+    for (unsigned i = 0; i < ENTRIES; i++) {
+        _random_addr(&_addrs[i]);
+    }
+
+    for (unsigned size = 8; size <= ENTRIES; size *= 4) {
+        uint32_t before, hit, miss;
+
+        for (; entries < size; entries++) {
+            expect(l2filter_add(_list, &_addrs[entries],
+                                sizeof(eui64_t)) == 0);
+        }
+
+        /* frames of white-listed nodes */
+        before = xtimer_now_usec();
+        for (unsigned long i = 0; i < FRAMES; i++) {
+            const eui64_t *addr = &_addrs[i % size];
+
+            expect(l2filter_pass(_list, addr, sizeof(eui64_t)));
+        }
+        hit = xtimer_now_usec() - before;
+
+        /* frames of unknown nodes */
+        eui64_t unknown;
+        _random_addr(&unknown);
+        before = xtimer_now_usec();
+        for (unsigned long i = 0; i < FRAMES; i++) {
+            unknown.uint8[7] = i;
+            expect(!l2filter_pass(_list, &unknown, sizeof(eui64_t)));
+        }
+        miss = xtimer_now_usec() - before;
+
+        printf("%5u entries: %9" PRIu32 " frames/s (listed) "
+               "%9" PRIu32 " frames/s (unknown)\n", size,
+               _frames_per_sec(hit), _frames_per_sec(miss));
+    }
+
+    /* removing entries must keep the others reachable */
+    for (unsigned i = 0; i < entries; i += 2) {
+        expect(l2filter_rm(_list, &_addrs[i], sizeof(eui64_t)) == 0);
+    }
+    for (unsigned i = 0; i < entries; i++) {
+        expect(l2filter_pass(_list, &_addrs[i], sizeof(eui64_t)) == (i & 1));
+    }
+
+    puts("done.");
+
+    return 0;
+}
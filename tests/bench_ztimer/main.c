@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       ztimer set / remove benchmark with many pending timers
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "test_utils/expect.h"
+
+#include "random.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_TIMERS
+#define NUMOF_TIMERS   (10000U)
+#endif
+
+#ifndef REPEAT
+#define REPEAT   (1000U)
+#endif
+
+#ifndef BASE
+#define BASE    (100000000LU)
+#endif
+
+#ifndef SPREAD
+#define SPREAD  (1000LU)
+#endif
+
+/* maximum offset of the timers that are actually triggered */
+#ifndef TRIGGER_SPREAD
+#define TRIGGER_SPREAD  (500000LU)
+#endif
+
+static ztimer_t _timers[NUMOF_TIMERS];
+static uint32_t _targets[NUMOF_TIMERS];
+
+/* This variable is set by any timer that actually triggers. Only the last
+ * test lets timers trigger, so before that there's an 'expect(!_triggers)'
+ * after every test.
+ */
+static volatile unsigned _triggers;
+static uint32_t _start;
+static unsigned _early;
+
+static void _callback(void *arg)
+{
+    (void)arg;
+    _triggers++;
+}
+
+static void _target_callback(void *arg)
+{
+    uint32_t target = *(uint32_t *)arg;
+
+    /* compare relative to _start to be safe against overflows */
+    if ((ztimer_now(ZTIMER_USEC) - _start) < (target - _start)) {
+        _early++;
+    }
+    _triggers++;
+}
+
+static void _print_result(const char *desc, unsigned n, uint32_t total)
+{
+    printf("%30s %8"PRIu32" / %u = %"PRIu32"\n", desc, total, n, total/n);
+}
+
+int main(void)
+{
+    puts("ztimer benchmark application.\n");
+
+    uint32_t before, diff;
+
+    for (unsigned n = 0; n < NUMOF_TIMERS; n++) {
+        _timers[n].callback = _callback;
+        _timers[n].arg = (void *)&_triggers;
+    }
+    random_init(0x2b1e5);
+
+    /*
+     * test setting NUMOF_TIMERS timers with increasing targets
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < NUMOF_TIMERS; n++) {
+        ztimer_set(ZTIMER_USEC, &_timers[n], BASE + (SPREAD * n));
+    }
+
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    _print_result("set() many increasing target", NUMOF_TIMERS, diff);
+    expect(!_triggers);
+
+    /*
+     * test removing / setting the middle timer REPEAT times
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < REPEAT; n++) {
+        ztimer_remove(ZTIMER_USEC, &_timers[NUMOF_TIMERS / 2]);
+        ztimer_set(ZTIMER_USEC, &_timers[NUMOF_TIMERS / 2],
+                   BASE + (SPREAD * NUMOF_TIMERS / 2));
+    }
+
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    _print_result("remove() + set() middle", REPEAT, diff);
+    expect(!_triggers);
+
+    /*
+     * test re-setting random timers REPEAT times
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < REPEAT; n++) {
+        unsigned i = random_uint32_range(0, NUMOF_TIMERS);
+
+        ztimer_set(ZTIMER_USEC, &_timers[i], BASE + (SPREAD * i));
+    }
+
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    _print_result("re-set() random", REPEAT, diff);
+    expect(!_triggers);
+
+    /*
+     * test removing NUMOF_TIMERS timers (latest first)
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < NUMOF_TIMERS; n++) {
+        ztimer_remove(ZTIMER_USEC, &_timers[NUMOF_TIMERS - n - 1]);
+    }
+
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    _print_result("remove() many decreasing", NUMOF_TIMERS, diff);
+    expect(!_triggers);
+
+    /*
+     * test setting NUMOF_TIMERS timers with random targets
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < NUMOF_TIMERS; n++) {
+        ztimer_set(ZTIMER_USEC, &_timers[n],
+                   BASE + random_uint32_range(0, SPREAD * NUMOF_TIMERS));
+    }
+
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    _print_result("set() many random target", NUMOF_TIMERS, diff);
+    expect(!_triggers);
+
+    /*
+     * test removing NUMOF_TIMERS timers in the order they were set
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < NUMOF_TIMERS; n++) {
+        ztimer_remove(ZTIMER_USEC, &_timers[n]);
+    }
+
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    _print_result("remove() many random target", NUMOF_TIMERS, diff);
+    expect(!_triggers);
+
+    /*
+     * test triggering NUMOF_TIMERS timers, none of which may trigger before
+     * its target
+     *
+     */
+    _start = ztimer_now(ZTIMER_USEC);
+    before = _start;
+    for (unsigned n = 0; n < NUMOF_TIMERS; n++) {
+        uint32_t val = random_uint32_range(TRIGGER_SPREAD / 2, TRIGGER_SPREAD);
+
+        _timers[n].callback = _target_callback;
+        _timers[n].arg = &_targets[n];
+        _targets[n] = ztimer_now(ZTIMER_USEC) + val;
+        ztimer_set(ZTIMER_USEC, &_timers[n], val);
+    }
+
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    _print_result("set() many to trigger", NUMOF_TIMERS, diff);
+    ztimer_sleep(ZTIMER_USEC, TRIGGER_SPREAD);
+    before = ztimer_now(ZTIMER_USEC);
+    while (_triggers < NUMOF_TIMERS) {
+        expect((ztimer_now(ZTIMER_USEC) - before) < TRIGGER_SPREAD);
+    }
+    expect(!_early);
+
+    _print_result("sizeof(ztimer_t)", NUMOF_TIMERS, sizeof(_timers));
+
+    puts("done.");
+
+    return 0;
+}
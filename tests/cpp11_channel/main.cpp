@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief test typed message channels
+ *
+ * @}
+ */
+
+#include <cstdio>
+
+#include "riot/channel.hpp"
+#include "riot/thread.hpp"
+
+#include "test_utils/expect.h"
+
+using namespace std;
+using namespace riot;
+
+namespace {
+
+struct sample {
+  unsigned seq;
+  unsigned values[16];
+};
+
+struct counted {
+  static unsigned alive;
+  counted() { ++alive; }
+  ~counted() { --alive; }
+};
+
+unsigned counted::alive = 0;
+
+} // namespace
+
+static constexpr unsigned channel_size = 4;
+static constexpr unsigned num_samples = 32;
+
+int main() {
+  puts("\n************ C++ channel test ***********");
+
+  puts("Send and receive ...");
+  {
+    channel<sample, channel_size> ch;
+    expect(!ch.try_receive());
+    ch.emplace(sample{1, {2}});
+    auto s = ch.receive();
+    expect(s && s->seq == 1 && s->values[0] == 2);
+  }
+  puts("Done\n");
+
+  puts("Slots are returned to the pool ...");
+  {
+    channel<counted, channel_size> ch;
+    for (unsigned i = 0; i < channel_size; i++) {
+      expect(ch.try_emplace());
+    }
+    // all slots are in use
+    expect(!ch.try_emplace());
+    expect(counted::alive == channel_size);
+    {
+      auto c = ch.try_receive();
+      expect(c);
+      expect(!ch.try_emplace());
+    }
+    expect(counted::alive == channel_size - 1);
+    expect(ch.try_emplace());
+  }
+  // objects that were not received are destroyed with the channel
+  expect(counted::alive == 0);
+  puts("Done\n");
+
+  puts("Receiving many ...");
+  {
+    channel<sample, channel_size> ch;
+    thread t([&ch] {
+      for (unsigned i = 0; i < num_samples; i++) {
+        // blocks while the receiver holds all slots
+        ch.emplace(sample{i, {i}});
+      }
+    });
+    unsigned next = 0;
+    channel<sample, channel_size>::handle batch[channel_size];
+    while (next < num_samples) {
+      unsigned got = ch.receive_many(batch, channel_size);
+      expect(got > 0 && got <= channel_size);
+      for (unsigned i = 0; i < got; i++) {
+        expect(batch[i]->seq == next && batch[i]->values[0] == next);
+        batch[i].reset();
+        next++;
+      }
+    }
+    t.join();
+    expect(!ch.try_receive());
+  }
+  puts("Done\n");
+
+  puts("Bye, bye.");
+  puts("******************************************");
+
+  return 0;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief test thread pool, future and promise
+ *
+ * @}
+ */
+
+#include <atomic>
+#include <cstdio>
+#include <stdexcept>
+#include <system_error>
+
+#include "riot/chrono.hpp"
+#include "riot/future.hpp"
+#include "riot/thread.hpp"
+#include "riot/thread_pool.hpp"
+
+#include "test_utils/expect.h"
+
+using namespace std;
+using namespace riot;
+
+static constexpr unsigned num_workers = 2;
+
+int main() {
+  puts("\n************ C++ thread_pool test ***********");
+
+  puts("Promise and future ...");
+  {
+    promise<int> p;
+    auto f = p.get_future();
+    expect(f.valid());
+    expect(f.wait_for(chrono::milliseconds(10)) == future_status::timeout);
+    thread t([&p] { p.set_value(42); });
+    expect(f.get() == 42);
+    expect(!f.valid());
+    t.join();
+  }
+  puts("Done\n");
+
+  puts("Broken promise ...");
+  {
+    future<void> f;
+    {
+      promise<void> p;
+      f = p.get_future();
+    }
+    try {
+      f.get();
+      expect(false);
+    }
+    catch (const std::system_error& e) {
+      // expected
+    }
+  }
+  puts("Done\n");
+
+  expect(sched_num_threads == 2); // main + idle
+
+  puts("Submitting tasks ...");
+  {
+    thread_pool pool(num_workers);
+    expect(pool.size() == num_workers);
+    expect(sched_num_threads == 2 + num_workers);
+    auto f1 = pool.submit([](int a, int b) { return a + b; }, 1, 2);
+    auto f2 = async(pool, [] { return 4; });
+    auto f3 = pool.submit([] { throw std::runtime_error("task failed"); });
+    expect(f1.get() == 3);
+    expect(f2.get() == 4);
+    try {
+      f3.get();
+      expect(false);
+    }
+    catch (const std::runtime_error& e) {
+      // expected
+    }
+  }
+  puts("Done\n");
+
+  expect(sched_num_threads == 2);
+
+  puts("Nested tasks ...");
+  {
+    thread_pool pool(num_workers);
+    auto outer = pool.submit([&pool] {
+      // submitted into the deque of this worker, run by the other one
+      auto inner = pool.submit([] { return this_thread::get_id(); });
+      return inner.get() != this_thread::get_id();
+    });
+    expect(outer.get());
+  }
+  puts("Done\n");
+
+  expect(sched_num_threads == 2);
+
+  puts("Running remaining tasks on destruction ...");
+  {
+    atomic<unsigned> count{0};
+    {
+      thread_pool pool(num_workers);
+      for (unsigned i = 0; i < 10; i++) {
+        pool.post([&count] {
+          this_thread::sleep_for(chrono::milliseconds(1));
+          ++count;
+        });
+      }
+    }
+    expect(count == 10);
+  }
+  puts("Done\n");
+
+  expect(sched_num_threads == 2);
+
+  puts("Bye, bye.");
+  puts("******************************************");
+
+  return 0;
+}
@@ -1447,6 +1447,36 @@ static void test_netapi_send__ipv6_multicast_ieee802154_packet(void)
     gnrc_netif_send(&ieee802154_netif, pkt);
 }
 
+static char batch_sender_stack[THREAD_STACKSIZE_DEFAULT];
+
+static void *_batch_sender(void *arg)
+{
+    (void)arg;
+    /* queue up multiple packets at the interface before it gets to run */
+    for (char c = '1'; c <= '3'; c++) {
+        char data[] = { c, '\0' };
+        gnrc_netif_hdr_t *hdr;
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, data, sizeof(data),
+                                              GNRC_NETTYPE_UNDEF);
+        expect(pkt != NULL);
+        gnrc_pktsnip_t *netif = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+        expect(netif != NULL);
+        hdr = netif->data;
+        hdr->flags |= GNRC_NETIF_HDR_FLAGS_BROADCAST;
+        LL_PREPEND(pkt, netif);
+        gnrc_netif_send(&ethernet_netif, pkt);
+    }
+    return NULL;
+}
+
+static void test_netapi_send__batch_broadcast_ethernet_packets(void)
+{
+    TEST_ASSERT(thread_create(batch_sender_stack, sizeof(batch_sender_stack),
+                              GNRC_NETIF_PRIO - 1, THREAD_CREATE_STACKTEST,
+                              _batch_sender, NULL, "batch_sender") >
+                KERNEL_PID_UNDEF);
+}
+
 static void test_netapi_recv__empty_ethernet_payload(void)
 {
     static const uint8_t data[] = { LA1, LA2, LA3, LA6, LA7, LA8,
@@ -1632,6 +1662,7 @@ int main(void)
     test_netapi_send__ipv6_multicast_ethernet_packet();
     test_netapi_send__ipv6_unicast_ieee802154_packet();
     test_netapi_send__ipv6_multicast_ieee802154_packet();
+    test_netapi_send__batch_broadcast_ethernet_packets();
     test_netapi_recv__empty_ethernet_payload();
     test_netapi_recv__empty_ieee802154_payload();
     test_netapi_recv__raw_ethernet_payload();
@@ -76,6 +76,11 @@ def testfunc(child):
     child.expect("00000010  00  00  00  00  08  3B  40  FE  80  00  00  00  00  00  00  3C")
     child.expect("00000020  E6  B5  0F  19  22  FD  0A  FF  02  00  00  00  00  00  00  00")
     child.expect("00000030  00  00  00  00  00  00  01  41  42  43  44  45  46  47  00")
+    # test_netapi_send__batch_broadcast_ethernet_packets
+    for c in ("31", "32", "33"):
+        child.expect("Sending data from Ethernet device:")
+        child.expect("00000000  FF  FF  FF  FF  FF  FF  3E  E6  B5  22  FD  0A  FF  FF  {}  00"
+                     .format(c))
     # test_netapi_recv__empty_ethernet_payload
     child.expect("pktdump dumping Ethernet packet with empty payload")
     child.expect("PKTDUMP: data received:")
@@ -23,6 +23,7 @@
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/sixlowpan/frag.h"
 #include "net/gnrc/sixlowpan/frag/rb.h"
+#include "net/gnrc/sixlowpan/frag/vrb.h"
 #include "xtimer.h"
 
 #define TEST_NETIF_HDR_SRC      { 0xb3, 0x47, 0x60, 0x49, \
@@ -578,6 +579,55 @@ static void test_rbuf_rm(void)
     _check_pktbuf(NULL);
 }
 
+static gnrc_sixlowpan_frag_rb_t *_rbuf_add_first_fragment(uint16_t tag)
+{
+    gnrc_pktsnip_t *pkt;
+
+    _set_fragment_tag(_fragment1, tag);
+    pkt = gnrc_pktbuf_add(NULL, _fragment1, sizeof(_fragment1),
+                          GNRC_NETTYPE_SIXLOWPAN);
+    if (pkt == NULL) {
+        return NULL;
+    }
+    return gnrc_sixlowpan_frag_rb_add(&_test_netif_hdr.hdr, pkt,
+                                      TEST_FRAGMENT1_OFFSET, TEST_PAGE);
+}
+
+static void test_rbuf_rm__after_vrb_rm(void)
+{
+    /* The interface is only kept as a reference by the VRB */
+    static gnrc_netif_t dummy_netif;
+    static const uint8_t out_dst[] = TEST_NETIF_HDR_DST;
+    gnrc_sixlowpan_frag_rb_t *entry1, *entry2;
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
+
+    gnrc_sixlowpan_frag_vrb_reset();
+    TEST_ASSERT_NOT_NULL((entry1 = _rbuf_add_first_fragment(TEST_TAG)));
+    TEST_ASSERT_NOT_NULL((vrbe = gnrc_sixlowpan_frag_vrb_add(
+            &entry1->super, &dummy_netif, out_dst, sizeof(out_dst)
+        )));
+    /* the VRB entry shares the interval list of the reassembly buffer entry,
+     * gnrc_sixlowpan_iphc removes both when forwarding fails */
+    TEST_ASSERT(vrbe->super.ints == entry1->super.ints);
+    gnrc_sixlowpan_frag_vrb_rm(vrbe);
+    gnrc_pktbuf_release(entry1->pkt);
+    gnrc_sixlowpan_frag_rb_remove(entry1);
+    TEST_ASSERT_NULL(_first_non_empty_rbuf());
+    /* the interval was freed only once, so new datagrams do not share one */
+    TEST_ASSERT_NOT_NULL((entry1 = _rbuf_add_first_fragment(TEST_TAG + 1)));
+    TEST_ASSERT_NOT_NULL((entry2 = _rbuf_add_first_fragment(TEST_TAG + 2)));
+    TEST_ASSERT_NOT_NULL(entry1->super.ints);
+    TEST_ASSERT_NOT_NULL(entry2->super.ints);
+    TEST_ASSERT(entry1->super.ints != entry2->super.ints);
+    TEST_ASSERT_NULL(entry1->super.ints->next);
+    TEST_ASSERT_NULL(entry2->super.ints->next);
+    gnrc_pktbuf_release(entry1->pkt);
+    gnrc_sixlowpan_frag_rb_remove(entry1);
+    gnrc_pktbuf_release(entry2->pkt);
+    gnrc_sixlowpan_frag_rb_remove(entry2);
+    _check_pktbuf(NULL);
+}
+
 static void test_rbuf_gc__manually(void)
 {
     gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _fragment1, sizeof(_fragment1),
@@ -634,6 +684,7 @@ static void run_unittests(void)
         new_TestFixture(test_rbuf_exists),
         new_TestFixture(test_rbuf_rm_by_dg),
         new_TestFixture(test_rbuf_rm),
+        new_TestFixture(test_rbuf_rm__after_vrb_rm),
         new_TestFixture(test_rbuf_gc__manually),
         new_TestFixture(test_rbuf_gc__timed),
     };
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Concurrent connections to a GNRC sock_tcp listening queue
+ *
+ * The clients talk first, then the server talks first. In the second
+ * round the clients send nothing after connecting, so the handshakes that
+ * complete while all socks of the queue are in use must be finished by the
+ * SYN queue on its own.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test_utils/expect.h"
+
+#include "net/ipv6/addr.h"
+#include "net/sock/tcp.h"
+#include "thread.h"
+
+#ifndef NUMOF_CLIENTS
+#define NUMOF_CLIENTS   (4U)
+#endif
+
+/* less socks than clients, so socks have to be reused by the queue */
+#ifndef QUEUE_LEN
+#define QUEUE_LEN       (2U)
+#endif
+
+#define SERVER_PORT     (24911U)
+#define MSG_LEN         (16U)
+
+static char _stacks[NUMOF_CLIENTS][THREAD_STACKSIZE_DEFAULT];
+static sock_tcp_t _client_socks[NUMOF_CLIENTS];
+static sock_tcp_t _queue_array[QUEUE_LEN];
+static sock_tcp_queue_t _queue;
+static kernel_pid_t _main_pid;
+
+static void *_client(void *arg)
+{
+    unsigned num = (unsigned)arg;
+    sock_tcp_t *sock = &_client_socks[num];
+    sock_tcp_ep_t remote = { .family = AF_INET6, .port = SERVER_PORT };
+    char out[MSG_LEN], in[MSG_LEN];
+    msg_t msg;
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)remote.addr.ipv6);
+    snprintf(out, sizeof(out), "client %u", num);
+
+    expect(sock_tcp_connect(sock, &remote, 0, 0) == 0);
+    expect(sock_tcp_write(sock, out, sizeof(out)) == sizeof(out));
+    expect(sock_tcp_read(sock, in, sizeof(in), SOCK_NO_TIMEOUT) == sizeof(in));
+    expect(memcmp(in, out, sizeof(in)) == 0);
+    sock_tcp_disconnect(sock);
+
+    msg.content.value = num;
+    msg_send(&msg, _main_pid);
+    return NULL;
+}
+
+static void *_silent_client(void *arg)
+{
+    unsigned num = (unsigned)arg;
+    sock_tcp_t *sock = &_client_socks[num];
+    sock_tcp_ep_t remote = { .family = AF_INET6, .port = SERVER_PORT };
+    char in[MSG_LEN];
+    msg_t msg;
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)remote.addr.ipv6);
+
+    expect(sock_tcp_connect(sock, &remote, 0, 0) == 0);
+    expect(sock_tcp_read(sock, in, sizeof(in), SOCK_NO_TIMEOUT) == sizeof(in));
+    expect(strncmp(in, "server", strlen("server")) == 0);
+    sock_tcp_disconnect(sock);
+
+    msg.content.value = num;
+    msg_send(&msg, _main_pid);
+    return NULL;
+}
+
+static void _start_clients(thread_task_func_t client)
+{
+    for (unsigned i = 0; i < NUMOF_CLIENTS; i++) {
+        thread_create(_stacks[i], sizeof(_stacks[i]), THREAD_PRIORITY_MAIN + 1,
+                      THREAD_CREATE_STACKTEST, client, (void *)i, "client");
+    }
+}
+
+static void _wait_for_clients(void)
+{
+    sock_tcp_t *sock;
+    msg_t msg;
+
+    for (unsigned i = 0; i < NUMOF_CLIENTS; i++) {
+        msg_receive(&msg);
+    }
+    /* also lets the clients exit, before their stacks are reused */
+    expect(sock_tcp_accept(&_queue, &sock, 100000U) == -ETIMEDOUT);
+}
+
+int main(void)
+{
+    sock_tcp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_tcp_t *sock;
+    char buf[MSG_LEN];
+
+    puts("gnrc_sock_tcp listening queue test");
+
+    _main_pid = thread_getpid();
+    local.port = SERVER_PORT;
+    expect(sock_tcp_listen(&_queue, &local, _queue_array, QUEUE_LEN, 0) == 0);
+    expect(sock_tcp_listen(&_queue, &local, _queue_array, QUEUE_LEN, 0) ==
+           -EADDRINUSE);
+    expect(sock_tcp_accept(&_queue, &sock, 0) == -EAGAIN);
+
+    _start_clients(_client);
+
+    /* echo the message of every client */
+    for (unsigned i = 0; i < NUMOF_CLIENTS; i++) {
+        sock_tcp_ep_t remote;
+
+        expect(sock_tcp_accept(&_queue, &sock, SOCK_NO_TIMEOUT) == 0);
+        expect(sock_tcp_get_remote(sock, &remote) == 0);
+        expect(sock_tcp_read(sock, buf, sizeof(buf), SOCK_NO_TIMEOUT) ==
+               sizeof(buf));
+        printf("accepted %s from port %u\n", buf, remote.port);
+        expect(sock_tcp_write(sock, buf, sizeof(buf)) == sizeof(buf));
+        sock_tcp_disconnect(sock);
+    }
+
+    _wait_for_clients();
+    puts("clients talked first");
+
+    _start_clients(_silent_client);
+
+    /* greet every client, they only read */
+    for (unsigned i = 0; i < NUMOF_CLIENTS; i++) {
+        expect(sock_tcp_accept(&_queue, &sock, SOCK_NO_TIMEOUT) == 0);
+        memset(buf, 0, sizeof(buf));
+        snprintf(buf, sizeof(buf), "server %u", i);
+        expect(sock_tcp_write(sock, buf, sizeof(buf)) == sizeof(buf));
+        printf("greeted client %u\n", i);
+        sock_tcp_disconnect(sock);
+    }
+    _wait_for_clients();
+    puts("server talked first");
+
+    sock_tcp_stop_listen(&_queue);
+
+    puts("SUCCESS");
+    return 0;
+}
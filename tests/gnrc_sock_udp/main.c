@@ -22,6 +22,7 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include "kernel_defines.h"
 #include "net/sock/udp.h"
 #include "test_utils/expect.h"
 #include "xtimer.h"
@@ -447,6 +448,106 @@ static void test_sock_udp_recv_buf__success(void)
     assert(_check_net());
 }
 
+static void test_sock_udp_recv_many__success(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_ep_t result;
+    sock_udp_msg_t msgs[] = {
+        { .data = _test_buffer, .len = _TEST_BUFFER_SIZE / 2,
+          .remote = &result },
+        { .data = _test_buffer + (_TEST_BUFFER_SIZE / 2),
+          .len = _TEST_BUFFER_SIZE / 2 },
+        { .data = _test_buffer, .len = _TEST_BUFFER_SIZE },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "EFG", sizeof("EFG"),
+                          _TEST_NETIF));
+    /* only the messages already received are returned */
+    expect(2 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs),
+                                   SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].len);
+    expect(memcmp(msgs[0].data, "ABCD", sizeof("ABCD")) == 0);
+    expect(sizeof("EFG") == msgs[1].len);
+    expect(memcmp(msgs[1].data, "EFG", sizeof("EFG")) == 0);
+    expect(AF_INET6 == result.family);
+    expect(memcmp(&result.addr, &src_addr, sizeof(result.addr)) == 0);
+    expect(_TEST_PORT_REMOTE == result.port);
+    expect(_TEST_NETIF == result.netif);
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv_many__ENOBUFS_later(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_msg_t msgs[] = {
+        { .data = _test_buffer, .len = sizeof("ABCD") },
+        { .data = _test_buffer + sizeof("ABCD"), .len = sizeof("ABCD") },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "EFGHIJK", sizeof("EFGHIJK"),
+                          _TEST_NETIF));
+    /* the second message does not fit, so it is left in the queue */
+    expect(1 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs),
+                                   SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].len);
+    expect(memcmp(msgs[0].data, "ABCD", sizeof("ABCD")) == 0);
+    msgs[0].len = _TEST_BUFFER_SIZE / 2;
+    expect(1 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(sizeof("EFGHIJK") == msgs[0].len);
+    expect(memcmp(msgs[0].data, "EFGHIJK", sizeof("EFGHIJK")) == 0);
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv_buf_many__success(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_msg_t msgs[3] = { { .data = NULL } };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "EFG", sizeof("EFG"),
+                          _TEST_NETIF));
+    expect(2 == sock_udp_recv_buf_many(&_sock, msgs, ARRAY_SIZE(msgs),
+                                       SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].len);
+    expect(memcmp(msgs[0].data, "ABCD", sizeof("ABCD")) == 0);
+    expect(msgs[0].buf_ctx != NULL);
+    expect(sizeof("EFG") == msgs[1].len);
+    expect(memcmp(msgs[1].data, "EFG", sizeof("EFG")) == 0);
+    expect(msgs[1].buf_ctx != NULL);
+    expect(msgs[2].buf_ctx == NULL);
+    expect(0 == sock_udp_recv_buf_many(&_sock, msgs, ARRAY_SIZE(msgs),
+                                       SOCK_NO_TIMEOUT));
+    expect(msgs[0].data == NULL);
+    expect(msgs[0].buf_ctx == NULL);
+    expect(msgs[1].buf_ctx == NULL);
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -583,6 +684,38 @@ static void test_sock_udp_send__socketed(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_send_many__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t other_addr = { .u8 = _TEST_ADDR_WRONG };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    static sock_udp_ep_t other = { .addr = { .ipv6 = _TEST_ADDR_WRONG },
+                                   .family = AF_INET6,
+                                   .port = _TEST_PORT_REMOTE + _TEST_PORT_LOCAL };
+    const sock_udp_msg_t msgs[] = {
+        { .data = "ABCD", .len = sizeof("ABCD") },
+        { .data = "EFG", .len = sizeof("EFG"), .remote = &other },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(2 == sock_udp_send_many(&_sock, msgs, ARRAY_SIZE(msgs)));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, false));
+    expect(_check_packet(&src_addr, &other_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE + _TEST_PORT_LOCAL, "EFG",
+                         sizeof("EFG"), _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__socketed_other_remote(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
@@ -751,6 +884,9 @@ int main(void)
     CALL(test_sock_udp_recv__with_timeout());
     CALL(test_sock_udp_recv__non_blocking());
     CALL(test_sock_udp_recv_buf__success());
+    CALL(test_sock_udp_recv_many__success());
+    CALL(test_sock_udp_recv_many__ENOBUFS_later());
+    CALL(test_sock_udp_recv_buf_many__success());
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());
@@ -761,6 +897,7 @@ int main(void)
     CALL(test_sock_udp_send__socketed_no_netif());
     CALL(test_sock_udp_send__socketed_no_local());
     CALL(test_sock_udp_send__socketed());
+    CALL(test_sock_udp_send_many__socketed());
     CALL(test_sock_udp_send__socketed_other_remote());
     CALL(test_sock_udp_send__unsocketed_no_local_no_netif());
     CALL(test_sock_udp_send__unsocketed_no_netif());
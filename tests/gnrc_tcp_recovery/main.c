@@ -0,0 +1,375 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests option handling, loss recovery and congestion control
+ *              of gnrc_tcp
+ *
+ * The tests drive the FSM of an established connection with crafted
+ * acknowledgments and record the segments it sends.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "msg.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tcp.h"
+#include "thread.h"
+
+#include "internal/common.h"
+#include "internal/fsm.h"
+#include "internal/option.h"
+#include "internal/pkt.h"
+
+#define TEST_SMSS           (100U)
+#define TEST_ISS            (1000U)
+#define TEST_IRS            (5000U)
+#define TEST_WND            (4000U)
+#define TEST_LOCAL_PORT     (2000U)
+#define TEST_PEER_PORT      (3000U)
+#define TEST_MSG_QUEUE_SIZE (16U)
+
+/* sequence number of the n-th segment sent */
+#define SEG(n)              (TEST_ISS + ((n) * TEST_SMSS))
+
+static const ipv6_addr_t _local_addr = { {
+        0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+    } };
+static const ipv6_addr_t _peer_addr = { {
+        0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02
+    } };
+
+static msg_t _msg_queue[TEST_MSG_QUEUE_SIZE];
+static uint8_t _data[8 * TEST_SMSS];
+static gnrc_tcp_tcb_t _tcb;
+
+/* TCP header followed by the largest option field */
+static struct {
+    tcp_hdr_t hdr;
+    uint8_t opts[(TCP_HDR_OFFSET_MAX - TCP_HDR_OFFSET_MIN) * 4];
+} _seg;
+
+static void _set_up(void)
+{
+    gnrc_pktbuf_init();
+    gnrc_tcp_tcb_init(&_tcb);
+    memcpy(_tcb.local_addr, &_local_addr, sizeof(_local_addr));
+    memcpy(_tcb.peer_addr, &_peer_addr, sizeof(_peer_addr));
+    _tcb.local_port = TEST_LOCAL_PORT;
+    _tcb.peer_port = TEST_PEER_PORT;
+    _tcb.state = FSM_STATE_ESTABLISHED;
+    _tcb.status = STATUS_SACK_PERM;
+    _tcb.mss = TEST_SMSS;
+    _tcb.snd_una = TEST_ISS;
+    _tcb.snd_nxt = TEST_ISS;
+    _tcb.snd_wnd = TEST_WND;
+    _tcb.snd_wl1 = TEST_IRS;
+    _tcb.snd_wl2 = TEST_ISS;
+    _tcb.rcv_nxt = TEST_IRS;
+    /* initial window of RFC 5681 */
+    _tcb.cwnd = 4 * TEST_SMSS;
+    _tcb.ssthresh = UINT32_MAX;
+    memset(&_seg, 0, sizeof(_seg));
+}
+
+static void _set_offset(uint8_t offset, uint16_t ctl)
+{
+    _seg.hdr.off_ctl = byteorder_htons(_option_build_offset_control(offset, ctl));
+}
+
+static size_t _send(size_t len)
+{
+    return _fsm(&_tcb, FSM_EVENT_CALL_SEND, NULL, _data, len);
+}
+
+/* Releases the segments the connection sent, returns their number */
+static unsigned _sent(uint32_t *seqs, unsigned max)
+{
+    unsigned num = 0;
+    msg_t msg;
+
+    while (msg_try_receive(&msg) == 1) {
+        gnrc_pktsnip_t *tcp;
+
+        if (msg.type != GNRC_NETAPI_MSG_TYPE_SND) {
+            continue;
+        }
+        tcp = gnrc_pktsnip_search_type(msg.content.ptr, GNRC_NETTYPE_TCP);
+        if ((tcp != NULL) && (num < max)) {
+            seqs[num] = byteorder_ntohl(((tcp_hdr_t *)tcp->data)->seq_num);
+        }
+        gnrc_pktbuf_release(msg.content.ptr);
+        num++;
+    }
+    return num;
+}
+
+static void _rcv_ack(uint32_t ack, uint16_t wnd, const uint32_t (*sack)[2],
+                     uint8_t sack_num)
+{
+    uint8_t offset = TCP_HDR_OFFSET_MIN;
+    gnrc_pktsnip_t *pkt;
+    tcp_hdr_t *hdr;
+
+    if (sack_num > 0) {
+        offset += _option_get_sack_len(sack_num);
+    }
+    pkt = gnrc_pktbuf_add(NULL, NULL, offset * 4, GNRC_NETTYPE_TCP);
+    TEST_ASSERT_NOT_NULL(pkt);
+    hdr = pkt->data;
+    memset(hdr, 0, offset * 4);
+    hdr->src_port = byteorder_htons(TEST_PEER_PORT);
+    hdr->dst_port = byteorder_htons(TEST_LOCAL_PORT);
+    hdr->seq_num = byteorder_htonl(_tcb.rcv_nxt);
+    hdr->ack_num = byteorder_htonl(ack);
+    hdr->off_ctl = byteorder_htons(_option_build_offset_control(offset, MSK_ACK));
+    hdr->window = byteorder_htons(wnd);
+    if (sack_num > 0) {
+        _option_build_sack((uint8_t *)(hdr + 1), sack, sack_num);
+    }
+    pkt = gnrc_ipv6_hdr_build(pkt, &_peer_addr, &_local_addr);
+    TEST_ASSERT_NOT_NULL(pkt);
+    _fsm(&_tcb, FSM_EVENT_RCVD_PKT, pkt, NULL, 0);
+    gnrc_pktbuf_release(pkt);
+}
+
+static void _dup_ack(const uint32_t (*sack)[2], uint8_t sack_num)
+{
+    _rcv_ack(_tcb.snd_una, TEST_WND, sack, sack_num);
+}
+
+static void _check_pktbuf(void)
+{
+    _fsm(&_tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
+    _sent(NULL, 0);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_option_parse__syn(void)
+{
+    uint16_t status = STATUS_WND_SCALE | STATUS_SACK_PERM;
+    uint8_t len = _option_get_syn_len(status);
+    option_values_t opts;
+
+    TEST_ASSERT_EQUAL_INT(3, len);
+    _set_offset(TCP_HDR_OFFSET_MIN + len, MSK_SYN);
+    _option_build_syn(_seg.opts, status);
+    TEST_ASSERT_EQUAL_INT(0, _option_parse(&opts, &_seg.hdr));
+    TEST_ASSERT_EQUAL_INT(OPTION_MSS | OPTION_WS | OPTION_SACK_PERM, opts.present);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_MSS, opts.mss);
+    TEST_ASSERT_EQUAL_INT(_option_get_rcv_wnd_scale(), opts.wnd_scale);
+    TEST_ASSERT_EQUAL_INT(0, opts.sack_num);
+}
+
+static void test_option_parse__ws_max(void)
+{
+    static const uint8_t ws[] = { TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_WS,
+                                  TCP_OPTION_LENGTH_WS, TCP_OPTION_WS_MAX + 1 };
+    option_values_t opts;
+
+    _set_offset(TCP_HDR_OFFSET_MIN + 1, MSK_SYN);
+    memcpy(_seg.opts, ws, sizeof(ws));
+    TEST_ASSERT_EQUAL_INT(0, _option_parse(&opts, &_seg.hdr));
+    TEST_ASSERT_EQUAL_INT(OPTION_WS, opts.present);
+    TEST_ASSERT_EQUAL_INT(TCP_OPTION_WS_MAX, opts.wnd_scale);
+}
+
+static void test_option_parse__sack(void)
+{
+    const uint32_t blocks[][2] = { { SEG(1), SEG(2) }, { SEG(3), SEG(4) } };
+    option_values_t opts;
+
+    _set_offset(TCP_HDR_OFFSET_MIN + _option_get_sack_len(2), MSK_ACK);
+    _option_build_sack(_seg.opts, blocks, 2);
+    TEST_ASSERT_EQUAL_INT(0, _option_parse(&opts, &_seg.hdr));
+    TEST_ASSERT_EQUAL_INT(0, opts.present);
+    TEST_ASSERT_EQUAL_INT(2, opts.sack_num);
+    TEST_ASSERT_EQUAL_INT(SEG(1), opts.sack[0][0]);
+    TEST_ASSERT_EQUAL_INT(SEG(2), opts.sack[0][1]);
+    TEST_ASSERT_EQUAL_INT(SEG(3), opts.sack[1][0]);
+    TEST_ASSERT_EQUAL_INT(SEG(4), opts.sack[1][1]);
+}
+
+static void test_option_parse__malformed(void)
+{
+    /* SACK option not made of 8 byte blocks */
+    static const uint8_t sack[] = { TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP,
+                                    TCP_OPTION_KIND_SACK, 11 };
+    /* MSS option exceeding the option field */
+    static const uint8_t mss[] = { TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP,
+                                   TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_MSS };
+    option_values_t opts;
+
+    _set_offset(TCP_HDR_OFFSET_MIN + 3, MSK_ACK);
+    memcpy(_seg.opts, sack, sizeof(sack));
+    TEST_ASSERT(_option_parse(&opts, &_seg.hdr) < 0);
+    _set_offset(TCP_HDR_OFFSET_MIN + 1, MSK_SYN);
+    memcpy(_seg.opts, mss, sizeof(mss));
+    TEST_ASSERT(_option_parse(&opts, &_seg.hdr) < 0);
+}
+
+static void test_ws__scaled_send_window(void)
+{
+    _tcb.snd_wnd_scale = 4;
+    _rcv_ack(SEG(0), 1000, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(1000 << 4, _tcb.snd_wnd);
+    _check_pktbuf();
+}
+
+static void test_cwnd__slow_start_and_avoidance(void)
+{
+    uint32_t seqs[8];
+
+    /* the congestion window limits the data in flight */
+    TEST_ASSERT_EQUAL_INT(4 * TEST_SMSS, _send(sizeof(_data)));
+    TEST_ASSERT_EQUAL_INT(4, _sent(seqs, 8));
+    for (unsigned i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT(SEG(i), seqs[i]);
+    }
+    /* slow start: one SMSS per ACK, even if it acknowledges more */
+    _rcv_ack(SEG(2), TEST_WND, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(5 * TEST_SMSS, _tcb.cwnd);
+    TEST_ASSERT_EQUAL_INT(2, _tcb.pkt_retransmit_num);
+    TEST_ASSERT_EQUAL_INT(0, _sent(seqs, 8));
+    TEST_ASSERT_EQUAL_INT(3 * TEST_SMSS, _send(sizeof(_data)));
+    TEST_ASSERT_EQUAL_INT(3, _sent(seqs, 8));
+    TEST_ASSERT_EQUAL_INT(SEG(4), seqs[0]);
+    /* congestion avoidance: SMSS * SMSS / cwnd per ACK */
+    _tcb.ssthresh = _tcb.cwnd;
+    _rcv_ack(SEG(3), TEST_WND, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(5 * TEST_SMSS + (TEST_SMSS / 5), _tcb.cwnd);
+    _check_pktbuf();
+}
+
+static void test_cwnd__fast_recovery(void)
+{
+    uint32_t seqs[4];
+
+    /* NewReno without SACK */
+    _tcb.status &= ~STATUS_SACK_PERM;
+    TEST_ASSERT_EQUAL_INT(4 * TEST_SMSS, _send(sizeof(_data)));
+    TEST_ASSERT_EQUAL_INT(4, _sent(seqs, 4));
+    _dup_ack(NULL, 0);
+    _dup_ack(NULL, 0);
+    TEST_ASSERT_EQUAL_INT(0, _sent(seqs, 4));
+    TEST_ASSERT(!(_tcb.status & STATUS_RECOVERY));
+    /* fast retransmit on the third duplicate ACK */
+    _dup_ack(NULL, 0);
+    TEST_ASSERT_EQUAL_INT(1, _sent(seqs, 4));
+    TEST_ASSERT_EQUAL_INT(SEG(0), seqs[0]);
+    TEST_ASSERT(_tcb.status & STATUS_RECOVERY);
+    TEST_ASSERT_EQUAL_INT(2 * TEST_SMSS, _tcb.ssthresh);
+    TEST_ASSERT_EQUAL_INT(5 * TEST_SMSS, _tcb.cwnd);
+    /* further duplicate ACKs inflate the window */
+    _dup_ack(NULL, 0);
+    TEST_ASSERT_EQUAL_INT(0, _sent(seqs, 4));
+    TEST_ASSERT_EQUAL_INT(6 * TEST_SMSS, _tcb.cwnd);
+    /* partial ACK: retransmit the next segment, deflate the window */
+    _rcv_ack(SEG(1), TEST_WND, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(1, _sent(seqs, 4));
+    TEST_ASSERT_EQUAL_INT(SEG(1), seqs[0]);
+    TEST_ASSERT(_tcb.status & STATUS_RECOVERY);
+    TEST_ASSERT_EQUAL_INT(6 * TEST_SMSS, _tcb.cwnd);
+    /* full ACK: leave fast recovery */
+    _rcv_ack(SEG(4), TEST_WND, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(0, _sent(seqs, 4));
+    TEST_ASSERT(!(_tcb.status & STATUS_RECOVERY));
+    TEST_ASSERT_EQUAL_INT(2 * TEST_SMSS, _tcb.cwnd);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.pkt_retransmit_num);
+    _check_pktbuf();
+}
+
+static void test_sack__retransmit_holes(void)
+{
+    const uint32_t sack1[][2] = { { SEG(1), SEG(2) } };
+    const uint32_t sack13[][2] = { { SEG(1), SEG(2) }, { SEG(3), SEG(4) } };
+    const uint32_t sack3[][2] = { { SEG(3), SEG(4) } };
+    uint32_t seqs[4];
+
+    TEST_ASSERT_EQUAL_INT(4 * TEST_SMSS, _send(sizeof(_data)));
+    TEST_ASSERT_EQUAL_INT(4, _sent(seqs, 4));
+    _dup_ack(sack1, 1);
+    TEST_ASSERT_EQUAL_INT(0x2, _tcb.pkt_sacked);
+    _dup_ack(sack13, 2);
+    TEST_ASSERT_EQUAL_INT(0xa, _tcb.pkt_sacked);
+    TEST_ASSERT_EQUAL_INT(0, _sent(seqs, 4));
+    /* the third duplicate ACK retransmits all holes below the highest SACK */
+    _dup_ack(sack13, 2);
+    TEST_ASSERT_EQUAL_INT(2, _sent(seqs, 4));
+    TEST_ASSERT_EQUAL_INT(SEG(0), seqs[0]);
+    TEST_ASSERT_EQUAL_INT(SEG(2), seqs[1]);
+    /* a partial ACK does not retransmit holes sent during this recovery again */
+    _rcv_ack(SEG(2), TEST_WND, sack3, 1);
+    TEST_ASSERT_EQUAL_INT(2, _tcb.pkt_retransmit_num);
+    TEST_ASSERT_EQUAL_INT(0x2, _tcb.pkt_sacked);
+    TEST_ASSERT_EQUAL_INT(0, _sent(seqs, 4));
+    _check_pktbuf();
+}
+
+static void test_timeout__slow_start(void)
+{
+    const uint32_t sack1[][2] = { { SEG(1), SEG(2) } };
+    uint32_t seqs[4];
+
+    TEST_ASSERT_EQUAL_INT(4 * TEST_SMSS, _send(sizeof(_data)));
+    TEST_ASSERT_EQUAL_INT(4, _sent(seqs, 4));
+    _dup_ack(sack1, 1);
+    TEST_ASSERT_EQUAL_INT(0x2, _tcb.pkt_sacked);
+    /* a timeout retransmits the oldest segment and discards SACK information */
+    _fsm(&_tcb, FSM_EVENT_TIMEOUT_RETRANSMIT, NULL, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(1, _sent(seqs, 4));
+    TEST_ASSERT_EQUAL_INT(SEG(0), seqs[0]);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.pkt_sacked);
+    TEST_ASSERT_EQUAL_INT(TEST_SMSS, _tcb.cwnd);
+    TEST_ASSERT_EQUAL_INT(2 * TEST_SMSS, _tcb.ssthresh);
+    /* partial ACK after a timeout: slow start, retransmit the next segment */
+    _rcv_ack(SEG(1), TEST_WND, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(2 * TEST_SMSS, _tcb.cwnd);
+    TEST_ASSERT_EQUAL_INT(1, _sent(seqs, 4));
+    TEST_ASSERT_EQUAL_INT(SEG(1), seqs[0]);
+    _check_pktbuf();
+}
+
+static void run_unittests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_option_parse__syn),
+        new_TestFixture(test_option_parse__ws_max),
+        new_TestFixture(test_option_parse__sack),
+        new_TestFixture(test_option_parse__malformed),
+        new_TestFixture(test_ws__scaled_send_window),
+        new_TestFixture(test_cwnd__slow_start_and_avoidance),
+        new_TestFixture(test_cwnd__fast_recovery),
+        new_TestFixture(test_sack__retransmit_holes),
+        new_TestFixture(test_timeout__slow_start),
+    };
+
+    EMB_UNIT_TESTCALLER(tcp_recovery_tests, _set_up, NULL, fixtures);
+    TESTS_START();
+    TESTS_RUN((Test *)&tcp_recovery_tests);
+    TESTS_END();
+}
+
+int main(void)
+{
+    /* the connection sends its segments to this thread */
+    msg_init_queue(_msg_queue, TEST_MSG_QUEUE_SIZE);
+    gnrc_tcp_pid = thread_getpid();
+    run_unittests();
+    return 0;
+}
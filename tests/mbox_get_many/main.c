@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Test application for mbox_get_many() and mbox_try_get_many()
+ *
+ * Writers of different priorities block on a full mailbox. Taking messages
+ * out must let one writer per freed slot continue, the ones with the highest
+ * priority first.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "mbox.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define QUEUE_SIZE      (4U)
+#define WRITERS_NUMOF   (4U)
+/* lets lower priority threads run */
+#define IDLE_TIME       (10U * US_PER_MS)
+
+typedef struct {
+    char stack[THREAD_STACKSIZE_DEFAULT];
+    uint8_t priority;
+    uint16_t type;
+    kernel_pid_t pid;
+} _writer_t;
+
+static msg_t _queue[QUEUE_SIZE];
+static mbox_t _mbox = MBOX_INIT(_queue, QUEUE_SIZE);
+
+static _writer_t _writers[WRITERS_NUMOF] = {
+    { .priority = THREAD_PRIORITY_MAIN - 1, .type = 10 },
+    { .priority = THREAD_PRIORITY_MAIN - 2, .type = 20 },
+    { .priority = THREAD_PRIORITY_MAIN + 1, .type = 30 },
+    { .priority = THREAD_PRIORITY_MAIN + 1, .type = 40 },
+};
+
+/* types of the messages in the order the writers delivered them */
+static uint16_t _done[WRITERS_NUMOF];
+static unsigned _done_numof;
+
+static void *_writer(void *arg)
+{
+    _writer_t *writer = arg;
+    msg_t msg = { .type = writer->type };
+
+    mbox_put(&_mbox, &msg);
+    _done[_done_numof++] = writer->type;
+
+    return NULL;
+}
+
+static void _start_writer(_writer_t *writer)
+{
+    writer->pid = thread_create(writer->stack, sizeof(writer->stack),
+                                writer->priority, THREAD_CREATE_STACKTEST,
+                                _writer, writer, "writer");
+    expect(pid_is_valid(writer->pid));
+}
+
+static void _expect_msgs(const msg_t *msgs, unsigned num,
+                         const uint16_t *types)
+{
+    for (unsigned i = 0; i < num; i++) {
+        expect(msgs[i].type == types[i]);
+    }
+}
+
+static void test_blocked_writers(void)
+{
+    msg_t msgs[2 * QUEUE_SIZE];
+
+    for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+        msg_t msg = { .type = i };
+        expect(mbox_try_put(&_mbox, &msg));
+    }
+
+    /* all writers block on the full mailbox */
+    _start_writer(&_writers[0]);
+    _start_writer(&_writers[1]);
+    _start_writer(&_writers[2]);
+    xtimer_usleep(IDLE_TIME);
+    expect(_done_numof == 0);
+
+    /* two freed slots wake the two writers with the highest priority, both
+     * preempt this thread before the call returns */
+    expect(mbox_try_get_many(&_mbox, msgs, 2) == 2);
+    _expect_msgs(msgs, 2, (uint16_t []){ 0, 1 });
+    expect(_done_numof == 2);
+    expect((_done[0] == 20) && (_done[1] == 10));
+
+    /* freeing all slots wakes the last writer, which has a lower priority */
+    expect(mbox_try_get_many(&_mbox, msgs, ARRAY_SIZE(msgs)) == QUEUE_SIZE);
+    _expect_msgs(msgs, QUEUE_SIZE, (uint16_t []){ 2, 3, 20, 10 });
+    expect(msgs[2].sender_pid == _writers[1].pid);
+    expect(msgs[3].sender_pid == _writers[0].pid);
+    expect(_done_numof == 2);
+    xtimer_usleep(IDLE_TIME);
+    expect(_done_numof == 3);
+
+    expect(mbox_get_many(&_mbox, msgs, ARRAY_SIZE(msgs)) == 1);
+    _expect_msgs(msgs, 1, (uint16_t []){ 30 });
+    expect(mbox_try_get_many(&_mbox, msgs, ARRAY_SIZE(msgs)) == 0);
+    puts("blocked writers: OK");
+}
+
+static void test_blocked_reader(void)
+{
+    msg_t msgs[QUEUE_SIZE];
+
+    /* the writer hands its message directly to the waiting reader */
+    _start_writer(&_writers[3]);
+    expect(mbox_get_many(&_mbox, msgs, ARRAY_SIZE(msgs)) == 1);
+    _expect_msgs(msgs, 1, (uint16_t []){ 40 });
+    expect(mbox_try_get_many(&_mbox, msgs, ARRAY_SIZE(msgs)) == 0);
+    puts("blocked reader: OK");
+}
+
+int main(void)
+{
+    test_blocked_writers();
+    test_blocked_reader();
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Tests for the native mtd flash emulation
+ */
+#include <string.h>
+#include <errno.h>
+
+#include "embUnit.h"
+
+#include "board.h"
+#include "mtd.h"
+#include "mtd_native.h"
+#include "xtimer.h"
+
+#define PAGE_SIZE           (64U)
+#define PAGES_PER_SECTOR    (4U)
+#define SECTOR_SIZE         (PAGE_SIZE * PAGES_PER_SECTOR)
+#define SECTOR_NUM          (4U)
+#define WRITE_LATENCY_US    (2000U)
+#define ERASE_LATENCY_US    (10000U)
+
+static uint32_t _wear[SECTOR_NUM];
+
+static mtd_native_dev_t _native = {
+    .dev = {
+        .driver = &native_flash_driver,
+        .sector_count = SECTOR_NUM,
+        .pages_per_sector = PAGES_PER_SECTOR,
+        .page_size = PAGE_SIZE,
+    },
+    .fname = "MTD_NATIVE_TEST.bin",
+    .wear = _wear,
+};
+
+static mtd_dev_t *dev = &_native.dev;
+
+static uint8_t _buf[SECTOR_SIZE];
+
+static void setup(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(dev));
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase(dev, 0, SECTOR_NUM * SECTOR_SIZE));
+    memset(_wear, 0, sizeof(_wear));
+    _native.write_latency_us = 0;
+    _native.erase_latency_us = 0;
+}
+
+static void _expect(uint32_t addr, uint32_t len, uint8_t val)
+{
+    TEST_ASSERT_EQUAL_INT(len, mtd_read(dev, _buf, addr, len));
+    for (uint32_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_INT(val, _buf[i]);
+    }
+}
+
+static void test_mtd_write_and(void)
+{
+    uint8_t data[PAGE_SIZE];
+
+    /* unaligned head and tail around whole words */
+    for (uint32_t len = 1; len < 3 * sizeof(uintptr_t); len++) {
+        for (uint32_t start = 0; start < sizeof(uintptr_t); start++) {
+            uint32_t addr = PAGE_SIZE + start;
+
+            TEST_ASSERT_EQUAL_INT(0, mtd_erase(dev, 0, SECTOR_SIZE));
+            memset(data, 0xf0, len);
+            TEST_ASSERT_EQUAL_INT(len, mtd_write(dev, data, addr, len));
+            memset(data, 0x3c, len);
+            TEST_ASSERT_EQUAL_INT(len, mtd_write(dev, data, addr, len));
+
+            /* programming only clears bits */
+            _expect(addr, len, 0x30);
+            _expect(PAGE_SIZE, start, 0xff);
+            _expect(addr + len, 2 * PAGE_SIZE - (addr + len), 0xff);
+        }
+    }
+
+    /* a full page */
+    memset(data, 0x00, sizeof(data));
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE,
+                          mtd_write(dev, data, 3 * PAGE_SIZE, PAGE_SIZE));
+    _expect(3 * PAGE_SIZE, PAGE_SIZE, 0x00);
+    _expect(2 * PAGE_SIZE, PAGE_SIZE, 0xff);
+    _expect(SECTOR_SIZE, PAGE_SIZE, 0xff);
+}
+
+static void test_mtd_write_bounds(void)
+{
+    uint8_t data[2] = { 0 };
+
+    /* writes must not cross a page boundary or the end of the device */
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW,
+                          mtd_write(dev, data, PAGE_SIZE - 1, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW,
+                          mtd_write(dev, data, SECTOR_NUM * SECTOR_SIZE - 1,
+                                    sizeof(data)));
+    _expect(PAGE_SIZE - 1, sizeof(data), 0xff);
+}
+
+static void test_mtd_erase(void)
+{
+    uint8_t data[PAGE_SIZE];
+
+    memset(data, 0x00, sizeof(data));
+    for (uint32_t addr = 0; addr < 2 * SECTOR_SIZE; addr += PAGE_SIZE) {
+        TEST_ASSERT_EQUAL_INT(PAGE_SIZE,
+                              mtd_write(dev, data, addr, PAGE_SIZE));
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase(dev, SECTOR_SIZE, SECTOR_SIZE));
+    _expect(0, SECTOR_SIZE, 0x00);
+    _expect(SECTOR_SIZE, SECTOR_SIZE, 0xff);
+
+    /* only whole sectors can be erased */
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_erase(dev, PAGE_SIZE, SECTOR_SIZE));
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_erase(dev, 0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW,
+                          mtd_erase(dev, SECTOR_SIZE, SECTOR_NUM * SECTOR_SIZE));
+    _expect(0, SECTOR_SIZE, 0x00);
+}
+
+static void test_mtd_wear(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase(dev, SECTOR_SIZE, 2 * SECTOR_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase(dev, 2 * SECTOR_SIZE, SECTOR_SIZE));
+    /* rejected erases do not wear the flash */
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_erase(dev, 0, PAGE_SIZE));
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_native_wear(dev, 0));
+    TEST_ASSERT_EQUAL_INT(1, mtd_native_wear(dev, 1));
+    TEST_ASSERT_EQUAL_INT(2, mtd_native_wear(dev, 2));
+    TEST_ASSERT_EQUAL_INT(0, mtd_native_wear(dev, 3));
+
+    /* the board's device counts erase cycles with MTD_NATIVE_WEAR */
+    uint32_t sector = MTD_SECTOR_NUM - 1;
+    uint32_t wear = mtd_native_wear(mtd0, sector);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(mtd0));
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase(mtd0, sector * MTD_SECTOR_SIZE,
+                                       MTD_SECTOR_SIZE));
+    TEST_ASSERT_EQUAL_INT(wear + 1, mtd_native_wear(mtd0, sector));
+}
+
+static void test_mtd_latency(void)
+{
+    uint8_t data[PAGE_SIZE] = { 0 };
+    uint32_t start;
+
+    _native.write_latency_us = WRITE_LATENCY_US;
+    _native.erase_latency_us = ERASE_LATENCY_US;
+
+    start = xtimer_now_usec();
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, mtd_write(dev, data, 0, PAGE_SIZE));
+    TEST_ASSERT(xtimer_now_usec() - start >= WRITE_LATENCY_US);
+
+    /* erasing stalls once per sector */
+    start = xtimer_now_usec();
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase(dev, 0, 2 * SECTOR_SIZE));
+    TEST_ASSERT(xtimer_now_usec() - start >= 2 * ERASE_LATENCY_US);
+
+    /* rejected requests do not stall */
+    start = xtimer_now_usec();
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_erase(dev, 0, PAGE_SIZE));
+    TEST_ASSERT(xtimer_now_usec() - start < ERASE_LATENCY_US);
+}
+
+Test *tests_mtd_native_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_write_and),
+        new_TestFixture(test_mtd_write_bounds),
+        new_TestFixture(test_mtd_erase),
+        new_TestFixture(test_mtd_wear),
+        new_TestFixture(test_mtd_latency),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_native_tests, setup, NULL, fixtures);
+
+    return (Test *)&mtd_native_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_native_tests());
+    TESTS_END();
+    return 0;
+}
+/** @} */
@@ -0,0 +1,338 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for nanocoap_get_blockwise()
+ *
+ * A local CoAP server serves a file via the IPv6 loopback address. It can
+ * delay, duplicate, reorder and drop its responses and limit the block size.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ipv6/addr.h"
+#include "net/nanocoap_sock.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define FILE_PATH       "/file"
+#define FILE_SIZE       (1000U)
+#define QUEUE_SIZE      (16U)
+#define BUF_SIZE        (64U + 256U)
+/* delay of responses to even blocks to reorder them */
+#define REORDER_DELAY   (20U * US_PER_MS)
+#define BENCH_LATENCY   (20U * US_PER_MS)
+/* time for the server to flush the responses of a test */
+#define SETTLE_TIME     (100U * US_PER_MS)
+
+typedef struct {
+    uint32_t latency;       /**< delay of every response */
+    uint32_t drop;          /**< drop the first request of these blocks */
+    uint8_t max_szx;        /**< largest block size the server sends */
+    bool duplicate;         /**< send every response twice */
+    bool reorder;           /**< delay responses to even blocks */
+} _faults_t;
+
+typedef struct {
+    uint32_t due;
+    sock_udp_ep_t remote;
+    size_t len;
+    uint8_t buf[BUF_SIZE];
+} _response_t;
+
+typedef struct {
+    size_t offset;
+    int more;
+    bool failed;
+} _download_t;
+
+static char _server_stack[THREAD_STACKSIZE_DEFAULT + BUF_SIZE];
+static _response_t _queue[QUEUE_SIZE];
+static unsigned _queued;
+static _faults_t _faults;
+static uint32_t _seen;
+static unsigned _requests;
+
+static uint8_t _file_byte(size_t offset)
+{
+    return (uint8_t)(offset * 7 + offset / 251);
+}
+
+static void _enqueue(const uint8_t *buf, size_t len,
+                     const sock_udp_ep_t *remote, uint32_t delay)
+{
+    expect(_queued < QUEUE_SIZE);
+    _response_t *res = &_queue[_queued++];
+
+    res->due = xtimer_now_usec() + delay;
+    res->remote = *remote;
+    res->len = len;
+    memcpy(res->buf, buf, len);
+}
+
+static uint32_t _send_due(sock_udp_t *sock)
+{
+    uint32_t timeout = SOCK_NO_TIMEOUT;
+    unsigned i = 0;
+
+    while (i < _queued) {
+        _response_t *res = &_queue[i];
+        int32_t left = (int32_t)(res->due - xtimer_now_usec());
+
+        if (left <= 0) {
+            sock_udp_send(sock, res->buf, res->len, &res->remote);
+            *res = _queue[--_queued];
+            continue;
+        }
+        if ((uint32_t)left < timeout) {
+            timeout = left;
+        }
+        i++;
+    }
+    return timeout;
+}
+
+static void _handle_request(uint8_t *buf, size_t len,
+                            const sock_udp_ep_t *remote)
+{
+    coap_pkt_t pkt;
+    coap_block1_t block2;
+    uint8_t path[NANOCOAP_URI_MAX];
+
+    if ((coap_parse(&pkt, buf, len) < 0) ||
+        (coap_get_block2(&pkt, &block2) != 1)) {
+        return;
+    }
+    _requests++;
+
+    uint32_t num = block2.blknum;
+    if ((num < 32) && (_faults.drop & (1UL << num)) &&
+        !(_seen & (1UL << num))) {
+        _seen |= 1UL << num;
+        return;
+    }
+
+    unsigned szx = (block2.szx < _faults.max_szx) ? block2.szx
+                                                  : _faults.max_szx;
+    size_t offset = num << (block2.szx + 4);
+    size_t blksize = 1U << (szx + 4);
+    uint16_t id = coap_get_id(&pkt);
+    uint8_t *pos = buf;
+
+    num = offset >> (szx + 4);
+    if ((coap_get_uri_path(&pkt, path) <= 0) ||
+        strcmp((char *)path, FILE_PATH)) {
+        pos += coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_ACK, NULL, 0,
+                              COAP_CODE_PATH_NOT_FOUND, id);
+    }
+    else if (offset >= FILE_SIZE) {
+        pos += coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_ACK, NULL, 0,
+                              COAP_CODE_BAD_OPTION, id);
+    }
+    else {
+        size_t n = FILE_SIZE - offset;
+        unsigned more = (n > blksize);
+
+        if (more) {
+            n = blksize;
+        }
+        pos += coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_ACK, NULL, 0,
+                              COAP_CODE_205, id);
+        pos += coap_opt_put_uint(pos, 0, COAP_OPT_BLOCK2,
+                                 (num << 4) | (more << 3) | szx);
+        *pos++ = 0xff;
+        for (size_t i = 0; i < n; i++) {
+            *pos++ = _file_byte(offset + i);
+        }
+    }
+
+    uint32_t delay = _faults.latency;
+    if (_faults.reorder && !(num & 1)) {
+        delay += REORDER_DELAY;
+    }
+    _enqueue(buf, pos - buf, remote, delay);
+    if (_faults.duplicate) {
+        _enqueue(buf, pos - buf, remote, delay);
+    }
+}
+
+static void *_server(void *arg)
+{
+    static uint8_t buf[BUF_SIZE];
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_ep_t remote;
+    sock_udp_t sock;
+
+    (void)arg;
+    local.port = COAP_PORT;
+    expect(sock_udp_create(&sock, &local, NULL, 0) == 0);
+
+    while (1) {
+        uint32_t timeout = _send_due(&sock);
+        ssize_t res = sock_udp_recv(&sock, buf, sizeof(buf), timeout, &remote);
+
+        if (res > 0) {
+            _handle_request(buf, res, &remote);
+        }
+    }
+
+    return NULL;
+}
+
+static int _check_block(void *arg, size_t offset, uint8_t *buf, size_t len,
+                        int more)
+{
+    _download_t *download = arg;
+
+    if ((offset != download->offset) || (download->more == 0)) {
+        download->failed = true;
+        return -1;
+    }
+    for (size_t i = 0; i < len; i++) {
+        if (buf[i] != _file_byte(offset + i)) {
+            download->failed = true;
+            return -1;
+        }
+    }
+    download->offset += len;
+    download->more = more;
+    return 0;
+}
+
+static int _fetch(const char *path, coap_blksize_t blksize, unsigned window)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = COAP_PORT };
+    _download_t download = { .more = 1 };
+
+    memcpy(remote.addr.ipv6, &ipv6_addr_loopback, sizeof(remote.addr.ipv6));
+    _requests = 0;
+    _seen = 0;
+    int res = nanocoap_get_blockwise(&remote, path, blksize, window,
+                                     _check_block, &download);
+    /* let the server flush the responses still queued */
+    xtimer_usleep(SETTLE_TIME);
+    if (res == 0) {
+        expect(!download.failed);
+        expect(download.offset == FILE_SIZE);
+        expect(download.more == 0);
+    }
+    return res;
+}
+
+static void _set_faults(const _faults_t *faults)
+{
+    _faults = *faults;
+    if (_faults.max_szx == 0) {
+        _faults.max_szx = COAP_BLOCKSIZE_1024;
+    }
+}
+
+static void test_in_order(void)
+{
+    _set_faults(&(_faults_t){ 0 });
+    expect(_fetch(FILE_PATH, COAP_BLOCKSIZE_64, 1) == 0);
+    /* one request per block */
+    expect(_requests == (FILE_SIZE + 63) / 64);
+    expect(_fetch(FILE_PATH, COAP_BLOCKSIZE_64, 4) == 0);
+    /* the window runs past the end of the file */
+    expect(_requests >= (FILE_SIZE + 63) / 64);
+    expect(_fetch(FILE_PATH, COAP_BLOCKSIZE_256, 4) == 0);
+    puts("in order: OK");
+}
+
+static void test_smaller_blocks(void)
+{
+    _set_faults(&(_faults_t){ .max_szx = COAP_BLOCKSIZE_32 });
+    expect(_fetch(FILE_PATH, COAP_BLOCKSIZE_256, 4) == 0);
+    expect(_requests >= (FILE_SIZE + 31) / 32);
+    puts("smaller blocks: OK");
+}
+
+static void test_duplicates(void)
+{
+    _set_faults(&(_faults_t){ .duplicate = true });
+    expect(_fetch(FILE_PATH, COAP_BLOCKSIZE_64, 4) == 0);
+    /* duplicate responses neither fail nor trigger requests */
+    expect(_requests <= (FILE_SIZE + 63) / 64 + 4);
+    puts("duplicate responses: OK");
+}
+
+static void test_out_of_order(void)
+{
+    _set_faults(&(_faults_t){ .reorder = true });
+    expect(_fetch(FILE_PATH, COAP_BLOCKSIZE_64, 4) == 0);
+    _set_faults(&(_faults_t){ .reorder = true, .duplicate = true });
+    expect(_fetch(FILE_PATH, COAP_BLOCKSIZE_64, 4) == 0);
+    puts("out of order responses: OK");
+}
+
+static void test_lost(void)
+{
+    /* lose the first block, one in the middle of the window and the last */
+    _set_faults(&(_faults_t){ .drop = (1UL << 0) | (1UL << 5) | (1UL << 15) });
+    expect(_fetch(FILE_PATH, COAP_BLOCKSIZE_64, 4) == 0);
+    _set_faults(&(_faults_t){ .drop = (1UL << 3) | (1UL << 4),
+                              .reorder = true });
+    expect(_fetch(FILE_PATH, COAP_BLOCKSIZE_64, 1) == 0);
+    puts("lost requests: OK");
+}
+
+static void test_errors(void)
+{
+    _set_faults(&(_faults_t){ 0 });
+    expect(_fetch("/missing", COAP_BLOCKSIZE_64, 4) < 0);
+    puts("error responses: OK");
+}
+
+static uint32_t _bench(unsigned window)
+{
+    uint32_t start = xtimer_now_usec();
+
+    expect(_fetch(FILE_PATH, COAP_BLOCKSIZE_64, window) == 0);
+    return xtimer_now_usec() - start - SETTLE_TIME;
+}
+
+static void bench_latency(void)
+{
+    _set_faults(&(_faults_t){ .latency = BENCH_LATENCY });
+    uint32_t single = _bench(1);
+    uint32_t windowed = _bench(4);
+
+    printf("window 1: %" PRIu32 " us, window 4: %" PRIu32 " us\n",
+           single, windowed);
+    expect(windowed < single);
+    puts("latency: OK");
+}
+
+int main(void)
+{
+    thread_create(_server_stack, sizeof(_server_stack),
+                  THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                  _server, NULL, "server");
+
+    test_in_order();
+    test_smaller_blocks();
+    test_duplicates();
+    test_out_of_order();
+    test_lost();
+    test_errors();
+    bench_latency();
+
+    puts("SUCCESS");
+    return 0;
+}
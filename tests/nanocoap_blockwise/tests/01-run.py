@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2020 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("in order: OK")
+    child.expect_exact("smaller blocks: OK")
+    child.expect_exact("duplicate responses: OK")
+    child.expect_exact("out of order responses: OK")
+    child.expect_exact("lost requests: OK")
+    child.expect_exact("error responses: OK")
+    child.expect_exact("latency: OK")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
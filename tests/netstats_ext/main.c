@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Application to check the @ref NETSTATS_EXT pseudomodule
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "net/gcoap.h"
+#include "net/gnrc/netif/stats_coap.h"
+#include "net/sock/udp.h"
+#include "shell.h"
+#include "shell_commands.h"
+#include "thread.h"
+
+#define SINK_PORT   (8808U)
+
+static const coap_resource_t _resources[] = {
+    GNRC_NETIF_STATS_COAP_RESOURCE,
+};
+
+static gcoap_listener_t _listener = {
+    _resources,
+    ARRAY_SIZE(_resources),
+    NULL,
+    NULL
+};
+
+static char _sink_stack[THREAD_STACKSIZE_DEFAULT];
+
+static void *_sink(void *arg)
+{
+    (void)arg;
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_t sock;
+    uint8_t buf[128];
+
+    local.port = SINK_PORT;
+    if (sock_udp_create(&sock, &local, NULL, 0) < 0) {
+        puts("Error creating UDP sock");
+        return NULL;
+    }
+    while (1) {
+        /* only the delivery of the packet is of interest */
+        sock_udp_recv(&sock, buf, sizeof(buf), SOCK_NO_TIMEOUT, NULL);
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    gcoap_register_listener(&_listener);
+    thread_create(_sink_stack, sizeof(_sink_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _sink, NULL, "sink");
+
+    (void) puts("Welcome to RIOT!");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(NULL, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2020 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import pexpect
+import re
+import socket
+import subprocess
+import sys
+import time
+
+from testrunner import run
+
+
+SINK_PORT = 8808
+SINK_PKTS = 5
+
+
+def get_bridge(tap):
+    output = subprocess.check_output(["bridge", "link"]).decode("utf-8")
+    for line in output.splitlines():
+        m = re.search(r"{}.+master\s+(?P<master>[^\s]+)".format(tap), line)
+        if m is not None:
+            return m.group("master")
+    return tap
+
+
+def get_lladdr(child):
+    # the link-local address is only valid after duplicate address detection
+    for _ in range(5):
+        time.sleep(1)
+        child.sendline('ifconfig')
+        res = child.expect([
+            r'(?P<lladdr>fe80::[A-Fa-f:0-9]+)\s+scope:\s+link\s+VAL',
+            pexpect.TIMEOUT
+        ])
+        if res == 0:
+            return child.match.group('lladdr').lower()
+    raise pexpect.TIMEOUT('Link-local address did not become valid')
+
+
+def send_to_sink(lladdr, tap):
+    with socket.socket(socket.AF_INET6, socket.SOCK_DGRAM) as s:
+        res = socket.getaddrinfo('{}%{}'.format(lladdr, tap), SINK_PORT)
+        for _ in range(SINK_PKTS):
+            s.sendto(b'hello', res[0][4])
+            time.sleep(.1)
+
+
+def testfunc(child):
+    child.sendline('ifconfig')
+    child.expect(r'Iface\s+(\d+)\s+')
+    iface = child.match.group(1)
+    child.expect(r'       Statistics for extended')
+    child.expect(r'        RX packets \d+  bytes \d+')
+    child.expect(r'        TX packets \d+  bytes \d+  errors \d+')
+    child.expect(r'        Dropped pktbuf \d+, queue \d+, filter \d+, '
+                 r'no receiver \d+, invalid \d+')
+    child.expect(r'        Queue high-water marks: interface \d+  sock \d+')
+    child.sendline('ifconfig {} stats ext reset'.format(iface))
+    child.expect_exact('Reset statistics for module extended!')
+    child.sendline('ifconfig {} stats ext'.format(iface))
+    child.expect(r'       Statistics for extended')
+
+    # packets to the sink are delivered to a sock, so they are counted and
+    # show up in the latency histogram
+    lladdr = get_lladdr(child)
+    child.sendline('ifconfig {} stats ext reset'.format(iface))
+    child.expect_exact('Reset statistics for module extended!')
+    send_to_sink(lladdr, get_bridge(os.environ['TAP']))
+    child.sendline('ifconfig {} stats ext'.format(iface))
+    child.expect(r'       Statistics for extended')
+    child.expect(r'        RX packets [1-9]\d*  bytes [1-9]\d*')
+    child.expect(r'        Queue high-water marks: interface \d+  '
+                 r'sock [1-9]\d*')
+    child.expect_exact('        RX to sock latency:')
+    child.expect(r'          [<>]=?\s+\d+ us: [1-9]\d*')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
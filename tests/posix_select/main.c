@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for poll(), select() and epoll on sockets
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "netinet/in.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+#define UDP_PORT        (4711U)
+#define TCP_PORT        (4712U)
+#define TIMEOUT_MS      (100)
+#define EPOLL_DATA      (42U)
+#define CLIENT_FLAG     (0x1)
+
+static char _client_stack[THREAD_STACKSIZE_MAIN];
+static thread_t *_client;
+static char _buf[16];
+
+static struct sockaddr_in6 _addr(uint16_t port)
+{
+    struct sockaddr_in6 addr = { .sin6_family = AF_INET6,
+                                 .sin6_port = htons(port) };
+
+    memcpy(&addr.sin6_addr, &in6addr_loopback, sizeof(addr.sin6_addr));
+    return addr;
+}
+
+static int _udp_socket(uint16_t port)
+{
+    struct sockaddr_in6 addr = _addr(port);
+    int fd = socket(AF_INET6, SOCK_DGRAM, IPPROTO_UDP);
+
+    expect(fd >= 0);
+    if (port != 0) {
+        expect(bind(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0);
+    }
+    return fd;
+}
+
+static void _udp_send(int fd)
+{
+    struct sockaddr_in6 addr = _addr(UDP_PORT);
+
+    expect(sendto(fd, "abc", 3, 0, (struct sockaddr *)&addr,
+                  sizeof(addr)) == 3);
+}
+
+static void test_poll_udp(void)
+{
+    int rx = _udp_socket(UDP_PORT);
+    int tx = _udp_socket(0);
+    struct pollfd fds[] = { { .fd = rx, .events = POLLIN },
+                            { .fd = -1, .events = POLLIN } };
+
+    expect(poll(fds, 2, 0) == 0);
+    _udp_send(tx);
+    expect(poll(fds, 2, TIMEOUT_MS) == 1);
+    expect(fds[0].revents & POLLIN);
+    expect(fds[1].revents == 0);
+    expect(recv(rx, _buf, sizeof(_buf), 0) == 3);
+    expect(poll(fds, 2, TIMEOUT_MS) == 0);
+    /* datagram sockets are always writable */
+    fds[0].events = POLLOUT;
+    expect(poll(fds, 1, -1) == 1);
+    expect(fds[0].revents == POLLOUT);
+    close(tx);
+    close(rx);
+    puts("poll() on UDP sockets: OK");
+}
+
+static void test_select_udp(void)
+{
+    int rx = _udp_socket(UDP_PORT);
+    int tx = _udp_socket(0);
+    struct timeval tv = { .tv_sec = 0 };
+    fd_set readfds;
+
+    FD_ZERO(&readfds);
+    FD_SET(rx, &readfds);
+    expect(select(rx + 1, &readfds, NULL, NULL, &tv) == 0);
+    expect(!FD_ISSET(rx, &readfds));
+    _udp_send(tx);
+    _udp_send(tx);
+    FD_SET(rx, &readfds);
+    expect(select(rx + 1, &readfds, NULL, NULL, NULL) == 1);
+    expect(FD_ISSET(rx, &readfds));
+    /* the second datagram keeps the socket readable */
+    expect(recv(rx, _buf, sizeof(_buf), 0) == 3);
+    expect(select(rx + 1, &readfds, NULL, NULL, &tv) == 1);
+    expect(recv(rx, _buf, sizeof(_buf), 0) == 3);
+    tv.tv_usec = TIMEOUT_MS * 1000;
+    expect(select(rx + 1, &readfds, NULL, NULL, &tv) == 0);
+    close(tx);
+    close(rx);
+    puts("select() on UDP sockets: OK");
+}
+
+static void test_epoll_udp(void)
+{
+    int rx = _udp_socket(UDP_PORT);
+    int tx = _udp_socket(0);
+    int epfd = epoll_create1(0);
+    struct epoll_event ev = { .events = EPOLLIN, .data.u32 = EPOLL_DATA };
+    struct epoll_event events[2];
+
+    expect(epfd >= 0);
+    expect(epoll_ctl(epfd, EPOLL_CTL_ADD, rx, &ev) == 0);
+    expect(epoll_ctl(epfd, EPOLL_CTL_ADD, rx, &ev) < 0);
+    expect(epoll_wait(epfd, events, 2, 0) == 0);
+    _udp_send(tx);
+    expect(epoll_wait(epfd, events, 2, TIMEOUT_MS) == 1);
+    expect(events[0].events == EPOLLIN);
+    expect(events[0].data.u32 == EPOLL_DATA);
+    /* readiness is level-triggered */
+    expect(epoll_wait(epfd, events, 2, 0) == 1);
+    expect(recv(rx, _buf, sizeof(_buf), 0) == 3);
+    expect(epoll_wait(epfd, events, 2, TIMEOUT_MS) == 0);
+    /* the sending socket is always writable */
+    ev.events = EPOLLOUT;
+    ev.data.fd = tx;
+    expect(epoll_ctl(epfd, EPOLL_CTL_ADD, tx, &ev) == 0);
+    expect(epoll_wait(epfd, events, 2, -1) == 1);
+    expect(events[0].events == EPOLLOUT);
+    expect(events[0].data.fd == tx);
+    expect(epoll_ctl(epfd, EPOLL_CTL_DEL, tx, NULL) == 0);
+    expect(epoll_wait(epfd, events, 2, 0) == 0);
+    expect(epoll_ctl(epfd, EPOLL_CTL_DEL, tx, NULL) < 0);
+    /* closing a file descriptor without removing it frees its entry */
+    expect(epoll_ctl(epfd, EPOLL_CTL_ADD, tx, &ev) == 0);
+    close(tx);
+    expect(epoll_wait(epfd, events, 2, 0) == 0);
+    expect((epoll_ctl(epfd, EPOLL_CTL_DEL, tx, NULL) < 0) && (errno == ENOENT));
+    /* ... also when it was not ready while closing it */
+    ev.events = EPOLLIN;
+    tx = _udp_socket(0);
+    expect(epoll_ctl(epfd, EPOLL_CTL_ADD, tx, &ev) == 0);
+    expect(epoll_wait(epfd, events, 2, 0) == 0);
+    close(tx);
+    expect(epoll_wait(epfd, events, 2, 0) == 0);
+    expect(_udp_socket(0) == tx);
+    expect(epoll_ctl(epfd, EPOLL_CTL_ADD, tx, &ev) == 0);
+    expect(epoll_ctl(epfd, EPOLL_CTL_DEL, tx, NULL) == 0);
+    close(tx);
+    expect(epoll_ctl(epfd, EPOLL_CTL_DEL, rx, NULL) == 0);
+    close(epfd);
+    close(rx);
+    puts("epoll on UDP sockets: OK");
+}
+
+static void *_client_thread(void *arg)
+{
+    struct sockaddr_in6 addr = _addr(TCP_PORT);
+    int fd = socket(AF_INET6, SOCK_STREAM, IPPROTO_TCP);
+
+    (void)arg;
+    expect(fd >= 0);
+    expect(connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0);
+    thread_flags_wait_any(CLIENT_FLAG);
+    expect(write(fd, "hello", 5) == 5);
+    thread_flags_wait_any(CLIENT_FLAG);
+    close(fd);
+    return NULL;
+}
+
+static void test_poll_tcp(void)
+{
+    struct sockaddr_in6 addr = _addr(TCP_PORT);
+    int server = socket(AF_INET6, SOCK_STREAM, IPPROTO_TCP);
+    struct pollfd fds[] = { { .fd = server, .events = POLLIN } };
+    kernel_pid_t pid;
+    int conn;
+
+    expect(server >= 0);
+    expect(bind(server, (struct sockaddr *)&addr, sizeof(addr)) == 0);
+    expect(listen(server, 1) == 0);
+    expect(poll(fds, 1, 0) == 0);
+    pid = thread_create(_client_stack, sizeof(_client_stack),
+                        THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                        _client_thread, NULL, "client");
+    _client = (thread_t *)thread_get(pid);
+    expect(poll(fds, 1, TIMEOUT_MS) == 1);
+    expect(fds[0].revents == POLLIN);
+    conn = accept(server, NULL, NULL);
+    expect(conn >= 0);
+    expect(poll(fds, 1, 0) == 0);
+
+    fds[0].fd = conn;
+    fds[0].events = POLLIN | POLLOUT;
+    expect(poll(fds, 1, 0) == 1);
+    expect(fds[0].revents == POLLOUT);
+    fds[0].events = POLLIN;
+    thread_flags_set(_client, CLIENT_FLAG);
+    expect(poll(fds, 1, TIMEOUT_MS) == 1);
+    expect(fds[0].revents == POLLIN);
+    expect(read(conn, _buf, sizeof(_buf)) == 5);
+    expect(poll(fds, 1, 0) == 0);
+    thread_flags_set(_client, CLIENT_FLAG);
+    expect(poll(fds, 1, TIMEOUT_MS) == 1);
+    expect(fds[0].revents == (POLLIN | POLLHUP));
+    expect(read(conn, _buf, sizeof(_buf)) == 0);
+    close(conn);
+    close(server);
+    puts("poll() on TCP sockets: OK");
+}
+
+int main(void)
+{
+    puts("poll(), select() and epoll test application\n");
+
+    test_poll_udp();
+    test_select_udp();
+    test_epoll_udp();
+    test_poll_tcp();
+
+    puts("SUCCESS");
+    return 0;
+}
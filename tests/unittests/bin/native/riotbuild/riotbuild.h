@@ -0,0 +1,56 @@
+/* Generated file do not edit */
+#define FIB_DEVEL_HELPER 1
+#define UNIVERSAL_ADDRESS_SIZE 16
+#define UNIVERSAL_ADDRESS_MAX_ENTRIES 40
+#define DEBUG_ASSERT_VERBOSE 1
+#define RIOT_APPLICATION "tests_unittests"
+#define BOARD_NATIVE "native"
+#define RIOT_BOARD BOARD_NATIVE
+#define CPU_NATIVE "native"
+#define RIOT_CPU CPU_NATIVE
+#define MCU_NATIVE "native"
+#define RIOT_MCU MCU_NATIVE
+#define NDEBUG 1
+#define TEST_SUITES fib,pktbuf,ztimer,nanocoap,inet_csum,checksum,netreg
+#define RIOT_VERSION "5711"
+#define MODULE_BOARD 1
+#define MODULE_CHECKSUM 1
+#define MODULE_CORE 1
+#define MODULE_CORE_INIT 1
+#define MODULE_CORE_MSG 1
+#define MODULE_CORE_PANIC 1
+#define MODULE_CPU 1
+#define MODULE_DIV 1
+#define MODULE_EMBUNIT 1
+#define MODULE_FIB 1
+#define MODULE_GNRC_NETREG 1
+#define MODULE_GNRC_PKT 1
+#define MODULE_GNRC_PKTBUF 1
+#define MODULE_GNRC_PKTBUF_STATIC 1
+#define MODULE_INET_CSUM 1
+#define MODULE_NANOCOAP 1
+#define MODULE_NATIVE_DRIVERS 1
+#define MODULE_PERIPH 1
+#define MODULE_PERIPH_COMMON 1
+#define MODULE_PERIPH_GPIO 1
+#define MODULE_PERIPH_INIT 1
+#define MODULE_PERIPH_INIT_GPIO 1
+#define MODULE_PERIPH_INIT_PM 1
+#define MODULE_PERIPH_INIT_TIMER 1
+#define MODULE_PERIPH_INIT_UART 1
+#define MODULE_PERIPH_PM 1
+#define MODULE_PERIPH_TIMER 1
+#define MODULE_PERIPH_UART 1
+#define MODULE_POSIX_HEADERS 1
+#define MODULE_STDIN 1
+#define MODULE_STDIO_NATIVE 1
+#define MODULE_SYS 1
+#define MODULE_TEST_UTILS_INTERACTIVE_SYNC 1
+#define MODULE_UNIVERSAL_ADDRESS 1
+#define MODULE_XTIMER 1
+#define MODULE_ZTIMER_CONVERT 1
+#define MODULE_ZTIMER_CONVERT_MULDIV64 1
+#define MODULE_ZTIMER_CORE 1
+#define MODULE_ZTIMER_EXTEND 1
+#define MODULE_ZTIMER_HEAP 1
+#define MODULE_ZTIMER_MOCK 1
@@ -64,6 +64,29 @@ static void test_checksum_crc8_sequence_4bytes(void)
     TEST_ASSERT_EQUAL_INT(expect, crc8(buf, sizeof(buf), CRC8_POLY, CRC8_INIT));
 }
 
+static void test_checksum_crc8_table_vs_bitwise(void)
+{
+    static crc8_table_t table;
+    static uint8_t buf[67];
+    static const uint8_t polys[] = { CRC8_POLY, 0x07, 0x9b };
+    uint32_t seed = 1;
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        seed = (seed * 1103515245UL) + 12345UL;
+        buf[i] = seed >> 16;
+    }
+    for (unsigned p = 0; p < sizeof(polys); p++) {
+        crc8_table_init(&table, polys[p]);
+        for (unsigned off = 0; off < 3; off++) {
+            for (unsigned len = 0; len <= sizeof(buf) - off; len++) {
+                TEST_ASSERT_EQUAL_INT(
+                    crc8(buf + off, len, polys[p], CRC8_INIT),
+                    crc8_table_calc(&table, buf + off, len, CRC8_INIT));
+            }
+        }
+    }
+}
+
 Test *tests_checksum_crc8_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -74,6 +97,7 @@ Test *tests_checksum_crc8_tests(void)
         new_TestFixture(test_checksum_crc8_sequence_256a),
         new_TestFixture(test_checksum_crc8_sequence_1to9),
         new_TestFixture(test_checksum_crc8_sequence_4bytes),
+        new_TestFixture(test_checksum_crc8_table_vs_bitwise),
     };
 
     EMB_UNIT_TESTCALLER(checksum_crc8_tests, NULL, NULL, fixtures);
@@ -123,6 +123,35 @@ static void test_checksum_ucrc16_le_ieee802164_frame(void)
     TEST_ASSERT_EQUAL_INT(expect, result);
 }
 
+static void test_checksum_ucrc16_table_vs_bitwise(void)
+{
+    static ucrc16_table_t table_be, table_le;
+    static uint8_t buf[67];
+    static const uint16_t polys[] = { UCRC16_CCITT_POLY_BE, 0x8005, 0x3d65 };
+    uint32_t seed = 1;
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        seed = (seed * 1103515245UL) + 12345UL;
+        buf[i] = seed >> 16;
+    }
+    for (unsigned p = 0; p < sizeof(polys) / sizeof(polys[0]); p++) {
+        ucrc16_table_init_be(&table_be, polys[p]);
+        ucrc16_table_init_le(&table_le, polys[p]);
+        for (unsigned off = 0; off < 3; off++) {
+            for (unsigned len = 0; len <= sizeof(buf) - off; len++) {
+                TEST_ASSERT_EQUAL_INT(
+                    ucrc16_calc_be(buf + off, len, polys[p], CRC16_CCITT_SEED),
+                    ucrc16_table_calc_be(&table_be, buf + off, len,
+                                         CRC16_CCITT_SEED));
+                TEST_ASSERT_EQUAL_INT(
+                    ucrc16_calc_le(buf + off, len, polys[p], CRC16_CCITT_SEED),
+                    ucrc16_table_calc_le(&table_le, buf + off, len,
+                                         CRC16_CCITT_SEED));
+            }
+        }
+    }
+}
+
 Test *tests_checksum_ucrc16_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -134,6 +163,7 @@ Test *tests_checksum_ucrc16_tests(void)
         new_TestFixture(test_checksum_ucrc16_be_sequence_1to9),
         new_TestFixture(test_checksum_ucrc16_be_sequence_4bytes),
         new_TestFixture(test_checksum_ucrc16_le_ieee802164_frame),
+        new_TestFixture(test_checksum_ucrc16_table_vs_bitwise),
     };
 
     EMB_UNIT_TESTCALLER(checksum_ucrc16_tests, NULL, NULL, fixtures);
@@ -976,6 +976,94 @@ static void test_fib_20_replace_prefix(void)
     fib_deinit(&test_fib_table);
 }
 
+/*
+* @brief testing that overlapping prefixes resolve to the longest one
+*/
+static void test_fib_21_longest_prefix_match(void)
+{
+    size_t add_buf_size = 16;
+    uint8_t addr_dst[add_buf_size];
+    uint8_t addr_nxt[add_buf_size];
+    uint8_t addr_lookup[add_buf_size];
+    kernel_pid_t iface_id = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags = 0;
+    static const uint32_t prefix_lens[] = { 32, 96, 64 };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(prefix_lens); i++) {
+        memset(addr_dst, 0xaa, prefix_lens[i] >> 3);
+        memset(addr_dst + (prefix_lens[i] >> 3), 0,
+               add_buf_size - (prefix_lens[i] >> 3));
+        memset(addr_nxt, (int)prefix_lens[i], add_buf_size);
+        TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, addr_dst,
+                              add_buf_size, (prefix_lens[i] << FIB_FLAG_NET_PREFIX_SHIFT),
+                              addr_nxt, add_buf_size, 0, 100000));
+    }
+
+    /* matches all three prefixes */
+    memset(addr_lookup, 0xaa, add_buf_size);
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                          addr_nxt, &add_buf_size, &next_hop_flags,
+                          addr_lookup, add_buf_size, 0));
+    TEST_ASSERT_EQUAL_INT(96, addr_nxt[0]);
+
+    /* matches the /32 and /64 prefix only */
+    add_buf_size = 16;
+    addr_lookup[9] = 0x55;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                          addr_nxt, &add_buf_size, &next_hop_flags,
+                          addr_lookup, add_buf_size, 0));
+    TEST_ASSERT_EQUAL_INT(64, addr_nxt[0]);
+
+    /* remove the /64 prefix */
+    add_buf_size = 16;
+    memset(addr_dst, 0xaa, 8);
+    memset(addr_dst + 8, 0, 8);
+    fib_remove_entry(&test_fib_table, addr_dst, add_buf_size);
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                          addr_nxt, &add_buf_size, &next_hop_flags,
+                          addr_lookup, add_buf_size, 0));
+    TEST_ASSERT_EQUAL_INT(32, addr_nxt[0]);
+    TEST_ASSERT_EQUAL_INT(2, fib_get_num_used_entries(&test_fib_table));
+
+    fib_deinit(&test_fib_table);
+}
+
+/*
+* @brief testing that expired entries are removed on lookup
+*/
+static void test_fib_22_expire_entry(void)
+{
+    size_t add_buf_size = 16;
+    char addr_dst_expired[] = "Test address 01";
+    char addr_dst_valid[] = "Test address 02";
+    char addr_nxt[] = "Test address 03";
+    kernel_pid_t iface_id = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags = 0;
+
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42,
+                          (uint8_t *)addr_dst_valid, add_buf_size - 1, 0,
+                          (uint8_t *)addr_nxt, add_buf_size - 1, 0, 100000));
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42,
+                          (uint8_t *)addr_dst_expired, add_buf_size - 1, 0,
+                          (uint8_t *)addr_nxt, add_buf_size - 1, 0, 1));
+    TEST_ASSERT_EQUAL_INT(2, fib_get_num_used_entries(&test_fib_table));
+
+    xtimer_usleep(2 * US_PER_MS);
+
+    TEST_ASSERT_EQUAL_INT(-EHOSTUNREACH, fib_get_next_hop(&test_fib_table,
+                          &iface_id, (uint8_t *)addr_nxt, &add_buf_size,
+                          &next_hop_flags, (uint8_t *)addr_dst_expired,
+                          add_buf_size - 1, 0));
+    TEST_ASSERT_EQUAL_INT(1, fib_get_num_used_entries(&test_fib_table));
+    add_buf_size = 16;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table,
+                          &iface_id, (uint8_t *)addr_nxt, &add_buf_size,
+                          &next_hop_flags, (uint8_t *)addr_dst_valid,
+                          add_buf_size - 1, 0));
+
+    fib_deinit(&test_fib_table);
+}
+
 Test *tests_fib_tests(void)
 {
     fib_init(&test_fib_table);
@@ -1000,6 +1088,8 @@ Test *tests_fib_tests(void)
                         new_TestFixture(test_fib_18_get_next_hop_invalid_parameters),
                         new_TestFixture(test_fib_19_default_gateway),
                         new_TestFixture(test_fib_20_replace_prefix),
+                        new_TestFixture(test_fib_21_longest_prefix_match),
+                        new_TestFixture(test_fib_22_expire_entry),
     };
 
     EMB_UNIT_TESTCALLER(fib_tests, NULL, NULL, fixtures);
@@ -165,6 +165,80 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+/* straight-forward byte-wise implementation to compare against */
+static uint16_t _ref_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len,
+                                size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    if (len == 0) {
+        return csum;
+    }
+    if (accum_len & 1) {
+        csum += *buf;
+        buf++;
+        len--;
+    }
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if (len & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static uint32_t _seed;
+
+static uint32_t _rand(void)
+{
+    _seed = (_seed * 1103515245UL) + 12345UL;
+    return _seed >> 8;
+}
+
+static void test_inet_csum__random_slices(void)
+{
+    static uint8_t data[300];
+
+    _seed = 1;
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        /* mostly 0xff to provoke carries */
+        data[i] = (_rand() & 1) ? 0xff : _rand();
+    }
+    for (unsigned i = 0; i < 2000; i++) {
+        uint16_t offset = _rand() % 16;
+        uint16_t len = _rand() % (sizeof(data) - offset);
+        uint16_t sum = _rand();
+        size_t accum_len = _rand() % 4;
+
+        TEST_ASSERT_EQUAL_INT(_ref_csum_slice(sum, &data[offset], len, accum_len),
+                              inet_csum_slice(sum, &data[offset], len, accum_len));
+    }
+}
+
+static void test_inet_csum__random_split(void)
+{
+    static uint8_t data[300];
+
+    _seed = 2;
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = _rand();
+    }
+    for (unsigned i = 0; i < 500; i++) {
+        uint16_t len = _rand() % sizeof(data);
+        uint16_t split = (len) ? _rand() % len : 0;
+        uint16_t sum;
+
+        /* checksum over two slices must equal the one over the whole buffer */
+        sum = inet_csum_slice(0, data, split, 0);
+        sum = inet_csum_slice(sum, &data[split], len - split, split);
+        TEST_ASSERT_EQUAL_INT(inet_csum(0, data, len), sum);
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +250,8 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__random_slices),
+        new_TestFixture(test_inet_csum__random_split),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
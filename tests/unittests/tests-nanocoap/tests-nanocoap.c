@@ -713,6 +713,62 @@ static void test_nanocoap__options_get_opaque(void)
     TEST_ASSERT_EQUAL_INT(-ENOENT, optlen);
 }
 
+static const coap_resource_t _find_resources[] = {
+    { "/", COAP_GET, NULL, NULL },
+    { "/a", COAP_GET | COAP_MATCH_SUBTREE, NULL, NULL },
+    { "/a/b", COAP_GET | COAP_POST, NULL, NULL },
+    { "/a/b", COAP_PUT, NULL, NULL },
+    { "/a/b/c", COAP_DELETE, NULL, NULL },
+    { "/ab", COAP_PUT, NULL, NULL },
+    { "/b", COAP_POST | COAP_MATCH_SUBTREE, NULL, NULL },
+    { "/b/c", COAP_GET, NULL, NULL },
+    { "/b/cd", COAP_GET | COAP_MATCH_SUBTREE, NULL, NULL },
+    { "/b/d", COAP_PUT, NULL, NULL },
+    { "/c", COAP_GET, NULL, NULL },
+};
+
+static const char *_find_uris[] = {
+    "", "/", "/a", "/a/", "/a/b", "/a/b/", "/a/b/c", "/ab", "/abc", "/b",
+    "/b/", "/b/c", "/b/cd", "/b/cde", "/b/d", "/b/e", "/c", "/c/", "/d",
+};
+
+/*
+ * Compares coap_find_resource() to a linear search over the resources.
+ */
+static void test_nanocoap__find_resource(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_find_uris); i++) {
+        for (unsigned code = COAP_METHOD_GET; code <= COAP_METHOD_DELETE;
+             code++) {
+            coap_method_flags_t method_flag = coap_method2flag(code);
+            const coap_resource_t *expected = NULL, *resource = NULL;
+            int expected_res = -ENOENT;
+
+            for (unsigned j = 0; j < ARRAY_SIZE(_find_resources); j++) {
+                if (coap_match_path(&_find_resources[j],
+                                    (uint8_t *)_find_uris[i]) != 0) {
+                    continue;
+                }
+                if (!(_find_resources[j].methods & method_flag)) {
+                    expected_res = -EPERM;
+                    continue;
+                }
+                expected = &_find_resources[j];
+                expected_res = 0;
+                break;
+            }
+            TEST_ASSERT_EQUAL_INT(expected_res,
+                                  coap_find_resource(_find_resources,
+                                                     ARRAY_SIZE(_find_resources),
+                                                     (uint8_t *)_find_uris[i],
+                                                     method_flag, &resource));
+            if (expected) {
+                TEST_ASSERT(expected == resource);
+            }
+        }
+    }
+}
+
 Test *tests_nanocoap_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -736,6 +792,7 @@ Test *tests_nanocoap_tests(void)
         new_TestFixture(test_nanocoap__server_reply_simple_con),
         new_TestFixture(test_nanocoap__server_option_count_overflow_check),
         new_TestFixture(test_nanocoap__server_option_count_overflow),
+        new_TestFixture(test_nanocoap__find_resource),
     };
 
     EMB_UNIT_TESTCALLER(nanocoap_tests, NULL, NULL, fixtures);
@@ -14,6 +14,7 @@
 #include <errno.h>
 
 #include "embUnit.h"
+#include "kernel_defines.h"
 
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/nettype.h"
@@ -139,6 +140,38 @@ void test_netreg_getnext__2_entries(void)
     TEST_ASSERT_NOT_NULL(gnrc_netreg_getnext(res));
 }
 
+void test_netreg_getnext__many_contexts(void)
+{
+    static gnrc_netreg_entry_t many[64];
+    gnrc_netreg_entry_t *res = NULL;
+
+    /* every demux context registered twice */
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i++) {
+        gnrc_netreg_entry_init_pid(&many[i], i / 2, TEST_UINT8);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &many[i]));
+    }
+    for (unsigned ctx = 0; ctx < ARRAY_SIZE(many) / 2; ctx++) {
+        unsigned num = 0;
+
+        TEST_ASSERT_EQUAL_INT(2, gnrc_netreg_num(GNRC_NETTYPE_TEST, ctx));
+        for (res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST, ctx); res != NULL;
+             res = gnrc_netreg_getnext(res)) {
+            TEST_ASSERT_EQUAL_INT(ctx, res->demux_ctx);
+            num++;
+        }
+        TEST_ASSERT_EQUAL_INT(2, num);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i += 2) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &many[i]);
+    }
+    for (unsigned ctx = 0; ctx < ARRAY_SIZE(many) / 2; ctx++) {
+        TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST, ctx)));
+        TEST_ASSERT(res == &many[(ctx * 2) + 1]);
+        TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    }
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, GNRC_NETREG_DEMUX_CTX_ALL));
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -155,6 +188,7 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_getnext__many_contexts),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
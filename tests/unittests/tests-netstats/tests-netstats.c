@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/netstats.h"
+
+#include "tests-netstats.h"
+
+#define LAST_BUCKET     (CONFIG_NETSTATS_EXT_LATENCY_BUCKETS - 1)
+
+static netstats_ext_t _stats;
+
+static void set_up(void)
+{
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+static unsigned _bucket_of(uint32_t usec)
+{
+    netstats_ext_t stats;
+
+    memset(&stats, 0, sizeof(stats));
+    netstats_ext_add_latency(&stats, usec);
+    for (unsigned i = 0; i < CONFIG_NETSTATS_EXT_LATENCY_BUCKETS; i++) {
+        if (stats.latency[i]) {
+            return i;
+        }
+    }
+    return UINT32_MAX;
+}
+
+static void test_netstats_ext_latency_zero(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _bucket_of(0));
+}
+
+static void test_netstats_ext_latency_bounds(void)
+{
+    /* bucket i counts [2^(i-1), 2^i) */
+    TEST_ASSERT_EQUAL_INT(1, _bucket_of(1));
+    for (unsigned i = 2; i < CONFIG_NETSTATS_EXT_LATENCY_BUCKETS; i++) {
+        TEST_ASSERT_EQUAL_INT(i - 1, _bucket_of((1UL << (i - 1)) - 1));
+        TEST_ASSERT_EQUAL_INT(i, _bucket_of(1UL << (i - 1)));
+    }
+}
+
+static void test_netstats_ext_latency_saturate(void)
+{
+    TEST_ASSERT_EQUAL_INT(LAST_BUCKET,
+                          _bucket_of(1UL << CONFIG_NETSTATS_EXT_LATENCY_BUCKETS));
+    TEST_ASSERT_EQUAL_INT(LAST_BUCKET, _bucket_of(UINT32_MAX));
+    TEST_ASSERT_EQUAL_INT(LAST_BUCKET, _bucket_of(0x80000000UL));
+}
+
+static void test_netstats_ext_latency_count(void)
+{
+    netstats_ext_add_latency(&_stats, 3);
+    netstats_ext_add_latency(&_stats, 2);
+    netstats_ext_add_latency(&_stats, 4);
+    netstats_ext_add_latency(&_stats, UINT32_MAX);
+    netstats_ext_add_latency(&_stats, UINT32_MAX);
+
+    TEST_ASSERT_EQUAL_INT(0, _stats.latency[0]);
+    TEST_ASSERT_EQUAL_INT(0, _stats.latency[1]);
+    TEST_ASSERT_EQUAL_INT(2, _stats.latency[2]);
+    TEST_ASSERT_EQUAL_INT(1, _stats.latency[3]);
+    TEST_ASSERT_EQUAL_INT(2, _stats.latency[LAST_BUCKET]);
+}
+
+static void test_netstats_ext_queue_fill(void)
+{
+    netstats_ext_queue_fill(&_stats.sock_queue_max, 3);
+    TEST_ASSERT_EQUAL_INT(3, _stats.sock_queue_max);
+    netstats_ext_queue_fill(&_stats.sock_queue_max, 1);
+    TEST_ASSERT_EQUAL_INT(3, _stats.sock_queue_max);
+    netstats_ext_queue_fill(&_stats.sock_queue_max, 4);
+    TEST_ASSERT_EQUAL_INT(4, _stats.sock_queue_max);
+}
+
+Test *tests_netstats_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_netstats_ext_latency_zero),
+        new_TestFixture(test_netstats_ext_latency_bounds),
+        new_TestFixture(test_netstats_ext_latency_saturate),
+        new_TestFixture(test_netstats_ext_latency_count),
+        new_TestFixture(test_netstats_ext_queue_fill),
+    };
+
+    EMB_UNIT_TESTCALLER(netstats_tests, set_up, NULL, fixtures);
+
+    return (Test *)&netstats_tests;
+}
+
+void tests_netstats(void)
+{
+    TESTS_RUN(tests_netstats_tests());
+}
+/** @} */
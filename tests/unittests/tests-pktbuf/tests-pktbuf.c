@@ -245,7 +245,9 @@ static void test_pktbuf_add__packed_struct(void)
     TEST_ASSERT_EQUAL_INT(data.s64, data_cpy->s64);
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC   /* alignment-handling left to malloc, so no certainty here */
+/* alignment-handling left to malloc, so no certainty here; size classes of
+ * gnrc_pktbuf_slab are always large enough to hold the unaligned size */
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
 static void test_pktbuf_add__unaligned_in_aligned_hole(void)
 {
     gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, NULL, 8, GNRC_NETTYPE_TEST);
@@ -813,7 +815,8 @@ static void test_pktbuf_start_write__pkt_users_2(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+/* the chunk sizes assumed here only match gnrc_pktbuf_static */
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
 static void test_pktbuf_reverse_snips__too_full(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_next, *pkt_huge;
@@ -835,7 +838,7 @@ static void test_pktbuf_reverse_snips__too_full(void)
     gnrc_pktbuf_release(pkt_next);
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif
 
 static void test_pktbuf_reverse_snips__success(void)
 {
@@ -868,7 +871,7 @@ Test *tests_pktbuf_tests(void)
 #endif
         new_TestFixture(test_pktbuf_add__success),
         new_TestFixture(test_pktbuf_add__packed_struct),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
         new_TestFixture(test_pktbuf_add__unaligned_in_aligned_hole),
 #endif
         new_TestFixture(test_pktbuf_add__0_sized_release),
@@ -906,9 +909,9 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_start_write__NULL),
         new_TestFixture(test_pktbuf_start_write__pkt_users_1),
         new_TestFixture(test_pktbuf_start_write__pkt_users_2),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
         new_TestFixture(test_pktbuf_reverse_snips__too_full),
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif
         new_TestFixture(test_pktbuf_reverse_snips__success),
     };
 
@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 2020 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for ztimer clocks keeping their timers in a heap
+ */
+
+#include <string.h>
+
+#include "kernel_defines.h"
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+#define TIMERS_NUMOF    (64U)
+#define OPS_NUMOF       (2000U)
+
+typedef struct {
+    ztimer_mock_t zmock;
+    ztimer_t timers[TIMERS_NUMOF];
+    uint32_t targets[TIMERS_NUMOF];
+    uint8_t log[OPS_NUMOF];
+    unsigned log_len;
+} _clock_ctx_t;
+
+static _clock_ctx_t _ctx[2];
+static uint32_t _seed;
+
+static uint32_t _rand(void)
+{
+    _seed = (_seed * 1103515245UL) + 12345UL;
+    return _seed >> 8;
+}
+
+static void cb_incr(void *arg)
+{
+    uint32_t *ptr = arg;
+    *ptr += 1;
+}
+
+static void cb_log(void *arg)
+{
+    ztimer_t *timer = arg;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_ctx); i++) {
+        _clock_ctx_t *ctx = &_ctx[i];
+
+        if ((timer >= &ctx->timers[0]) &&
+            (timer < &ctx->timers[TIMERS_NUMOF]) &&
+            (ctx->log_len < OPS_NUMOF)) {
+            ctx->log[ctx->log_len++] = timer - ctx->timers;
+        }
+    }
+}
+
+/**
+ * @brief   Testing 32 bit wide mock clock set functionality using a heap
+ */
+static void test_ztimer_heap_set32(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+
+    ztimer_mock_init(&zmock, 32);
+    z->use_heap = true;
+
+    uint32_t count = 0;
+    ztimer_t alarm = { .callback = cb_incr, .arg = &count, };
+    ztimer_t alarm2 = { .callback = cb_incr, .arg = &count, };
+    ztimer_set(z, &alarm, 1000);
+    ztimer_set(z, &alarm2, 500);
+
+    ztimer_mock_advance(&zmock,  499);    /* now =  499 */
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&zmock,    1);    /* now =  500 */
+    TEST_ASSERT_EQUAL_INT(1, count);
+    ztimer_mock_advance(&zmock,  499);    /* now =  999 */
+    TEST_ASSERT_EQUAL_INT(1, count);
+    ztimer_mock_advance(&zmock,    1);    /* now = 1000 */
+    TEST_ASSERT_EQUAL_INT(2, count);
+    ztimer_set(z, &alarm, 4000001000ul);
+    ztimer_set(z, &alarm2, 0);
+    TEST_ASSERT_EQUAL_INT(2, count);
+    ztimer_mock_advance(&zmock, 1000);    /* now = 2000 */
+    TEST_ASSERT_EQUAL_INT(3, count);
+    ztimer_mock_advance(&zmock, 4000000000ul);  /* now = 4000002000 */
+    TEST_ASSERT_EQUAL_INT(4, count);
+    ztimer_set(z, &alarm, 15);
+    ztimer_set(z, &alarm2, 10);
+    ztimer_mock_advance(&zmock, 14);
+    TEST_ASSERT_EQUAL_INT(5, count);
+    ztimer_remove(z, &alarm);
+    ztimer_remove(z, &alarm2);
+    ztimer_mock_advance(&zmock, 1000);
+    TEST_ASSERT_EQUAL_INT(5, count);
+    TEST_ASSERT_NULL(z->heap);
+    TEST_ASSERT_NULL(z->list.next);
+}
+
+/* fills a timer with pointers to @p decoy, as left behind on the stack */
+static void _dirty(ztimer_t *timer, ztimer_base_t *decoy)
+{
+    timer->base.next = decoy;
+    timer->base.offset = 0xa5a5a5a5;
+    timer->base.child = decoy;
+    timer->base.prev = decoy;
+}
+
+static void _set_remove_dirty(bool use_heap)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_base_t decoy, decoy_copy;
+    uint32_t count = 0;
+    ztimer_t pending = { .callback = cb_incr, .arg = &count, };
+    ztimer_t alarm;
+
+    ztimer_mock_init(&zmock, 32);
+    z->use_heap = use_heap;
+    memset(&decoy, 0, sizeof(decoy));
+    decoy.next = &pending.base;
+    decoy.child = &pending.base;
+    memcpy(&decoy_copy, &decoy, sizeof(decoy));
+
+    ztimer_set(z, &pending, 2000);
+
+    /* removing a dirty timer that was never set must not touch anything */
+    _dirty(&alarm, &decoy);
+    ztimer_remove(z, &alarm);
+
+    /* setting a dirty timer must work like setting a clean one */
+    _dirty(&alarm, &decoy);
+    alarm.callback = cb_incr;
+    alarm.arg = &count;
+    ztimer_set(z, &alarm, 1000);
+    ztimer_mock_advance(&zmock, 999);   /* now =  999 */
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&zmock, 1);     /* now = 1000 */
+    TEST_ASSERT_EQUAL_INT(1, count);
+
+    /* set for immediate expiry, which puts it on the list of a heap clock */
+    _dirty(&alarm, &decoy);
+    alarm.callback = cb_incr;
+    alarm.arg = &count;
+    ztimer_set(z, &alarm, 0);
+    ztimer_mock_advance(&zmock, 1);     /* now = 1001 */
+    TEST_ASSERT_EQUAL_INT(2, count);
+
+    /* set and remove again */
+    _dirty(&alarm, &decoy);
+    ztimer_set(z, &alarm, 500);
+    ztimer_remove(z, &alarm);
+    ztimer_mock_advance(&zmock, 998);   /* now = 1999 */
+    TEST_ASSERT_EQUAL_INT(2, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(3, count);
+
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&decoy, &decoy_copy, sizeof(decoy)));
+    TEST_ASSERT_NULL(z->heap);
+    TEST_ASSERT_NULL(z->list.next);
+}
+
+/**
+ * @brief   Testing set and remove of a timer with stale contents on a clock
+ *          using a heap and on one using a list
+ */
+static void test_ztimer_heap_dirty_timer(void)
+{
+    _set_remove_dirty(true);
+    _set_remove_dirty(false);
+}
+
+/**
+ * @brief   Testing that a clock using a heap triggers timers in the same
+ *          order as one using the list
+ */
+static void test_ztimer_heap_vs_list(void)
+{
+    memset(_ctx, 0, sizeof(_ctx));
+    for (unsigned i = 0; i < ARRAY_SIZE(_ctx); i++) {
+        ztimer_mock_init(&_ctx[i].zmock, 16);
+        for (unsigned j = 0; j < TIMERS_NUMOF; j++) {
+            _ctx[i].timers[j].callback = cb_log;
+            _ctx[i].timers[j].arg = &_ctx[i].timers[j];
+        }
+    }
+    _ctx[1].zmock.super.use_heap = true;
+    _seed = 1;
+
+    for (unsigned op = 0; op < OPS_NUMOF; op++) {
+        unsigned n = _rand() % TIMERS_NUMOF;
+        uint32_t r = _rand();
+
+        switch (r % 4) {
+        case 0:
+        case 1: {
+            /* targets need to be unique to have a defined order */
+            uint32_t val = (r >> 2) % 100000UL;
+            uint32_t target = ztimer_now(&_ctx[0].zmock.super) + val;
+            bool unique = true;
+
+            for (unsigned j = 0; j < TIMERS_NUMOF; j++) {
+                if (_ctx[0].targets[j] == target) {
+                    unique = false;
+                }
+            }
+            if (unique) {
+                for (unsigned i = 0; i < ARRAY_SIZE(_ctx); i++) {
+                    _ctx[i].targets[n] = target;
+                    ztimer_set(&_ctx[i].zmock.super, &_ctx[i].timers[n], val);
+                }
+            }
+            break;
+        }
+        case 2:
+            for (unsigned i = 0; i < ARRAY_SIZE(_ctx); i++) {
+                ztimer_remove(&_ctx[i].zmock.super, &_ctx[i].timers[n]);
+            }
+            break;
+        default:
+            for (unsigned i = 0; i < ARRAY_SIZE(_ctx); i++) {
+                ztimer_mock_advance(&_ctx[i].zmock, (r >> 2) % 5000UL);
+            }
+            break;
+        }
+        TEST_ASSERT_EQUAL_INT(_ctx[0].log_len, _ctx[1].log_len);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_ctx); i++) {
+        ztimer_mock_advance(&_ctx[i].zmock, 200000UL);
+    }
+    TEST_ASSERT(_ctx[0].log_len > TIMERS_NUMOF);
+    TEST_ASSERT_EQUAL_INT(_ctx[0].log_len, _ctx[1].log_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_ctx[0].log, _ctx[1].log, _ctx[0].log_len));
+    TEST_ASSERT_NULL(_ctx[1].zmock.super.heap);
+    TEST_ASSERT_NULL(_ctx[1].zmock.super.list.next);
+}
+
+Test *tests_ztimer_heap_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_heap_set32),
+        new_TestFixture(test_ztimer_heap_vs_list),
+        new_TestFixture(test_ztimer_heap_dirty_timer),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_heap_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_heap_tests;
+}
+
+/** @} */